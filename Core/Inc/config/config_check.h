@@ -0,0 +1,81 @@
+/**
+ * @file config_check.h
+ * @brief robot_config.h 컴파일 타임 검사 - 프로파일 값 범위, 타이머 클럭, 핀 중복
+ *
+ * robot_config.h 끝에서만 include. 검사는 전부 static assert라 코드가 생기지 않음.
+ */
+
+#ifndef __CONFIG_CHECK_H
+#define __CONFIG_CHECK_H
+
+#include "drivers/gpio_batch.h"
+
+#define CFG_ASSERT(cond, msg)   _Static_assert(cond, msg)
+
+/* ===== 값 범위 ===== */
+CFG_ASSERT(MOTOR_BASE_SPEED > 0 && MOTOR_BASE_SPEED <= 100, "MOTOR_BASE_SPEED: 1~100%");
+CFG_ASSERT(MOTOR_TURN_SPEED > 0 && MOTOR_TURN_SPEED <= 100, "MOTOR_TURN_SPEED: 1~100%");
+CFG_ASSERT(MOTOR_ARC_TURN > 0 && MOTOR_ARC_TURN < 50, "MOTOR_ARC_TURN: 1~49 (50 = 피벗)");
+CFG_ASSERT(MOTOR_RAMP_UP > 0 && MOTOR_RAMP_DOWN > 0, "램프 폭은 1%/ms 이상");
+
+CFG_ASSERT(ENCODER_SLOTS > 0 && WHEEL_DIAMETER_MM > 0 && TRACK_EFFECTIVE_MM > 0, "기구 치수");
+CFG_ASSERT(ENCODER_DEBOUNCE_US < 1000000U / (ENCODER_SLOTS * 2 * 5),
+           "ENCODER_DEBOUNCE_US가 초당 5바퀴 에지 간격보다 김");
+
+CFG_ASSERT(SERVO_MIN_ANGLE < SERVO_CENTER_ANGLE && SERVO_CENTER_ANGLE < SERVO_MAX_ANGLE &&
+           SERVO_MAX_ANGLE <= 180, "서보 각도: MIN < CENTER < MAX <= 180");
+CFG_ASSERT(SERVO_STEP_ANGLE > 0 && (SERVO_MAX_ANGLE - SERVO_MIN_ANGLE) % SERVO_STEP_ANGLE == 0,
+           "스캔 범위가 SERVO_STEP_ANGLE로 나누어떨어져야 양 끝에 닿음");
+CFG_ASSERT((SERVO_CENTER_ANGLE - SERVO_MIN_ANGLE) % SERVO_STEP_ANGLE == 0,
+           "SERVO_CENTER_ANGLE이 스캔 격자 위에 있어야 함");
+CFG_ASSERT(SERVO_PULSE_MIN_US < SERVO_PULSE_MAX_US, "서보 펄스 폭");
+
+CFG_ASSERT(DIST_DANGER < DIST_WARNING && DIST_WARNING < DIST_SAFE, "DIST_DANGER < WARNING < SAFE");
+CFG_ASSERT(DIST_DANGER >= ULTRASONIC_MIN_CM && DIST_SAFE < ULTRASONIC_MAX_CM,
+           "거리 기준이 초음파 측정 범위 밖");
+CFG_ASSERT(ULTRASONIC_ECHO_MIN_US * 17U / 1000U <= ULTRASONIC_MIN_CM &&
+           ULTRASONIC_ECHO_MAX_US * 17U / 1000U >= ULTRASONIC_MAX_CM,
+           "ULTRASONIC_ECHO_MIN/MAX_US 구간이 ULTRASONIC_MIN/MAX_CM을 덮지 못함");
+CFG_ASSERT(AVOID_TURN_DEG > 0 && AVOID_TURN_DEG <= 180, "AVOID_TURN_DEG: 1~180");
+CFG_ASSERT(AVOID_ARC_MS > 0 && AVOID_ARC_MS <= 65535, "AVOID_ARC_MS: Motor_CurveFor는 16비트 ms");
+
+/* ===== 타이머 클럭 ===== */
+CFG_ASSERT(TIMEBASE_TICK_HZ == 1000000U, "TIM1 (Timebase)는 1MHz여야 함");
+CFG_ASSERT(MOTOR_TICK_HZ == 1000000U && MOTOR_PWM_PERIOD_US == 1000,
+           "TIM3는 1MHz / 1ms 주기여야 함 (모터 램프 %/ms, RGB PWM, LED 효과 1ms 틱)");
+CFG_ASSERT(BUZZER_TICK_HZ == 1000000U, "TIM4 (부저)는 1MHz여야 함 - ARR = 반주기 us");
+CFG_ASSERT((SERVO_TIM_PSC + 1) % (ROBOT_TIMCLK_HZ / 1000000U) == 0, "TIM2 틱이 us 정수가 아님");
+CFG_ASSERT(SERVO_FRAME_US == 20000, "서보 프레임은 20ms (50Hz)");
+CFG_ASSERT(SERVO_PULSE_MIN_US % SERVO_TICK_US == 0 && SERVO_PULSE_MAX_US % SERVO_TICK_US == 0,
+           "서보 펄스 폭이 TIM2 틱 배수가 아님");
+CFG_ASSERT(SERVO_CCR_MAX <= SERVO_TIM_ARR, "서보 최대 펄스가 TIM2 주기보다 김");
+CFG_ASSERT(SCAN_PERIOD_MS * 1000U >= SERVO_FRAME_US, "SCAN_PERIOD_MS가 서보 프레임보다 짧음");
+
+/* ===== 핀 중복 =====
+ * 포트마다 쓰는 핀 마스크를 더한 값과 OR한 값이 같으면 겹치는 핀이 없음 */
+#define CFG_PINS(port, OP) ( \
+    GPIO_MASK_ON(MOTOR_LFF_PORT, MOTOR_LFF_PIN, port) OP GPIO_MASK_ON(MOTOR_LFB_PORT, MOTOR_LFB_PIN, port) OP \
+    GPIO_MASK_ON(MOTOR_LBF_PORT, MOTOR_LBF_PIN, port) OP GPIO_MASK_ON(MOTOR_LBB_PORT, MOTOR_LBB_PIN, port) OP \
+    GPIO_MASK_ON(MOTOR_RFF_PORT, MOTOR_RFF_PIN, port) OP GPIO_MASK_ON(MOTOR_RFB_PORT, MOTOR_RFB_PIN, port) OP \
+    GPIO_MASK_ON(MOTOR_RBF_PORT, MOTOR_RBF_PIN, port) OP GPIO_MASK_ON(MOTOR_RBB_PORT, MOTOR_RBB_PIN, port) OP \
+    GPIO_MASK_ON(ENCODER_PORT, ENCODER_PIN, port) OP \
+    GPIO_MASK_ON(ULTRASONIC_TRIG_PORT, ULTRASONIC_TRIG_PIN, port) OP \
+    GPIO_MASK_ON(ULTRASONIC_ECHO_PORT, ULTRASONIC_ECHO_PIN, port) OP \
+    GPIO_MASK_ON(SERVO_PWM_PORT, SERVO_PWM_PIN, port) OP \
+    GPIO_MASK_ON(BUZZER_PORT, BUZZER_PIN, port) OP \
+    GPIO_MASK_ON(RED_GPIO_Port, RED_Pin, port) OP GPIO_MASK_ON(GREEN_GPIO_Port, GREEN_Pin, port) OP \
+    GPIO_MASK_ON(BLUE_GPIO_Port, BLUE_Pin, port) OP \
+    GPIO_MASK_ON(LCD_CS_PORT, LCD_CS_PIN, port) OP GPIO_MASK_ON(LCD_DC_PORT, LCD_DC_PIN, port) OP \
+    GPIO_MASK_ON(LCD_RES_PORT, LCD_RES_PIN, port) OP GPIO_MASK_ON(LCD_SPI_PORT, LCD_SPI_PINS, port) OP \
+    GPIO_MASK_ON(I2C_BUS_PORT, I2C_BUS_PINS, port) OP \
+    GPIO_MASK_ON(USART_TX_GPIO_Port, USART_TX_Pin | USART_RX_Pin, port))
+
+CFG_ASSERT(CFG_PINS(GPIOA, +) == CFG_PINS(GPIOA, |), "GPIOA 핀이 두 기능에 겹침");
+CFG_ASSERT(CFG_PINS(GPIOB, +) == CFG_PINS(GPIOB, |), "GPIOB 핀이 두 기능에 겹침");
+CFG_ASSERT(CFG_PINS(GPIOC, +) == CFG_PINS(GPIOC, |), "GPIOC 핀이 두 기능에 겹침");
+CFG_ASSERT(CFG_PINS(GPIOD, +) == CFG_PINS(GPIOD, |), "GPIOD 핀이 두 기능에 겹침");
+
+/* PA13/PA14 = SWD (JTAG만 끔, SysInit) */
+CFG_ASSERT((CFG_PINS(GPIOA, |) & (GPIO_PIN_13 | GPIO_PIN_14)) == 0, "PA13/PA14는 SWD");
+
+#endif /* __CONFIG_CHECK_H */
@@ -0,0 +1,40 @@
+/**
+ * @file hw_2wd.h
+ * @brief 하드웨어 프로파일: 2륜 + 캐스터 섀시 (같은 보드, 뒤 H브리지 채널은 비워 둠)
+ *
+ * 스키드가 없어서 제자리 회전 토크가 덜 들고 유효 트랙이 실제 바퀴 간격에 가까움.
+ * 트랙은 처음 값 - 4륜처럼 90도 회전으로 보정해서 고침.
+ */
+
+#ifndef __HW_2WD_H
+#define __HW_2WD_H
+
+#define ROBOT_HW_NAME       "2WD"
+
+/* PWM 속도 (%) */
+#define MOTOR_TURN_SPEED    60
+#define MOTOR_ARC_TURN      35      // 안쪽 바퀴 = 바깥쪽의 30%
+
+/* 가감속 램프 (%/ms) - 가벼워서 빨리 섬 */
+#define MOTOR_RAMP_UP       2
+#define MOTOR_RAMP_DOWN     3
+
+/* 엔코더 */
+#define ENCODER_SLOTS       20
+#define ENCODER_DEBOUNCE_US 300
+
+/* 기구 치수 (mm) */
+#define WHEEL_DIAMETER_MM   65
+#define TRACK_EFFECTIVE_MM  128
+
+/* 서보 (SG90) 펄스 폭 - 0도 / 180도 */
+#define SERVO_PULSE_MIN_US  500
+#define SERVO_PULSE_MAX_US  2500
+
+/* 초음파 (HC-SR04) 유효 거리 - ECHO 폭 구간은 펌웨어가 쓰던 값 그대로 (cm 구간을 덮음) */
+#define ULTRASONIC_MIN_CM   4
+#define ULTRASONIC_MAX_CM   390
+#define ULTRASONIC_ECHO_MIN_US  240
+#define ULTRASONIC_ECHO_MAX_US  23000
+
+#endif /* __HW_2WD_H */
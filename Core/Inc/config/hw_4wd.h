@@ -0,0 +1,39 @@
+/**
+ * @file hw_4wd.h
+ * @brief 하드웨어 프로파일: 4륜 스키드 섀시 (TT 기어모터 x4, 65mm 바퀴) - 기본
+ *
+ * robot_config.h에서만 include.
+ */
+
+#ifndef __HW_4WD_H
+#define __HW_4WD_H
+
+#define ROBOT_HW_NAME       "4WD"
+
+/* PWM 속도 (%) */
+#define MOTOR_TURN_SPEED    80      // 제자리 회전 (4륜 스키드라 직진보다 토크가 더 필요)
+#define MOTOR_ARC_TURN      30      // 곡선 회전 - 안쪽 바퀴 = 바깥쪽의 40%
+
+/* 가감속 램프 (%/ms) - 0→60% 60ms, 60→0% 30ms */
+#define MOTOR_RAMP_UP       1
+#define MOTOR_RAMP_DOWN     2
+
+/* 엔코더 (왼쪽 앞바퀴 슬롯 원판) */
+#define ENCODER_SLOTS       20      // 원판 슬롯 수 (양쪽 에지 → 회전당 40)
+#define ENCODER_DEBOUNCE_US 300     // 이보다 가까운 에지는 비교기 채터링으로 버림
+
+/* 기구 치수 (mm) - 트랙은 스키드 미끄러짐을 포함한 실측 유효값 (90도 회전으로 보정) */
+#define WHEEL_DIAMETER_MM   65
+#define TRACK_EFFECTIVE_MM  150
+
+/* 서보 (SG90) 펄스 폭 - 0도 / 180도 */
+#define SERVO_PULSE_MIN_US  500
+#define SERVO_PULSE_MAX_US  2500
+
+/* 초음파 (HC-SR04) 유효 거리 - ECHO 폭 구간은 펌웨어가 쓰던 값 그대로 (cm 구간을 덮음) */
+#define ULTRASONIC_MIN_CM   4
+#define ULTRASONIC_MAX_CM   390
+#define ULTRASONIC_ECHO_MIN_US  240
+#define ULTRASONIC_ECHO_MAX_US  23000
+
+#endif /* __HW_4WD_H */
@@ -0,0 +1,28 @@
+/**
+ * @file tune_cautious.h
+ * @brief 튜닝 프로파일: 조심 (넓게 보고 일찍 피함 - 예전 app/robot_config.h 값)
+ */
+
+#ifndef __TUNE_CAUTIOUS_H
+#define __TUNE_CAUTIOUS_H
+
+#define ROBOT_TUNE_NAME     "CAUTIOUS"
+
+#define MOTOR_BASE_SPEED    45
+
+/* 스캔 - 5도 간격이라 한 번 훑는 데 두 배 걸림 */
+#define SERVO_CENTER_ANGLE  90
+#define SERVO_MIN_ANGLE     30
+#define SERVO_MAX_ANGLE     150
+#define SERVO_STEP_ANGLE    5
+#define SCAN_PERIOD_MS      40
+
+/* 거리 기준 (cm) */
+#define DIST_SAFE           60
+#define DIST_WARNING        40
+#define DIST_DANGER         20
+
+#define AVOID_TURN_DEG      60      // 왼쪽 엔코더 하나 기준 - 실제 각도 오차는 heading.h
+#define AVOID_ARC_MS        600
+
+#endif /* __TUNE_CAUTIOUS_H */
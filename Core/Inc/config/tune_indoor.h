@@ -0,0 +1,32 @@
+/**
+ * @file tune_indoor.h
+ * @brief 튜닝 프로파일: 실내 기본 (좁은 통로, 빠른 스캔)
+ */
+
+#ifndef __TUNE_INDOOR_H
+#define __TUNE_INDOOR_H
+
+#define ROBOT_TUNE_NAME     "INDOOR"
+
+#define MOTOR_BASE_SPEED    60      // 직진 / 후진 (%)
+
+/* 스캔 (서보 각도, 도) */
+#define SERVO_CENTER_ANGLE  90
+#define SERVO_MIN_ANGLE     30
+#define SERVO_MAX_ANGLE     150
+#define SERVO_STEP_ANGLE    10
+#define SCAN_PERIOD_MS      40      // 한 걸음마다 (서보 이동 + 측정)
+
+/* 거리 기준 (cm) */
+#define DIST_SAFE           40
+#define DIST_WARNING        20
+#define DIST_DANGER         10
+
+/* 회피 회전 각도 (엔코더 폐루프, drivers/heading.c)
+ * 엔코더가 왼쪽 바퀴 하나라 좌우 편차 / 바닥에 따른 트랙 변화는 못 봄 - 실제 각도는 더 작을 수 있음 (heading.h) */
+#define AVOID_TURN_DEG      45
+
+/* DIST_WARNING보다 멀면 멈추지 않고 곡선으로 비켜감 (이 시간 뒤 직진, 약 30도 - make -C Tools drive) */
+#define AVOID_ARC_MS        500
+
+#endif /* __TUNE_INDOOR_H */
@@ -1,26 +1,46 @@
 /**
  * @file buzzer.h
- * @brief 논블로킹 부저 드라이버 헤더
+ * @brief 부저 톤 드라이버 헤더 - TIM4 인터럽트로 음높이/길이 재생 (메인 루프 폴링 없음)
  */
 
 #ifndef __BUZZER_H
 #define __BUZZER_H
 
-#include <stdint.h>
+#include "stm32f1xx_hal.h"
+
+/*
+ * 음 하나 = uint16_t: [15:12] 길이 등급, [11:0] 주파수 Hz (0 = 쉼표)
+ * 길이(ms) = whole_ms * BUZZER_DUR_UNITS[등급] / BUZZER_DUR_WHOLE
+ * 데이터는 Tools/melody/melodyc가 RTTTL/MIDI에서 생성 (buzzer_songs.c)
+ */
+#define BUZZER_DUR_SHIFT    12
+#define BUZZER_FREQ_MASK    0x0FFF
+#define BUZZER_PACK(cls, hz)    ((uint16_t)(((cls) << BUZZER_DUR_SHIFT) | ((hz) & BUZZER_FREQ_MASK)))
+
+/* 길이 등급 → 1/192 온음표 단위 (32분 … 온음표 2개, 점음표/셋잇단 포함) */
+#define BUZZER_DUR_WHOLE    192
+#define BUZZER_DUR_UNITS    { 3, 6, 9, 12, 16, 18, 24, 32, 36, 48, 72, 96, 144, 192, 288, 384 }
 
 typedef struct {
-    uint16_t on_ms;
-    uint16_t off_ms;
-} BuzzerNote_t;
+    const uint16_t *notes;
+    uint16_t count;
+    uint16_t whole_ms;      // 온음표 길이 (템포)
+    uint16_t gap_ms;        // 소리 음 끝의 무음 (같은 음 연속 구분)
+} BuzzerSong_t;
 
+#define BUZZER_FREQ_MAX     4095    // 12비트
+
+void Buzzer_Init(TIM_HandleTypeDef *htim);          // 1MHz 타이머 (MX_TIM4_Init)
 void Buzzer_On(void);
 void Buzzer_Off(void);
-void Buzzer_PlayMelody(const BuzzerNote_t *melody, uint8_t length);
+void Buzzer_PlaySong(const BuzzerSong_t *song);
 void Buzzer_PlayElise(void);
 void Buzzer_PlayAlert(void);
 void Buzzer_PlayMario(void);
 void Buzzer_Stop(void);
-void Buzzer_Update(void);
 uint8_t Buzzer_IsPlaying(void);
 
+/* TIM4 업데이트 인터럽트에서 호출 (HAL_TIM_PeriodElapsedCallback) */
+void Buzzer_OnTimer(void);
+
 #endif /* __BUZZER_H */
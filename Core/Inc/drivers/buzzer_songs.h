@@ -0,0 +1,17 @@
+/**
+ * @file buzzer_songs.h
+ * @brief 부저 곡 목록
+ *
+ * 자동 생성 파일 - 직접 수정하지 말 것 (make -C Tools melodies)
+ */
+
+#ifndef __BUZZER_SONGS_H
+#define __BUZZER_SONGS_H
+
+#include "drivers/buzzer.h"
+
+extern const BuzzerSong_t song_alert;
+extern const BuzzerSong_t song_elise;
+extern const BuzzerSong_t song_mario;
+
+#endif /* __BUZZER_SONGS_H */
@@ -0,0 +1,29 @@
+/**
+ * @file encoder.h
+ * @brief 바퀴 엔코더 (슬롯 원판 + 광 인터럽터, 1채널) - 에지 카운트 + 속도 추정
+ *
+ * 채널이 하나라 방향은 알 수 없음 - 에지 때의 모터 출력 부호를 씀
+ * (모터가 멈춘 뒤 관성으로 도는 동안은 마지막 방향).
+ */
+
+#ifndef __ENCODER_H
+#define __ENCODER_H
+
+#include "stm32f1xx_hal.h"
+#include "robot_config.h"
+#include "drivers/motor.h"
+
+#define ENCODER_SIDE            MOTOR_SIDE_LEFT     // 원판이 달린 쪽 (ENC_L)
+#define ENCODER_EDGES_PER_REV   (ENCODER_SLOTS * 2)
+#define ENCODER_UM_PER_EDGE     ((WHEEL_DIAMETER_MM * 3142UL) / ENCODER_EDGES_PER_REV)   // 에지당 이동 (um)
+#define ENCODER_STALL_US        200000U     // 이 시간 동안 에지가 없으면 속도 0
+
+void    Encoder_Init(void);
+int32_t Encoder_Edges(void);            // 누적 에지 (부호 = 방향)
+int32_t Encoder_PositionUm(void);       // 누적 이동 (um, 에지 단위)
+int16_t Encoder_SpeedMmS(void);         // 속도 추정 (mm/s, 부호 = 방향)
+
+/* EXTI 인터럽트에서 호출 (HAL_GPIO_EXTI_Callback) */
+void    Encoder_OnEdge(void);
+
+#endif /* __ENCODER_H */
@@ -0,0 +1,38 @@
+/**
+ * @file eye_sprites.h
+ * @brief 눈 표정 RLE span 스프라이트 헤더
+ *
+ * 데이터(eye_sprites.c)는 Tools/eyegen이 eyes.c의 도형 그리기 결과를
+ * 렌더링해서 생성함. 직접 수정하지 말고 `make -C Tools sprites`로 갱신.
+ */
+
+#ifndef __EYE_SPRITES_H
+#define __EYE_SPRITES_H
+
+#include <stdint.h>
+#include "eyes.h"
+
+/* ===== 스프라이트 박스 (eyes.c 눈 영역과 동일해야 함) ===== */
+#define EYE_SPRITE_W    50
+#define EYE_SPRITE_H    60
+#define EYE_SPRITE_Y    10      // 박스 위쪽 y
+#define EYE_SPRITE_LX   15      // 왼쪽 눈 박스 x
+#define EYE_SPRITE_RX   95      // 오른쪽 눈 박스 x
+
+/*
+ * 행 데이터 형식: 행마다 [span 개수 n] [x0, len] x n  (x0는 박스 기준)
+ * y0 이전 행과 y0 + h 이후 행은 전부 배경색
+ */
+typedef struct {
+    const uint8_t *rows;    // 행별 span 데이터
+    uint8_t y0;             // 첫 번째 그려진 행
+    uint8_t h;              // 그려진 행 수
+} EyeSprite_t;
+
+/* [표정][0 = 왼쪽 눈, 1 = 오른쪽 눈] */
+extern const EyeSprite_t eye_sprites[EXPR_COUNT][2];
+
+/* span 데이터 + 디스크립터 총 바이트 (플래시 사용량) */
+extern const uint32_t eye_sprites_size;
+
+#endif /* __EYE_SPRITES_H */
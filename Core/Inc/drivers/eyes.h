@@ -18,13 +18,43 @@ typedef enum {
     EXPR_SAD,           // 슬픔
     EXPR_LOOK_LEFT,     // 왼쪽 보기
     EXPR_LOOK_RIGHT,    // 오른쪽 보기
+    EXPR_COUNT          // 표정 개수 (스프라이트 테이블 크기)
 } Expression_t;
 
-/* ===== API ===== */
-void Eyes_Draw(Expression_t expr);          // 강제 그리기
-void Eyes_SetExpression(Expression_t expr); // 표정 설정 (lazy)
-Expression_t Eyes_GetExpression(void);      // 현재 표정 반환
-void Eyes_Update(void);                     // dirty 시에만 그리기
-void Eyes_Invalidate(void);                 // 강제 갱신 플래그
+/* ===== 그리기 방식 선택 =====
+ * 1: Tools/eyegen이 만든 RLE span 스프라이트 (eye_sprites.c) 블릿
+ * 0: 런타임 도형 그리기 (기존 방식)
+ */
+#ifndef EYES_USE_SPRITES
+#define EYES_USE_SPRITES 1
+#endif
+
+/* ===== 틱당 그리기 예산 =====
+ * Eyes_Update() 한 번에 SPI로 보내는 최대 바이트 (윈도우 설정 포함).
+ * SPI2 8MHz 기준 1바이트 ≈ 1us 이므로 3072 ≈ 3ms + HAL 호출 오버헤드.
+ * 남은 행은 다음 틱에 이어서 보냄.
+ */
+#ifndef EYES_TICK_BUDGET
+#define EYES_TICK_BUDGET 3072
+#endif
+
+/* ===== API =====
+ * 스프라이트 모드에서 SetExpression/Blink는 바로 그리지 않고 트윈을 시작함.
+ * Eyes_Update() 한 번이 한 프레임 (UI 틱 50ms 기준 전환 약 200ms)이며
+ * 이전 프레임과 달라진 행만 패널로 보냄. 예산을 넘는 프레임은 다음 틱에
+ * 이어서 보내고, 다 보낼 때까지 다음 프레임으로 넘어가지 않음.
+ */
+void Eyes_Draw(Expression_t expr);          // 강제 그리기 (트윈 없이 즉시)
+void Eyes_SetExpression(Expression_t expr); // 표정 설정 (다음 Update부터 전환)
+void Eyes_Blink(void);                      // 현재 표정에서 감았다 뜨기
+uint8_t Eyes_IsAnimating(void);             // 전환/깜빡임 진행 중 여부
+Expression_t Eyes_GetExpression(void);      // 현재(목표) 표정 반환
+void Eyes_Update(void);                     // 한 프레임 진행 + 바뀐 행만 그리기 (기본 예산)
+uint8_t Eyes_Service(uint16_t budget_bytes);  // 예산 지정 그리기 (1 = 다 보냄)
+void Eyes_Invalidate(void);                 // 다음 Update에서 눈 영역 전체 다시 그리기
+
+#if !EYES_USE_SPRITES || defined(EYES_KEEP_PROCEDURAL)
+void Eyes_DrawProcedural(Expression_t expr); // 도형 기반 그리기 (생성기/벤치마크용)
+#endif
 
 #endif /* __EYES_H */
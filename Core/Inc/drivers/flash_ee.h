@@ -0,0 +1,41 @@
+/**
+ * @file flash_ee.h
+ * @brief 플래시 페이지 두 장으로 만든 EEPROM 흉내 (16비트 태그 → 16비트 값, 덧붙여 쓰기)
+ *
+ * 값을 바꿀 때마다 지우지 않고 활성 페이지 끝에 (값, 태그) 레코드를 덧붙임 - 같은 태그는
+ * 가장 나중 레코드가 현재 값. 페이지가 차면 태그별 최신 값만 다른 페이지로 옮기고
+ * 예전 페이지를 지움 (페이지당 지우기 = 레코드 약 250개에 한 번 → 두 장이 번갈아 닳음).
+ * 옮기는 도중 전원이 나가도 다음 FlashEE_Init이 페이지 상태 표시로 이어서 끝냄.
+ *
+ * 지우기는 페이지당 약 20ms 동안 CPU를 멈추게 함 (코드가 플래시에 있음) -
+ * 쓰기는 메인 루프에서만.
+ */
+
+#ifndef __FLASH_EE_H
+#define __FLASH_EE_H
+
+#include "stm32f1xx_hal.h"
+
+/* ===== 설정 ===== */
+#ifndef FLASH_EE_BASE
+#define FLASH_EE_BASE       0x0801F800UL    // 마지막 2KB (링커 스크립트에서 FLASH 126K로 비움)
+#endif
+#define FLASH_EE_PAGE_SIZE  0x400UL         // STM32F103RB 페이지 1KB
+#define FLASH_EE_RECORDS    (FLASH_EE_PAGE_SIZE / 4 - 1)   // 페이지 머리 4바이트 제외
+
+typedef enum {
+    FLASH_EE_OK = 0,
+    FLASH_EE_NOT_FOUND,
+    FLASH_EE_BAD_TAG,               // 0x0000 / 0xFFFF는 쓸 수 없음
+    FLASH_EE_ERROR                  // 플래시 프로그램 / 지우기 실패
+} FlashEE_Result_t;
+
+FlashEE_Result_t FlashEE_Init(void);                        // 활성 페이지 찾기 (필요하면 복구 / 포맷)
+FlashEE_Result_t FlashEE_Read(uint16_t tag, uint16_t *value);
+FlashEE_Result_t FlashEE_Write(uint16_t tag, uint16_t value);   // 같은 값이면 쓰지 않음
+FlashEE_Result_t FlashEE_Format(void);                      // 두 페이지 지우기 (모든 태그 삭제)
+
+uint16_t FlashEE_Used(void);        // 활성 페이지 레코드 수 (최대 FLASH_EE_RECORDS)
+uint32_t FlashEE_Erases(void);      // 이번 부팅 이후 페이지 지우기 횟수
+
+#endif /* __FLASH_EE_H */
@@ -0,0 +1,23 @@
+/**
+ * @file fmt.h
+ * @brief 힙을 쓰지 않는 정수 전용 printf / snprintf (newlib printf 대체)
+ *
+ * 지원: %d %u %x %X %s %c %%, 플래그 '-' '0', 폭, 길이 'l'.
+ * 정밀도(.n), 부동소수점, '+' / ' ' / '#' 플래그는 없음 - 모르는 변환은 그대로 출력.
+ * Fmt_Printf는 __io_putchar (main.c, UART)로 한 글자씩, 스택은 수십 바이트.
+ */
+
+#ifndef __FMT_H
+#define __FMT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+typedef void (*Fmt_Put_t)(void *ctx, char c);
+
+/* 반환값은 C99와 같게 잘리기 전 길이 */
+int Fmt_Vformat(Fmt_Put_t put, void *ctx, const char *fmt, va_list ap);
+int Fmt_Printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+int Fmt_Snprintf(char *buf, size_t size, const char *fmt, ...) __attribute__((format(printf, 3, 4)));
+
+#endif /* __FMT_H */
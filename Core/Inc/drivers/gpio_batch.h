@@ -0,0 +1,20 @@
+/**
+ * @file gpio_batch.h
+ * @brief 포트 단위 BSRR 마스크 (여러 핀을 레지스터 쓰기 한 번으로)
+ *
+ * BSRR 한 번 쓰기 = [15:0] 핀 set + [31:16] 핀 reset 을 동시에 반영 (원자적).
+ * 마스크는 robot_config.h / main.h의 (포트, 핀) 정의에서 컴파일 시간에 계산.
+ */
+
+#ifndef __GPIO_BATCH_H
+#define __GPIO_BATCH_H
+
+#include "stm32f1xx_hal.h"
+
+/* pin이 port에 있으면 pin, 아니면 0 */
+#define GPIO_MASK_ON(pin_port, pin, port)   (((pin_port) == (port)) ? (uint32_t)(pin) : 0U)
+
+/* set 핀은 켜고 reset 핀은 끄는 BSRR 값 */
+#define GPIO_BSRR(set, reset)               ((uint32_t)(set) | ((uint32_t)(reset) << 16))
+
+#endif /* __GPIO_BATCH_H */
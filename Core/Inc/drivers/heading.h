@@ -0,0 +1,35 @@
+/**
+ * @file heading.h
+ * @brief 제자리 회전 각도 제어 - 엔코더 피드백 (시간 대신 각도로 회전)
+ *
+ * 위치(각도) P 루프 → 바퀴 속도 목표 → 속도 PID 루프 → Motor_SetSpeed.
+ * 각도 부호: + = Motor_Left 방향 (왼쪽 바퀴 전진, 오른쪽 후진).
+ *
+ * 한계: 엔코더는 왼쪽 바퀴 하나 (PA5). 회전각 = 왼쪽 바퀴 이동 / (유효 트랙 / 2)라서
+ * 오른쪽이 덜 돌거나 (좌우 편차) 바닥에 따라 유효 트랙이 바뀌면 그만큼 실제 각도가 어긋남 -
+ * 펌웨어는 알 수 없음. drivesim: 오른쪽 힘 85%면 180도 명령에 약 167도, 카펫(트랙 +10%) 약 162도.
+ * 좌우가 같으면 엔코더 에지 하나(약 3.9도) 안.
+ */
+
+#ifndef __HEADING_H
+#define __HEADING_H
+
+#include "stm32f1xx_hal.h"
+
+typedef enum {
+    HEADING_IDLE = 0,
+    HEADING_TURNING,
+    HEADING_DONE,           // 허용 오차 안에서 멈춤
+    HEADING_TIMEOUT         // 시간 초과로 멈춤 (바퀴가 막힘 / 엔코더 이상)
+} HeadingStatus_t;
+
+void    Heading_Init(void);
+void    Heading_TurnBy(int16_t deg);
+void    Heading_Abort(void);                // ISR 가능, 모터는 호출한 쪽이 정함
+void    Heading_Update(void);               // 메인 루프에서 매번 호출 (제어 주기는 내부에서 10ms)
+
+HeadingStatus_t Heading_Status(void);
+uint8_t Heading_Busy(void);
+int16_t Heading_TurnedDeg(void);            // 이번 회전에서 돈 각도 (엔코더 추정)
+
+#endif /* __HEADING_H */
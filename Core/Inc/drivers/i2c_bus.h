@@ -0,0 +1,53 @@
+/**
+ * @file i2c_bus.h
+ * @brief I2C1 트랜잭션 큐 (인터럽트 완료, 재시도 제한, 버스 복구)
+ */
+
+#ifndef __I2C_BUS_H
+#define __I2C_BUS_H
+
+#include "stm32f1xx_hal.h"
+
+/* ===== 설정 ===== */
+#define I2CBUS_QUEUE_LEN    4
+#define I2CBUS_MAX_DATA     68      // 전송 하나 최대 바이트 (HD44780 커서 + 16글자)
+#define I2CBUS_MAX_RETRIES  2       // 실패 후 다시 보내는 횟수 (넘으면 버림)
+#define I2CBUS_TIMEOUT_MS   20      // 전송 하나 최대 시간 (68B @100kHz ≈ 6ms)
+#define I2CBUS_MAX_DEVICES  4       // 통계를 따로 모으는 장치 수
+
+typedef enum {
+    I2CBUS_OK = 0,
+    I2CBUS_FULL,                    // 큐가 참 - 다음에 다시 제출
+    I2CBUS_TOO_LONG
+} I2CBus_Result_t;
+
+/* 재시도까지 실패해서 버린 전송 알림 (I2CBus_Poll 문맥에서 호출) */
+typedef void (*I2CBus_FailCb_t)(uint32_t tag);
+
+/* ===== 장치별 통계 ===== */
+typedef struct {
+    uint16_t addr;
+    uint32_t ok;
+    uint32_t nack;                  // 주소/데이터 NACK
+    uint32_t bus_err;               // BERR / ARLO / OVR / BUSY 고착
+    uint32_t timeout;
+    uint32_t retries;
+    uint32_t dropped;               // 재시도 초과로 버림
+    uint32_t lat_last_us;           // 제출 → 완료
+    uint32_t lat_max_us;
+    uint32_t lat_avg_us;            // 지수 평균 (1/8)
+} I2CBus_DevStats_t;
+
+/* ===== API ===== */
+void I2CBus_Init(I2C_HandleTypeDef *hi2c);
+I2CBus_Result_t I2CBus_Submit(uint16_t addr, const uint8_t *data, uint8_t len,
+                              I2CBus_FailCb_t on_fail, uint32_t tag);
+void I2CBus_Poll(void);                         // 메인 루프에서 호출 (재시도/복구/타임아웃)
+uint8_t I2CBus_Idle(void);                      // 큐 비었음
+uint8_t I2CBus_Wait(uint32_t timeout_ms);       // 큐가 빌 때까지 Poll (초기화 전용)
+
+uint8_t I2CBus_DeviceCount(void);
+const I2CBus_DevStats_t *I2CBus_Stats(uint8_t index);
+uint32_t I2CBus_Recoveries(void);
+
+#endif /* __I2C_BUS_H */
@@ -0,0 +1,27 @@
+/**
+ * @file lcd_i2c.h
+ * @brief HD44780 문자 LCD (PCF8574 I2C 백팩) 드라이버 헤더
+ */
+
+#ifndef __LCD_I2C_H
+#define __LCD_I2C_H
+
+#include <stdint.h>
+
+/* ===== 패널 설정 ===== */
+#define LCD_I2C_ADDR        (0x27 << 1)
+#define LCD_I2C_COLS        16
+#define LCD_I2C_ROWS        2
+
+/* ===== API =====
+ * LCD_XY / LCD_PUTS / LCD_CLEAR는 섀도 버퍼에만 쓰고,
+ * LCD_FLUSH가 패널 내용과 비교해서 바뀐 칸만 i2c_bus 큐로 보냄.
+ * I2CBus_Init()이 먼저 호출되어 있어야 함.
+ */
+void LCD_INIT(void);                        // 패널 초기화 (부팅 시 1회, 명령마다 완료 대기)
+void LCD_CLEAR(void);                       // 섀도를 공백으로
+void LCD_XY(char x, char y);                // 섀도 쓰기 위치
+void LCD_PUTS(char *str);                   // 섀도에 문자열 쓰기
+void LCD_FLUSH(void);                       // 바뀐 칸만 전송
+
+#endif /* __LCD_I2C_H */
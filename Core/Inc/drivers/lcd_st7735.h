@@ -19,6 +19,11 @@ void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 void LCD_WriteColorFast(uint16_t color, uint32_t count);
 void LCD_WriteBuffer(uint16_t *buf, uint32_t count);
 
+/* ===== 스트림 전송 (윈도우 하나에 여러 색 run 연속 출력) ===== */
+void LCD_StreamBegin(void);
+void LCD_StreamColor(uint16_t color, uint32_t count);
+void LCD_StreamEnd(void);
+
 /* ===== 색상 매크로 (RGB565) ===== */
 #define RGB565(r, g, b) (((r & 0x1F) << 11) | ((g & 0x3F) << 5) | (b & 0x1F))
 
@@ -0,0 +1,43 @@
+/**
+ * @file lcd_text.h
+ * @brief ST7735 비트맵 폰트 텍스트 (5x7 폰트, 6x8 셀)
+ */
+
+#ifndef __LCD_TEXT_H
+#define __LCD_TEXT_H
+
+#include <stdint.h>
+#include "lcd_st7735.h"
+
+/* ===== 폰트 ===== */
+#define LCD_FONT_W          5       // 글리프 폭 (열 데이터 수)
+#define LCD_FONT_CELL_W     6       // 글자 간격 포함 셀 폭
+#define LCD_FONT_CELL_H     8       // 셀 높이 (8행째는 빈 행)
+#define LCD_FONT_FIRST      0x20
+#define LCD_FONT_LAST       0x7F    // 0x7F 자리는 ° (HD44780의 0xDF도 ° 로 표시)
+
+extern const uint8_t lcd_font5x7[LCD_FONT_LAST - LCD_FONT_FIRST + 1][LCD_FONT_W];
+
+/* ===== 텍스트 필드 =====
+ * 화면에 그려진 글자를 기억해서 바뀐 글자 묶음만 다시 그림
+ */
+#define LCD_TEXT_FIELD_MAX  26      // 160 / 6
+
+typedef struct {
+    uint8_t  x, y;
+    uint8_t  len;                   // 글자 수 (짧은 문자열은 공백으로 채움)
+    uint8_t  valid;                 // shown이 패널 내용과 같음
+    uint16_t fg, bg;
+    char     shown[LCD_TEXT_FIELD_MAX];
+} LCD_TextField_t;
+
+/* ===== API ===== */
+void LCD_DrawText(int16_t x, int16_t y, const char *str, uint8_t n, uint16_t fg, uint16_t bg);
+void LCD_DrawString(int16_t x, int16_t y, const char *str, uint16_t fg, uint16_t bg);
+
+void LCD_TextField_Init(LCD_TextField_t *f, uint8_t x, uint8_t y, uint8_t len,
+                        uint16_t fg, uint16_t bg);
+uint8_t LCD_TextField_Set(LCD_TextField_t *f, const char *str);  // 다시 그린 글자 수
+void LCD_TextField_Invalidate(LCD_TextField_t *f);
+
+#endif /* __LCD_TEXT_H */
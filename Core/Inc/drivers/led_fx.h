@@ -0,0 +1,31 @@
+/**
+ * @file led_fx.h
+ * @brief RGB LED 효과 (단색 / 깜빡임 / 숨쉬기 / 두 색 섞기) - TIM3 1ms 인터럽트에서 진행
+ *
+ * LedFx_Play로 효과를 바꾸면 메인 루프는 LED를 건드리지 않음.
+ */
+
+#ifndef __LED_FX_H
+#define __LED_FX_H
+
+#include "drivers/rgb_led.h"
+
+typedef enum {
+    LED_FX_SOLID = 0,       // a
+    LED_FX_BLINK,           // 주기 앞 절반 a, 뒤 절반 b
+    LED_FX_BREATHE,         // 꺼짐 → a → 꺼짐 (삼각파)
+    LED_FX_FADE             // a → b → a (두 색 섞기)
+} LedFxType_t;
+
+typedef struct {
+    LedFxType_t type;
+    RgbColor_t  a, b;
+    uint16_t    period_ms;
+} LedFx_t;
+
+void LedFx_Play(const LedFx_t *fx);         // 처음 위상부터 (ISR 가능, 같은 효과면 그대로)
+
+/* TIM3 업데이트 인터럽트에서 호출 (1ms) */
+void LedFx_OnTick(void);
+
+#endif /* __LED_FX_H */
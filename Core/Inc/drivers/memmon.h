@@ -0,0 +1,47 @@
+/**
+ * @file memmon.h
+ * @brief RAM 사용량 감시 - 스택 최고 수위(칠해두고 찾기) + 힙(_sbrk) 사용량
+ *
+ * RAM 배치 (링커 스크립트):  [.data .bss][힙 →        ← 스택]  _estack = RAM 끝
+ * 부팅 때 힙 끝 ~ 지금 SP 사이를 MEMMON_PAINT로 칠하고, 나중에 아래에서부터
+ * 처음으로 칠이 지워진 워드를 찾으면 그 위가 스택이 한 번이라도 닿은 곳.
+ * 스캔은 MemMon_Poll에서 MEMMON_SCAN_MS마다 (빈 구간 워드 수만큼, 10KB ≈ 수십 us).
+ *
+ * 힙은 sysmem.c의 _sbrk가 끝 / 최고 / 실패 횟수를 기록 - 출력은 fmt.c라 malloc을 쓰는 곳이 없어서
+ * 0이 정상 (newlib printf / stdio를 다시 쓰면 stdout 버퍼가 여기로 잡힘).
+ */
+
+#ifndef __MEMMON_H
+#define __MEMMON_H
+
+#include <stdint.h>
+
+/* ===== 설정 ===== */
+#define MEMMON_PAINT        0xC5C5C5C5UL
+#define MEMMON_SCAN_MS      100
+#define MEMMON_SP_MARGIN    64      // 칠할 때 지금 SP 아래로 남겨두는 바이트
+#define MEMMON_REPORT_STEP  32      // 스택 최고 수위가 이만큼 늘면 MemMon_Poll이 1
+
+typedef struct {
+    uint32_t ram;                   // RAM 전체
+    uint32_t static_used;           // .data + .ramfunc + .bss
+    uint32_t ramfunc;               // 그중 SRAM 코드 (RAMFUNC)
+    uint32_t heap_used;             // 지금 _sbrk 끝 - _end
+    uint32_t heap_peak;
+    uint32_t heap_fails;            // _sbrk ENOMEM
+    uint32_t stack_reserved;        // _Min_Stack_Size (힙이 넘지 않는 선)
+    uint32_t stack_peak;            // 최고 수위 (_estack - 칠이 지워진 가장 낮은 주소)
+    uint32_t headroom;              // 힙 최고 ~ 스택 최고 사이 (한 번도 안 쓴 RAM)
+} MemMon_Stats_t;
+
+/* 힙 기록 (sysmem.c) */
+uint8_t *Sysmem_HeapEnd(void);
+uint8_t *Sysmem_HeapPeak(void);
+uint32_t Sysmem_HeapFails(void);
+
+/* ===== API ===== */
+void    MemMon_Init(void);          // main() 맨 앞에서 한 번 (칠하기)
+uint8_t MemMon_Poll(void);          // 메인 루프: 주기 스캔, 최고 수위가 늘었으면 1 (알림용)
+void    MemMon_Get(MemMon_Stats_t *out);    // 바로 스캔해서 채움
+
+#endif /* __MEMMON_H */
@@ -10,18 +10,42 @@ typedef enum {
     MOTOR_BACKWARD
 } MotorDir_t;
 
+/* 바퀴 묶음 */
+typedef enum {
+    MOTOR_SIDE_LEFT = 0,
+    MOTOR_SIDE_RIGHT,
+    MOTOR_SIDE_COUNT
+} MotorSide_t;
+
+#define MOTOR_SPEED_MAX     100     // %
+
 /* 기본 제어 */
-void Motor_Init(void);
+void Motor_Init(TIM_HandleTypeDef *htim);   // PWM 주기 타이머 (MX_TIM3_Init, 1kHz)
 void Motor_Stop(void);
 void Motor_Forward(void);
 void Motor_Backward(void);
 void Motor_Left(void);
 void Motor_Right(void);
 
-/* 회전 */
+/* 속도 제어 (-100 ~ 100 %, 음수 = 후진) - 가감속 램프를 거쳐 반영 */
+void Motor_SetSpeed(int8_t left, int8_t right);
+int8_t Motor_GetSpeed(MotorSide_t side);    // 지금 실제 출력 (램프 중간값)
+uint8_t Motor_IsSettled(void);              // 1 = 목표 속도 도달
+
+/* 곡선 (turn: + = Motor_Left 회전 방향, 0 직진 / 1~49 곡선 / 50 피벗 / 100 제자리 회전) */
+void Motor_Curve(int8_t speed, int8_t turn);
+void Motor_CurveFor(int8_t speed, int8_t turn, uint16_t ms);    // ms 뒤 같은 속도로 직진
+
+/* 곡선 회전 (MOTOR_ARC_TURN) / 피벗 - 이름의 방향은 Motor_Left/Right와 같음 */
 void Motor_TurnLeft_Front(void);
 void Motor_TurnRight_Front(void);
 void Motor_TurnLeft_Back(void);
 void Motor_TurnRight_Back(void);
+void Motor_PivotLeft(void);
+void Motor_PivotRight(void);
+
+/* TIM3 인터럽트에서 호출 (HAL_TIM_PeriodElapsedCallback / HAL_TIM_OC_DelayElapsedCallback) */
+void Motor_OnPeriod(void);
+void Motor_OnCompare(MotorSide_t side);
 
 #endif
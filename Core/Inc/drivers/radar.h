@@ -0,0 +1,36 @@
+/**
+ * @file radar.h
+ * @brief 초음파 스캔 레이더 화면 (ST7735)
+ */
+
+#ifndef __RADAR_H
+#define __RADAR_H
+
+#include <stdint.h>
+
+/* ===== 화면 배치 ===== */
+#define RADAR_OX            80      // 원점 (로봇 위치) - 화면 아래 가운데
+#define RADAR_OY            79
+#define RADAR_R             76      // 최대 거리 반지름 (px)
+#define RADAR_RANGE_CM      100     // RADAR_R에 대응하는 거리
+#define RADAR_RING_CM       25      // 거리 눈금 간격
+
+/* ===== 잔상 =====
+ * 샘플이 들어올 때마다 다른 방향 점의 나이가 1 증가.
+ * RADAR_FADE_STEP 샘플마다 한 단계 어두워지고 RADAR_FADE_LEVELS 단계가 지나면 지워짐.
+ */
+#define RADAR_FADE_STEP     6
+#define RADAR_FADE_LEVELS   4
+
+/* ===== 틱당 그리기 예산 (바이트, eyes.h의 EYES_TICK_BUDGET과 같은 단위) ===== */
+#ifndef RADAR_TICK_BUDGET
+#define RADAR_TICK_BUDGET   3072
+#endif
+
+/* ===== API ===== */
+void Radar_Enter(void);                             // 레이더 화면 시작 (배경을 틱마다 나눠 그림)
+void Radar_Leave(void);                             // 화면을 검게 지우기 시작
+void Radar_AddSample(uint8_t angle, uint16_t dist_cm); // 스캔 샘플 1개 (그리기는 Update에서)
+uint8_t Radar_Update(uint16_t budget_bytes);        // 예산 안에서 그리기 (1 = 다 그림)
+
+#endif /* __RADAR_H */
@@ -0,0 +1,27 @@
+/**
+ * @file ramfunc.h
+ * @brief RAMFUNC - 함수를 SRAM에서 실행 (링커 스크립트 .ramfunc, 시작 코드가 플래시에서 복사)
+ *
+ * 64MHz에서 플래시는 대기 2클럭 (FLASH_LATENCY_2) - 프리페치가 직선 코드는 감추지만
+ * 짧은 루프의 분기마다 다시 기다림. SRAM은 대기 없음 (대신 같은 버스로 데이터도 읽어서
+ * 메모리를 많이 읽는 루프는 이득이 줄어듦). 함수 크기만큼 RAM을 씀 - 'p' 명령 / make ramfunc-report.
+ *
+ * 플래시 ↔ SRAM 호출은 BL 거리(16MB)를 넘으므로 링커가 veneer를 넣음 (호출당 몇 클럭).
+ * noinline: 플래시 쪽 호출자에 인라인되면 SRAM에 올린 의미가 없음.
+ * -DRAMFUNC_ENABLE=0으로 빌드하면 모두 플래시 (비교용). 호스트(Tools)에서는 항상 빈 매크로.
+ */
+
+#ifndef __RAMFUNC_H
+#define __RAMFUNC_H
+
+#ifndef RAMFUNC_ENABLE
+#define RAMFUNC_ENABLE      1
+#endif
+
+#if RAMFUNC_ENABLE && defined(__arm__)
+#define RAMFUNC             __attribute__((section(".ramfunc"), noinline))
+#else
+#define RAMFUNC
+#endif
+
+#endif /* __RAMFUNC_H */
@@ -3,9 +3,21 @@
 
 #include "main.h"
 
+/* 색 (채널당 0~255, 밝기 단계 - 듀티는 감마 2로 변환) */
+typedef struct {
+    uint8_t r, g, b;
+} RgbColor_t;
+
+#define RGB(r_, g_, b_)     ((RgbColor_t){ (r_), (g_), (b_) })
+
 /* RGB LED 함수 선언 */
-void RGB_Init(void);
-void RGB_Set(int color);    // ★ int 타입으로 선언!
+void RGB_Init(TIM_HandleTypeDef *htim);     // 모터와 같은 TIM3 (1kHz) CH3 비교 사용
+void RGB_SetColor(RgbColor_t c);            // 다음 PWM 주기부터 반영 (ISR 가능)
+void RGB_Set(int color);    // ★ int 타입으로 선언! (RGB_COLOR_* = 채널 켜기/끄기 조합)
 void RGB_Off(void);
 
+/* TIM3 인터럽트에서 호출 (업데이트 / CC3) */
+void RGB_OnPeriod(void);
+void RGB_OnCompare(void);
+
 #endif /* __RGB_LED_H */
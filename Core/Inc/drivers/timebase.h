@@ -0,0 +1,26 @@
+/**
+ * @file timebase.h
+ * @brief 1us 해상도 32비트 자유 진행 타임스탬프 (TIM1 + 오버플로 확장)
+ *
+ * 모든 드라이버가 같은 시계를 읽기만 함 (카운터를 리셋하지 않음).
+ * 32비트 us는 약 71분마다 한 바퀴 - 경과/마감 비교는 뺄셈으로 하므로 넘어가도 안전
+ * (마감은 35분 이내만).
+ */
+
+#ifndef __TIMEBASE_H
+#define __TIMEBASE_H
+
+#include "stm32f1xx_hal.h"
+
+/* ===== API ===== */
+void     Timebase_Init(TIM_HandleTypeDef *htim);   // 1MHz, 주기 65536 타이머 (MX_TIM1_Init)
+uint32_t Timebase_Us(void);                         // 현재 시각 (us), ISR에서도 호출 가능
+uint32_t Timebase_Elapsed(uint32_t since_us);       // since_us 이후 지난 시간
+void     Timebase_DelayUs(uint32_t us);             // 최소 us만큼 바쁜 대기
+uint32_t Timebase_Deadline(uint32_t after_us);      // 지금 + after_us
+uint8_t  Timebase_Expired(uint32_t deadline_us);    // 1 = 마감 지남
+
+/* TIM1 업데이트 인터럽트에서 호출 (HAL_TIM_PeriodElapsedCallback) */
+void     Timebase_OnOverflow(void);
+
+#endif /* __TIMEBASE_H */
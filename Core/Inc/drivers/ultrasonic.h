@@ -3,10 +3,13 @@
 
 #include "stm32f1xx_hal.h"
 
-/* 초기화 (타이머 핸들 전달) */
-void Ultrasonic_Init(TIM_HandleTypeDef *htim);
+/* 초기화 (시간 측정은 drivers/timebase.h 공용 시계) */
+void Ultrasonic_Init(void);
 
 /* 거리 반환 (cm) */
 uint16_t Ultrasonic_GetDistance(void);
 
+/* 'p' 벤치마크: ECHO 대기 루프를 timeout_us 동안 돈 바퀴 수 (한 바퀴 = 에지 해상도) */
+uint32_t Ultrasonic_EchoPolls(uint32_t timeout_us);
+
 #endif
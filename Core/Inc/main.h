@@ -56,12 +56,16 @@ void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
-/* 함수 선언 추가 - RGB LED 관련 */
-void Set_LED_By_State(RobotState_t state);
 
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
+#define TIMEBASE_TIM_PSC 63
+#define SERVO_TIM_PSC 1279
+#define SERVO_TIM_ARR 999
+#define MOTOR_TIM_PSC 63
+#define MOTOR_TIM_ARR 999
+#define BUZZER_TIM_PSC 63
 #define BUZZER_Pin GPIO_PIN_13
 #define BUZZER_GPIO_Port GPIOC
 #define TRIG_Pin GPIO_PIN_0
@@ -72,6 +76,9 @@ void Set_LED_By_State(RobotState_t state);
 #define USART_TX_GPIO_Port GPIOA
 #define USART_RX_Pin GPIO_PIN_3
 #define USART_RX_GPIO_Port GPIOA
+#define ENC_L_Pin GPIO_PIN_5
+#define ENC_L_GPIO_Port GPIOA
+#define ENC_L_EXTI_IRQn EXTI9_5_IRQn
 #define RED_Pin GPIO_PIN_5
 #define RED_GPIO_Port GPIOC
 #define LBB_Pin GPIO_PIN_10
@@ -0,0 +1,61 @@
+/**
+ * @file param.h
+ * @brief 실행 중 바꿀 수 있는 튜닝 파라미터 - UART로 읽기/쓰기, 플래시(flash_ee)에 저장
+ *
+ * 기본값은 robot_config.h 튜닝 프로파일. 부팅 때 플래시에 저장한 값이 있으면 덮어씀.
+ * 읽기는 배열 인덱스 하나 (Param_Get) - 루프/틱 안에서 그대로 써도 됨.
+ *
+ * UART (':'로 시작하는 줄, 한 글자 명령과 겹치지 않음):
+ *   :list             전체 (값, 범위, 기본값)
+ *   :get <이름>
+ *   :set <이름> <값>  바로 반영 (저장은 따로)
+ *   :save             바뀐 값만 플래시에 덧붙임 (IDLE에서만 - 지우기가 CPU를 멈춤)
+ *   :defaults         기본값으로 (저장은 따로)
+ * 줄 중간에 2초 넘게 끊기면 그 줄은 버림 - 다음 바이트는 다시 한 글자 명령 (x = 정지).
+ */
+
+#ifndef __PARAM_H
+#define __PARAM_H
+
+#include <stdint.h>
+
+typedef enum {
+    PARAM_SCAN_STEP = 0,            // 스캔 간격 (도)
+    PARAM_SCAN_PERIOD_MS,           // 스캔 한 걸음 주기
+    PARAM_SCAN_MIN,                 // 스캔 범위 (서보 각도)
+    PARAM_SCAN_MAX,
+    PARAM_DIST_SAFE,                // 이보다 멀면 직진 (cm)
+    PARAM_DIST_WARNING,             // 이보다 멀면 곡선 회피, 가까우면 제자리 회전 (cm)
+    PARAM_AVOID_TURN_DEG,
+    PARAM_AVOID_ARC_MS,
+    PARAM_CRUISE_SPEED,             // 자율 주행 직진 / 곡선 속도 (%)
+    PARAM_COUNT
+} ParamId_t;
+
+typedef enum {
+    PARAM_OK = 0,
+    PARAM_UNKNOWN,
+    PARAM_RANGE,                    // 이 파라미터 범위 밖
+    PARAM_NUMBER,                   // 값이 10진수가 아님
+    PARAM_CONFLICT,                 // 다른 파라미터와 관계가 깨짐 (MIN < MAX, WARNING < SAFE)
+    PARAM_FLASH                     // 저장 실패
+} ParamResult_t;
+
+extern uint16_t param_val[PARAM_COUNT];
+
+static inline uint16_t Param_Get(ParamId_t id)
+{
+    return param_val[id];
+}
+
+void          Param_Init(void);                     // 기본값 + 플래시 값 (FlashEE_Init 포함)
+ParamResult_t Param_Set(ParamId_t id, uint16_t value);
+ParamResult_t Param_Save(void);
+void          Param_Defaults(void);
+const char   *Param_Name(ParamId_t id);
+
+/* UART */
+uint8_t Param_RxChar(uint8_t c);    // 수신 ISR: 명령 줄 글자면 1 (한 글자 명령으로 넘기지 않음)
+void    Param_Poll(void);           // 메인 루프: 받은 줄 처리
+
+#endif /* __PARAM_H */
@@ -0,0 +1,69 @@
+/**
+ * @file reclog.h
+ * @brief 주행 기록 - 초음파 거리, UART 수신 바이트, 엔코더 에지, 상태 전이를 HAL tick과 함께 이진 로그로
+ *
+ * 현장에서 이상하게 움직인 주행을 PC에서 그대로 다시 돌리려고 (Tools/replay).
+ * RAM 모드는 버퍼가 차면 멈춤 ('l'로 꺼냄), 스트림 모드는 메인 루프에서 조금씩 UART로 내보냄.
+ * 어느 쪽이든 UART에는 "REC <hex>" 줄 - 다른 출력 사이에 섞여도 호스트가 골라냄.
+ *
+ * 형식 (리틀 엔디언):
+ *   머리  'R' 'L' 버전 파라미터수 | 시작 tick (4) | 상태 | 플래그 (bit0 start_flag, bit1 manual_mode)
+ *         | 파라미터 값 (2 x 파라미터수)
+ *   사건  첫 바이트 = 종류 << 5 | 앞 사건과의 tick 차 (0~30, 31 = 뒤에 varint)
+ *         뒤에 종류별 값: DIST / DIST_UI = varint cm, RX = 바이트, STATE = 상태, LOST = varint 개수, EDGE = 없음
+ *   varint = 7비트씩, 낮은 쪽부터 (bit7 = 뒤에 더 있음)
+ *
+ * UART:  c = RAM 기록 다시 시작,  o = 스트림 기록 시작,  l = RAM 기록 꺼내기
+ */
+
+#ifndef __RECLOG_H
+#define __RECLOG_H
+
+#include <stdint.h>
+
+#define RECLOG_MAGIC0       'R'
+#define RECLOG_MAGIC1       'L'
+#define RECLOG_VERSION      1
+#define RECLOG_HDR_FIXED    10          // 파라미터 값 앞까지
+
+#ifndef RECLOG_RAM_SIZE
+#define RECLOG_RAM_SIZE     2048        // 주행 중 약 100 B/s → 20초 정도
+#endif
+#define RECLOG_STREAM_SIZE  256         // 스트림 모드 대기열
+
+typedef enum {
+    RECLOG_OFF = 0,
+    RECLOG_RAM,
+    RECLOG_STREAM
+} RecLog_Mode_t;
+
+#ifndef RECLOG_BOOT_MODE
+#define RECLOG_BOOT_MODE    RECLOG_RAM  // 부팅부터 기록 (main.c)
+#endif
+
+typedef enum {
+    RECLOG_DIST = 0,                    // 상태 머신이 쓴 거리 (SCAN)
+    RECLOG_DIST_UI,                     // 화면용 측정 (ui_fsm.c) - 로직에는 안 들어감
+    RECLOG_RX,
+    RECLOG_EDGE,
+    RECLOG_STATE,
+    RECLOG_LOST                         // 스트림 대기열이 넘쳐 버린 사건 수
+} RecLog_Type_t;
+
+void     RecLog_Start(RecLog_Mode_t mode);     // 머리 (지금 상태 / 파라미터) 쓰고 시작
+void     RecLog_Stop(void);
+RecLog_Mode_t RecLog_Mode(void);
+
+/* 사건 - ISR에서도 부름 (인터럽트 잠깐 막음) */
+void     RecLog_Dist(RecLog_Type_t type, uint16_t cm);
+void     RecLog_Rx(uint8_t c);
+void     RecLog_Edge(void);
+void     RecLog_State(uint8_t state);
+
+void     RecLog_RequestDump(void);             // UART ISR: 다음 RecLog_Poll부터 한 번에 한 줄씩 꺼냄
+void     RecLog_Poll(void);                    // 메인 루프: 스트림 내보내기 / 꺼내기 요청
+
+uint32_t RecLog_Data(const uint8_t **buf);     // RAM 기록 (호스트 도구용), 길이
+uint16_t RecLog_Lost(void);
+
+#endif /* __RECLOG_H */
@@ -0,0 +1,13 @@
+/**
+ * @file robot_behavior.h
+ * @brief 자율 주행 동작 - 상태별 진입/퇴장/틱 처리와 가드 전이 표 (robot_state 엔진에 등록)
+ */
+
+#ifndef ROBOT_BEHAVIOR_H
+#define ROBOT_BEHAVIOR_H
+
+#include "robot_state.h"
+
+void Behavior_Init(void);   // RobotState_Init(상태 표) - 시작 상태 IDLE
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * @file robot_command.h
+ * @brief UART 한 글자 주행 명령 - 자율 시작/정지, 수동 조종, 서보 가운데
+ *
+ *   t 자율 시작 (SCAN)   x 정지 (IDLE)
+ *   w 전진  s 후진  a 왼쪽  d 오른쪽   (수동)
+ *   r 서보 가운데
+ *
+ * 진단 / 화면 명령(i, f, m, p, v)은 main.c Handle_Command.
+ */
+
+#ifndef __ROBOT_COMMAND_H
+#define __ROBOT_COMMAND_H
+
+#include <stdint.h>
+
+extern uint8_t start_flag;          // 1 = 자율 주행 (RobotState_Run 틱)
+extern uint8_t manual_mode;
+extern uint8_t manual_command;      // 마지막 수동 명령 (ui_fsm.c 화면용, 0 = 없음)
+
+uint8_t RobotCommand_Handle(uint8_t cmd);   // 주행 명령이면 처리하고 1 (UART 수신 ISR)
+
+#endif /* __ROBOT_COMMAND_H */
@@ -1,10 +1,53 @@
+/**
+ * @file robot_config.h
+ * @brief 로봇 설정 한 곳 - 보드 핀맵 + 하드웨어 / 튜닝 프로파일 + 컴파일 타임 검사
+ *
+ * 프로파일은 빌드 옵션으로 고름 (코드 수정 없음, 전부 상수라 실행 비용 없음):
+ *   -DROBOT_HW=ROBOT_HW_4WD (기본) | ROBOT_HW_2WD
+ *   -DROBOT_TUNE=ROBOT_TUNE_INDOOR (기본) | ROBOT_TUNE_CAUTIOUS
+ * 범위 / 타이머 클럭 / 핀 중복이 맞지 않으면 config/config_check.h가 빌드를 멈춤.
+ */
+
 #ifndef ROBOT_CONFIG_H
 #define ROBOT_CONFIG_H
 
-#include "main.h"   // CubeMX 핀 정의 사용
+#include "main.h"   // CubeMX 핀 정의 / 타이머 상수 사용
+
+/* =====================================================
+ * Profile Selection
+ * ===================================================== */
+#define ROBOT_HW_4WD            1
+#define ROBOT_HW_2WD            2
+
+#define ROBOT_TUNE_INDOOR       1
+#define ROBOT_TUNE_CAUTIOUS     2
+
+#ifndef ROBOT_HW
+#define ROBOT_HW                ROBOT_HW_4WD
+#endif
+
+#ifndef ROBOT_TUNE
+#define ROBOT_TUNE              ROBOT_TUNE_INDOOR
+#endif
+
+#if ROBOT_HW == ROBOT_HW_4WD
+#include "config/hw_4wd.h"
+#elif ROBOT_HW == ROBOT_HW_2WD
+#include "config/hw_2wd.h"
+#else
+#error "ROBOT_HW: 알 수 없는 하드웨어 프로파일"
+#endif
+
+#if ROBOT_TUNE == ROBOT_TUNE_INDOOR
+#include "config/tune_indoor.h"
+#elif ROBOT_TUNE == ROBOT_TUNE_CAUTIOUS
+#include "config/tune_cautious.h"
+#else
+#error "ROBOT_TUNE: 알 수 없는 튜닝 프로파일"
+#endif
 
 /* =====================================================
- * Robot Hardware Logical Mapping
+ * Robot Hardware Logical Mapping (보드 - 프로파일과 무관)
  * ===================================================== */
 
 /* ===============================
@@ -36,6 +79,13 @@
 #define MOTOR_LBB_PIN    LBB_Pin
 
 
+/* ===============================
+ * Wheel Encoder (PA5 EXTI, 왼쪽 앞바퀴 슬롯 원판)
+ * =============================== */
+#define ENCODER_PORT        ENC_L_GPIO_Port
+#define ENCODER_PIN         ENC_L_Pin
+
+
 /* ===============================
  * Ultrasonic Sensor
  * =============================== */
@@ -46,12 +96,10 @@
 
 
 /* ===============================
- * Servo
+ * Servo (TIM2 CH1 부분 재배치 - PA15)
  * =============================== */
-#define SERVO_CENTER_ANGLE  90
-#define SERVO_MIN_ANGLE     30
-#define SERVO_MAX_ANGLE     150
-#define SERVO_STEP_ANGLE    10
+#define SERVO_PWM_PORT      GPIOA
+#define SERVO_PWM_PIN       GPIO_PIN_15
 
 
 /* ===============================
@@ -62,10 +110,36 @@
 
 
 /* ===============================
- * Distance Threshold (cm)
+ * RGB LED / LCD / I2C / UART (검사용 - 드라이버는 main.h 이름을 바로 씀)
  * =============================== */
-#define DIST_SAFE        40
-#define DIST_WARNING     20
-#define DIST_DANGER      10
+#define LCD_CS_PORT         GPIOB_GPIO_Port
+#define LCD_CS_PIN          GPIOB_Pin
+#define LCD_DC_PORT         GPIOA_GPIO_Port
+#define LCD_DC_PIN          GPIOA_Pin
+#define LCD_RES_PORT        GPIOD_GPIO_Port
+#define LCD_RES_PIN         GPIOD_Pin
+#define LCD_SPI_PORT        GPIOB
+#define LCD_SPI_PINS        (GPIO_PIN_13 | GPIO_PIN_14 | GPIO_PIN_15)   // SPI2 SCK/MISO/MOSI
+#define I2C_BUS_PORT        GPIOB
+#define I2C_BUS_PINS        (GPIO_PIN_6 | GPIO_PIN_7)                   // I2C1 SCL/SDA
+
+
+/* =====================================================
+ * Timers (CubeMX 사용자 상수 - main.h)
+ * ===================================================== */
+#define ROBOT_TIMCLK_HZ     64000000U   // HSI/2 x 16, APB1 /2 → 타이머 x2 = APB2와 같음
+
+#define TIMEBASE_TICK_HZ    (ROBOT_TIMCLK_HZ / (TIMEBASE_TIM_PSC + 1))
+#define MOTOR_TICK_HZ       (ROBOT_TIMCLK_HZ / (MOTOR_TIM_PSC + 1))
+#define MOTOR_PWM_PERIOD_US (MOTOR_TIM_ARR + 1)                         // TIM3 주기 = 1ms 틱
+#define BUZZER_TICK_HZ      (ROBOT_TIMCLK_HZ / (BUZZER_TIM_PSC + 1))
+#define SERVO_TICK_US       ((SERVO_TIM_PSC + 1) / (ROBOT_TIMCLK_HZ / 1000000U))
+#define SERVO_FRAME_US      ((SERVO_TIM_ARR + 1) * SERVO_TICK_US)
+
+/* 서보 비교값 (TIM2 틱) - 각도 → 펄스는 servo.c */
+#define SERVO_CCR_MIN       (SERVO_PULSE_MIN_US / SERVO_TICK_US)
+#define SERVO_CCR_MAX       (SERVO_PULSE_MAX_US / SERVO_TICK_US)
+
+#include "config/config_check.h"
 
 #endif /* ROBOT_CONFIG_H */
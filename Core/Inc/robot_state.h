@@ -1,7 +1,18 @@
+/**
+ * @file robot_state.h
+ * @brief 로봇 상태 머신 엔진 - 상태 표 (진입/퇴장/틱 + 가드 전이) 와 전이 기록
+ *
+ * 상태 번호가 곧 표 인덱스라 디스패치는 O(1).
+ * 상위 상태(parent)를 두면 전이 때 공통 조상까지만 퇴장/진입하고,
+ * 가드 전이는 현재 상태 → 상위 상태 순서로 찾음 (상위 상태로 직접 전이하지 않음).
+ * 동작(표 내용)은 robot_behavior.c.
+ */
 
 #ifndef ROBOT_STATE_H
 #define ROBOT_STATE_H
 
+#include <stdint.h>
+
 typedef enum
 {
     STATE_IDLE,
@@ -9,11 +20,51 @@ typedef enum
     STATE_DECIDE,
     STATE_MOVE,
     STATE_REVERSE,
-    STATE_ALERT
+    STATE_ALERT,
+    STATE_AUTO,             // 상위 상태 - SCAN / DECIDE / MOVE / ALERT
+    STATE_COUNT,
+    STATE_NONE = 0xFF       // 상위 상태 없음 / 요청 없음
 } RobotState_t;
 
+typedef void (*RobotState_Listener_t)(RobotState_t state);
+
+/* ===== 상태 표 ===== */
+typedef struct {
+    uint8_t (*guard)(void);         // NULL = 항상
+    RobotState_t to;
+} RobotTransition_t;
+
+typedef struct {
+    const char *name;
+    RobotState_t parent;            // STATE_NONE = 최상위
+    void (*entry)(void);
+    void (*exit)(void);
+    void (*tick)(void);
+    const uint16_t *tick_ms;        // 틱 주기 (NULL = 매 루프, 진입 직후 첫 틱은 바로) - 파라미터면 바로 반영
+    const RobotTransition_t *trans; // 틱 뒤에 앞에서부터 검사, 처음 참인 것 하나
+    uint8_t n_trans;
+} RobotStateDesc_t;
+
+/* ===== 전이 기록 ===== */
+#define ROBOT_TRACE_LEN     16
+
+typedef struct {
+    uint32_t t_us;                  // Timebase_Us
+    uint8_t  from, to;              // RobotState_t
+} RobotTrace_t;
+
 void Handle_State(RobotState_t state);  // ★ 이 줄 필수
-void RobotState_Init(void);
-void RobotState_Set(RobotState_t state);
+void RobotState_Init(const RobotStateDesc_t *table);   // table[STATE_COUNT]
+void RobotState_Set(RobotState_t state);    // 전이 요청 (ISR 가능, 다음 RobotState_Run에서 처리, 상위 상태는 무시)
 RobotState_t RobotState_Get(void);
+void RobotState_SetListener(RobotState_Listener_t cb);
+
+/* 메인 루프에서 매번 호출 - 요청 처리, tick_enabled면 틱 + 가드 전이 */
+void RobotState_Run(uint8_t tick_enabled);
+
+const char *RobotState_Name(RobotState_t state);
+uint32_t RobotState_ElapsedMs(void);                    // 현재 상태에 들어온 뒤
+uint32_t RobotState_TimeInMs(RobotState_t state);       // 누적 체류 시간 (현재 포함)
+uint16_t RobotState_Entries(RobotState_t state);
+uint8_t  RobotState_Trace(RobotTrace_t *out, uint8_t max);  // 오래된 것부터 복사, 개수 반환
 #endif
@@ -13,7 +13,16 @@ typedef enum {
     UI_ERROR
 } UI_State_t;
 
+/* ===== ST7735 화면 모드 ===== */
+typedef enum {
+    UI_VIEW_EYES = 0,   // 눈 표정
+    UI_VIEW_RADAR       // 스캔 레이더
+} UI_View_t;
+
 void UI_Init(void);
 void UI_Update(void);
+void UI_ToggleView(void);       // 화면 모드 전환 요청 (ISR에서 호출 가능)
+uint8_t UI_EyesVisible(void);   // 눈 애니메이션을 그려도 되는지
+void UI_Invalidate(void);       // 화면을 직접 덮어쓴 뒤 - 다음 Update부터 전체 다시 그림
 
 #endif
@@ -6,6 +6,7 @@
  * 1. LCD_Init 중복 호출 제거
  * 2. 깜빡임 논블로킹 타이머 기반
  * 3. Eyes_Update() 통합으로 중복 드로잉 방지
+ * 4. 깜빡임은 눈꺼풀 트윈 (바뀐 행만 전송)
  */
 
 #include "main.h"
@@ -15,12 +16,9 @@
 
 /* ===== 깜빡임 설정 ===== */
 #define BLINK_INTERVAL_MS   3000    // 깜빡임 주기 (3초)
-#define BLINK_DURATION_MS   150     // 눈 감고 있는 시간
 
 /* ===== 상태 변수 ===== */
 static uint32_t last_blink_time = 0;
-static uint8_t  is_blinking = 0;
-static Expression_t saved_expr = EXPR_NEUTRAL;
 
 /**
  * @brief 애니메이션 초기화
@@ -47,37 +45,22 @@ void Anim_Set(Expression_t expr)
 
 /**
  * @brief 깜빡임 업데이트 (논블로킹)
+ * @note 감고 뜨는 과정은 Eyes_Blink() 트윈이 Eyes_Update() 프레임마다 진행
+ *       (표정 전체를 두 번 다시 그리지 않고 눈꺼풀이 지나간 행만 전송)
  */
 void Blink_Update(void)
 {
     uint32_t now = HAL_GetTick();
     Expression_t current = Eyes_GetExpression();
 
-    /* 깜빡임 중이 아닐 때 */
-    if (!is_blinking)
+    /* 깜빡임 주기 도달 & 전환 중이 아니고 이미 눈 감은 상태가 아닐 때 */
+    if ((now - last_blink_time >= BLINK_INTERVAL_MS) &&
+        !Eyes_IsAnimating() &&
+        (current != EXPR_BLINK) &&
+        (current != EXPR_SLEEPY))
     {
-        /* 깜빡임 주기 도달 & 이미 눈 감은 상태가 아닐 때 */
-        if ((now - last_blink_time >= BLINK_INTERVAL_MS) &&
-            (current != EXPR_BLINK) &&
-            (current != EXPR_SLEEPY))
-        {
-            saved_expr = current;
-            Eyes_SetExpression(EXPR_BLINK);
-            Eyes_Update();
-            is_blinking = 1;
-            last_blink_time = now;
-        }
-    }
-    /* 깜빡임 중일 때 */
-    else
-    {
-        if (now - last_blink_time >= BLINK_DURATION_MS)
-        {
-            Eyes_SetExpression(saved_expr);
-            Eyes_Update();
-            is_blinking = 0;
-            last_blink_time = now;
-        }
+        Eyes_Blink();
+        last_blink_time = now;
     }
 }
 
@@ -89,6 +72,6 @@ void Anim_Update(void)
     /* 깜빡임 처리 */
     Blink_Update();
     
-    /* 표정 변경 시에만 그리기 */
+    /* 트윈 한 프레임 진행 + 바뀐 행만 그리기 */
     Eyes_Update();
 }
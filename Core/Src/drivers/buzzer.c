@@ -1,66 +1,95 @@
 /**
  * @file buzzer.c
- * @brief 논블로킹 부저 드라이버 - 마리오 음악
+ * @brief 부저 톤 드라이버 - TIM4 업데이트 인터럽트가 핀 토글 + 음 순서 진행
+ *
+ * PC13(BUZZER)은 타이머 출력 채널이 없는 핀이라 하드웨어 PWM 대신
+ * TIM4(1MHz) 업데이트 인터럽트에서 반주기마다 핀을 뒤집음.
+ * - 소리 음: ARR = 반주기(us) - 1, 남은 횟수 = 길이 동안의 반주기 수
+ * - 쉼표:   ARR = 1ms - 1, 남은 횟수 = ms
+ * 음 경계마다 다음 음을 ISR 안에서 불러오므로 메인 루프가 얼마나 걸리든 박자가 맞음.
+ * 곡 데이터는 2바이트 묶음 형식 (buzzer.h, buzzer_songs.c).
  */
 
 #include "drivers/buzzer.h"
+#include "drivers/buzzer_songs.h"
 #include "robot_config.h"
 #include "main.h"
 
-static const BuzzerNote_t melody_elise[] = {
-    {0, 0}
-};
-#define ELISE_LENGTH  (sizeof(melody_elise) / sizeof(melody_elise[0]))
-
-static const BuzzerNote_t mario_short[] = {
-    {150, 100},   /* 도 */
-    {150, 100},   /* 도 */
-    {150, 100},   /* 도 */
-    {0, 50},      /* 쉼표 */
-    {100, 100},   /* 솔 */
-    {150, 100},   /* 도 */
-    {0, 50},      /* 쉼표 */
-    {50, 200},    /* 미 (길게) */
-    {0, 100},     /* 쉼표 */
-    {0, 100},     /* 쉼표 */
-
-    {42, 100},    /* 라 */
-    {0, 50},      /* 쉼표 */
-    {42, 100},    /* 라 */
-    {0, 50},      /* 쉼표 */
-    {42, 100},    /* 라 */
-    {0, 50},      /* 쉼표 */
-    {42, 100},    /* 라 */
-    {0, 50},      /* 쉼표 */
-    {47, 100},    /* 시 */
-    {0, 50},      /* 쉼표 */
-
-    {50, 100},    /* 도 */
-    {0, 50},      /* 쉼표 */
-    {47, 100},    /* 시 */
-    {0, 50},      /* 쉼표 */
-    {45, 100},    /* 라 */
-    {0, 50},      /* 쉼표 */
-    {42, 150},    /* 솔 (길게) */
-    {0, 100},     /* 쉼표 */
-
-    {0, 0}        /* 종료 */
-};
-#define MARIO_LENGTH  (sizeof(mario_short) / sizeof(mario_short[0]))
-
-static const BuzzerNote_t melody_alert[] = {
-    {150, 100},
-    {0, 100},
-    {150, 100},
-    {0, 0}
-};
-#define ALERT_LENGTH  (sizeof(melody_alert) / sizeof(melody_alert[0]))
-
-static const BuzzerNote_t *current_melody = NULL;
-static uint8_t melody_length = 0;
-static uint8_t melody_index = 0;
-static uint8_t buzzer_phase = 0;
-static uint32_t buzzer_tick = 0;
+#define REST_TICK_US    1000
+
+static const uint16_t dur_units[16] = BUZZER_DUR_UNITS;
+
+static TIM_HandleTypeDef *bz_tim;
+
+/* ISR과 공유 - 바꿀 때는 타이머를 멈추고 */
+static const BuzzerSong_t *current_song = NULL;
+static uint16_t note_index = 0;
+static uint32_t ticks_left = 0;
+static uint16_t gap_left = 0;       // 소리 다음에 올 무음 (ms)
+static uint8_t tone_on = 0;
+static volatile uint8_t playing = 0;
+
+/* ===== 내부 함수 ===== */
+
+static void Timer_Halt(void)
+{
+    HAL_TIM_Base_Stop_IT(bz_tim);
+    __HAL_TIM_CLEAR_FLAG(bz_tim, TIM_FLAG_UPDATE);
+}
+
+static void Rest_Start(uint16_t ms)
+{
+    Buzzer_Off();
+    __HAL_TIM_SET_AUTORELOAD(bz_tim, REST_TICK_US - 1);
+    ticks_left = ms ? ms : 1;
+    tone_on = 0;
+}
+
+/**
+ * @brief 다음 음을 타이머에 설정 (끝이면 정지)
+ * @note  업데이트 직후(ISR) 또는 타이머 정지 상태에서만 호출 - ARR 즉시 반영
+ */
+static void Note_Load(void)
+{
+    uint16_t note, freq, ms;
+
+    if (note_index >= current_song->count)
+    {
+        Timer_Halt();
+        Buzzer_Off();
+        playing = 0;
+        return;
+    }
+
+    note = current_song->notes[note_index++];
+    freq = note & BUZZER_FREQ_MASK;
+    ms   = (uint32_t)current_song->whole_ms * dur_units[note >> BUZZER_DUR_SHIFT] / BUZZER_DUR_WHOLE;
+
+    if (freq == 0)
+    {
+        gap_left = 0;
+        Rest_Start(ms);
+        return;
+    }
+
+    /* 소리 + 끝 무음 (음이 무음보다 짧으면 무음 없이) */
+    gap_left = (ms > 2 * current_song->gap_ms) ? current_song->gap_ms : 0;
+    ms -= gap_left;
+
+    __HAL_TIM_SET_AUTORELOAD(bz_tim, 500000U / freq - 1);
+    ticks_left = (uint32_t)ms * freq / 500;         // ms 동안의 반주기 수
+    if (ticks_left == 0) ticks_left = 1;
+    tone_on = 1;
+}
+
+/* ===== 외부 API ===== */
+
+void Buzzer_Init(TIM_HandleTypeDef *htim)
+{
+    bz_tim = htim;
+    Timer_Halt();
+    Buzzer_Off();
+}
 
 void Buzzer_On(void)
 {
@@ -72,82 +101,89 @@ void Buzzer_Off(void)
     HAL_GPIO_WritePin(BUZZER_PORT, BUZZER_PIN, GPIO_PIN_RESET);
 }
 
-void Buzzer_PlayMelody(const BuzzerNote_t *melody, uint8_t length)
+/**
+ * @brief 곡 재생 시작 (메인 루프/UART ISR 어디서든 호출 가능)
+ */
+void Buzzer_PlaySong(const BuzzerSong_t *song)
 {
-    if (melody == NULL || length == 0)
+    uint32_t primask;
+
+    if (song == NULL || song->count == 0)
         return;
 
-    current_melody = melody;
-    melody_length = length;
-    melody_index = 0;
-    buzzer_phase = 1;
-    buzzer_tick = HAL_GetTick();
-    Buzzer_On();
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    Timer_Halt();
+    Buzzer_Off();
+
+    current_song = song;
+    note_index = 0;
+    playing = 1;
+
+    Note_Load();
+    if (playing)
+    {
+        __HAL_TIM_SET_COUNTER(bz_tim, 0);
+        HAL_TIM_Base_Start_IT(bz_tim);
+    }
+
+    __set_PRIMASK(primask);
 }
 
 void Buzzer_PlayElise(void)
 {
-    Buzzer_PlayMelody(melody_elise, ELISE_LENGTH);
+    Buzzer_PlaySong(&song_elise);
 }
 
 void Buzzer_PlayAlert(void)
 {
-    Buzzer_PlayMelody(melody_alert, ALERT_LENGTH);
+    Buzzer_PlaySong(&song_alert);
 }
 
 void Buzzer_PlayMario(void)
 {
-    Buzzer_PlayMelody(mario_short, MARIO_LENGTH);
+    Buzzer_PlaySong(&song_mario);
 }
 
 void Buzzer_Stop(void)
 {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    Timer_Halt();
     Buzzer_Off();
-    current_melody = NULL;
-    melody_length = 0;
-    melody_index = 0;
-    buzzer_phase = 0;
+    current_song = NULL;
+    note_index = 0;
+    playing = 0;
+    __set_PRIMASK(primask);
 }
 
 uint8_t Buzzer_IsPlaying(void)
 {
-    return (buzzer_phase != 0);
+    return playing;
 }
 
-void Buzzer_Update(void)
+/**
+ * @brief TIM4 업데이트마다: 소리 음이면 핀 토글, 길이가 끝나면 끝 무음 → 다음 음
+ */
+void Buzzer_OnTimer(void)
 {
-    if (buzzer_phase == 0 || current_melody == NULL)
-        return;
+    if (!playing) return;
+
+    if (tone_on)
+        HAL_GPIO_TogglePin(BUZZER_PORT, BUZZER_PIN);
 
-    uint32_t now = HAL_GetTick();
-    uint32_t elapsed = now - buzzer_tick;
+    if (--ticks_left != 0)
+        return;
 
-    if (buzzer_phase == 1)
+    if (gap_left)
     {
-        if (elapsed >= current_melody[melody_index].on_ms)
-        {
-            Buzzer_Off();
-            buzzer_phase = 2;
-            buzzer_tick = now;
-        }
+        Rest_Start(gap_left);
+        gap_left = 0;
     }
-    else if (buzzer_phase == 2)
+    else
     {
-        if (elapsed >= current_melody[melody_index].off_ms)
-        {
-            melody_index++;
-
-            if (melody_index >= melody_length ||
-                current_melody[melody_index].on_ms == 0)
-            {
-                Buzzer_Stop();
-            }
-            else
-            {
-                Buzzer_On();
-                buzzer_phase = 1;
-                buzzer_tick = now;
-            }
-        }
+        Note_Load();
     }
 }
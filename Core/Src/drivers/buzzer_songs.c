@@ -0,0 +1,35 @@
+/**
+ * @file buzzer_songs.c
+ * @brief 부저 곡 데이터 (2바이트 묶음 음 테이블)
+ *
+ * 자동 생성 파일 - 직접 수정하지 말 것 (make -C Tools melodies)
+ * 원본: Tools/melody/songs/
+ */
+
+#include "drivers/buzzer_songs.h"
+
+static const uint16_t alert_notes[3] = {
+    0x66E0, 0x3000, 0x66E0,
+};
+
+const BuzzerSong_t song_alert = { alert_notes, 3, 1200, 15 };
+
+static const uint16_t elise_notes[41] = {
+    0x1000, 0x6527, 0x64DD, 0x6527, 0x64DD, 0x6527, 0x63DC, 0x6497,
+    0x6417, 0xA370, 0x1000, 0x620B, 0x6293, 0x6370, 0xA3DC, 0x1000,
+    0x6293, 0x633F, 0x63DC, 0xA417, 0x1000, 0x6293, 0x6527, 0x64DD,
+    0x6527, 0x64DD, 0x6527, 0x63DC, 0x6497, 0x6417, 0xA370, 0x1000,
+    0x620B, 0x6293, 0x6370, 0xA3DC, 0x1000, 0x624B, 0x6417, 0x63DC,
+    0xB370,
+};
+
+const BuzzerSong_t song_elise = { elise_notes, 41, 1920, 15 };
+
+static const uint16_t mario_notes[29] = {
+    0x6417, 0x3000, 0x6417, 0x3000, 0x6417, 0x6000, 0x6310, 0x3000,
+    0x6417, 0x6000, 0x9527, 0x9000, 0x6370, 0x6000, 0x6370, 0x6000,
+    0x6370, 0x6000, 0x6370, 0x6000, 0x63DC, 0x6000, 0x6417, 0x6000,
+    0x63DC, 0x6000, 0x6370, 0x6000, 0x9310,
+};
+
+const BuzzerSong_t song_mario = { mario_notes, 29, 1200, 15 };
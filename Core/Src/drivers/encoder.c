@@ -0,0 +1,102 @@
+/**
+ * @file encoder.c
+ * @brief 바퀴 엔코더 - EXTI 에지마다 카운트 + 시각 기록, 속도는 읽을 때 계산
+ *
+ * 상승/하강 양쪽 에지를 셈 (회전당 ENCODER_SLOTS x 2).
+ * 속도는 같은 극성 에지 간격(에지 2개 = 슬롯 한 주기)으로 계산해서
+ * 슬롯/막대 폭 차이에 영향을 받지 않게 함.
+ * 마지막 에지 이후 시간이 그보다 길어지면 그 시간으로 상한을 줄여서
+ * 바퀴가 멈추면 다음 에지를 기다리지 않고 속도가 0으로 내려감.
+ */
+
+#include "drivers/encoder.h"
+#include "drivers/timebase.h"
+
+/* ISR과 공유 */
+static volatile int32_t  enc_edges;
+static volatile int8_t   enc_dir = 1;           // 마지막 모터 출력 방향
+static volatile uint32_t enc_t1;                // 마지막 에지 (us)
+static volatile uint32_t enc_t2;                // 그 앞 에지
+static volatile uint32_t enc_period;            // 같은 극성 에지 간격 (us)
+static volatile uint8_t  enc_run;               // 멈춘 뒤 이어진 에지 수 (최대 3)
+
+/* ===== 외부 API ===== */
+
+void Encoder_Init(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    enc_edges  = 0;
+    enc_dir    = 1;
+    enc_run    = 0;
+    enc_period = 0;
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief EXTI 에지 (양쪽 에지, ISR)
+ */
+void Encoder_OnEdge(void)
+{
+    uint32_t now = Timebase_Us();
+    int8_t out = Motor_GetSpeed(ENCODER_SIDE);
+    int8_t dir = (out > 0) ? 1 : (out < 0) ? -1 : enc_dir;
+
+    if (enc_run)
+    {
+        uint32_t dt = now - enc_t1;
+
+        if (dt < ENCODER_DEBOUNCE_US) return;
+        if (dt > ENCODER_STALL_US || dir != enc_dir) enc_run = 0;   // 앞 구간 간격은 버림
+    }
+
+    enc_dir = dir;
+    enc_edges += dir;
+
+    if (enc_run >= 2)      enc_period = now - enc_t2;
+    else if (enc_run == 1) enc_period = 2 * (now - enc_t1);        // 첫 간격은 반주기로 어림
+
+    enc_t2 = enc_t1;
+    enc_t1 = now;
+    if (enc_run < 3) enc_run++;
+}
+
+int32_t Encoder_Edges(void)
+{
+    return enc_edges;
+}
+
+/**
+ * @brief 속도 추정 (mm/s)
+ */
+int16_t Encoder_SpeedMmS(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t since, period, mm_s;
+    uint8_t run;
+    int8_t dir;
+
+    __disable_irq();
+    since  = Timebase_Us() - enc_t1;
+    period = enc_period;
+    run    = enc_run;
+    dir    = enc_dir;
+    __set_PRIMASK(primask);
+
+    if (run < 2 || since > ENCODER_STALL_US) return 0;
+
+    /* 에지 2개 / 주기, 다음 에지가 늦어지면 에지 1개 / 지난 시간 */
+    mm_s = (2UL * ENCODER_UM_PER_EDGE * 1000UL) / period;
+    if (since * 2 > period) mm_s = (ENCODER_UM_PER_EDGE * 1000UL) / since;
+
+    return (int16_t)(dir * (int32_t)mm_s);
+}
+
+/**
+ * @brief 누적 이동 (um) - 에지 단위 (ENCODER_UM_PER_EDGE 분해능)
+ */
+int32_t Encoder_PositionUm(void)
+{
+    return enc_edges * (int32_t)ENCODER_UM_PER_EDGE;
+}
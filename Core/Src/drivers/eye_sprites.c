@@ -0,0 +1,323 @@
+/**
+ * @file eye_sprites.c
+ * @brief 눈 표정 RLE span 스프라이트 데이터
+ *
+ * 자동 생성 파일 - 직접 수정하지 말 것 (make -C Tools sprites)
+ */
+
+#include "drivers/eye_sprites.h"
+
+static const uint8_t spr_neutral_l[150] = {
+    1, 17, 16,
+    1, 15, 20,
+    1, 14, 22,
+    1, 13, 24,
+    1, 12, 26,
+    1, 11, 28,
+    1, 11, 28,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 11, 28,
+    1, 11, 28,
+    1, 12, 26,
+    1, 13, 24,
+    1, 14, 22,
+    1, 15, 20,
+    1, 17, 16,
+};
+
+static const uint8_t spr_blink_l[18] = {
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+};
+
+static const uint8_t spr_happy_l[75] = {
+    1, 19, 12,
+    1, 17, 16,
+    1, 15, 20,
+    1, 14, 22,
+    1, 13, 24,
+    1, 12, 26,
+    1, 12, 26,
+    1, 11, 28,
+    1, 11, 28,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 11, 28,
+    1, 11, 28,
+    1, 12, 26,
+    1, 12, 26,
+    1, 13, 24,
+    1, 14, 22,
+    1, 15, 20,
+    1, 17, 16,
+    1, 19, 12,
+};
+
+static const uint8_t spr_angry_l[60] = {
+    1, 38,  5,
+    1, 36,  6,
+    1, 34,  9,
+    1, 32, 10,
+    1, 30, 13,
+    1, 28, 14,
+    1, 26, 14,
+    1, 24, 14,
+    1, 22, 14,
+    1, 20, 14,
+    1, 18, 14,
+    1, 16, 14,
+    1, 14, 14,
+    1, 12, 14,
+    1, 10, 14,
+    1,  8, 14,
+    1, 10, 10,
+    1,  8, 10,
+    1, 10,  6,
+    1,  8,  6,
+};
+
+static const uint8_t spr_angry_r[60] = {
+    1,  8,  6,
+    1, 10,  6,
+    1,  8, 10,
+    1, 10, 10,
+    1,  8, 14,
+    1, 10, 14,
+    1, 12, 14,
+    1, 14, 14,
+    1, 16, 14,
+    1, 18, 14,
+    1, 20, 14,
+    1, 22, 14,
+    1, 24, 14,
+    1, 26, 14,
+    1, 28, 14,
+    1, 30, 13,
+    1, 32, 10,
+    1, 34,  9,
+    1, 36,  6,
+    1, 38,  5,
+};
+
+static const uint8_t spr_sad_l[45] = {
+    1, 12,  4,
+    1, 12,  7,
+    1, 12, 10,
+    1, 14, 11,
+    1, 17, 11,
+    1, 20, 11,
+    1, 23, 11,
+    1, 26, 11,
+    1, 29, 10,
+    1, 32,  7,
+    1, 35,  4,
+    1, 15, 20,
+    1, 15, 20,
+    1, 15, 20,
+    1, 15, 20,
+};
+
+static const uint8_t spr_sad_r[45] = {
+    1, 35,  4,
+    1, 32,  7,
+    1, 29, 10,
+    1, 26, 11,
+    1, 23, 11,
+    1, 20, 11,
+    1, 17, 11,
+    1, 14, 11,
+    1, 12, 10,
+    1, 12,  7,
+    1, 12,  4,
+    1, 15, 20,
+    1, 15, 20,
+    1, 15, 20,
+    1, 15, 20,
+};
+
+static const uint8_t spr_look_left_l[190] = {
+    1, 17, 16,
+    1, 15, 20,
+    1, 14, 22,
+    1, 13, 24,
+    1, 12, 26,
+    1, 11, 28,
+    1, 11, 28,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    2, 10,  3, 21, 19,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 11, 28,
+    1, 11, 28,
+    1, 12, 26,
+    1, 13, 24,
+    1, 14, 22,
+    1, 15, 20,
+    1, 17, 16,
+};
+
+static const uint8_t spr_look_right_l[190] = {
+    1, 17, 16,
+    1, 15, 20,
+    1, 14, 22,
+    1, 13, 24,
+    1, 12, 26,
+    1, 11, 28,
+    1, 11, 28,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    2, 10, 19, 37,  3,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 10, 30,
+    1, 11, 28,
+    1, 11, 28,
+    1, 12, 26,
+    1, 13, 24,
+    1, 14, 22,
+    1, 15, 20,
+    1, 17, 16,
+};
+
+const EyeSprite_t eye_sprites[EXPR_COUNT][2] = {
+    [0] = {  /* neutral */
+        { spr_neutral_l,  5, 50 },
+        { spr_neutral_l,  5, 50 },
+    },
+    [1] = {  /* blink */
+        { spr_blink_l, 27,  6 },
+        { spr_blink_l, 27,  6 },
+    },
+    [2] = {  /* happy */
+        { spr_happy_l, 25, 25 },
+        { spr_happy_l, 25, 25 },
+    },
+    [3] = {  /* angry */
+        { spr_angry_l,  8, 20 },
+        { spr_angry_r,  8, 20 },
+    },
+    [4] = {  /* sleepy */
+        { spr_blink_l, 27,  6 },
+        { spr_blink_l, 27,  6 },
+    },
+    [5] = {  /* sad */
+        { spr_sad_l, 19, 15 },
+        { spr_sad_r, 19, 15 },
+    },
+    [6] = {  /* look_left */
+        { spr_look_left_l,  5, 50 },
+        { spr_look_left_l,  5, 50 },
+    },
+    [7] = {  /* look_right */
+        { spr_look_right_l,  5, 50 },
+        { spr_look_right_l,  5, 50 },
+    },
+};
+
+const uint32_t eye_sprites_size = 961;
@@ -6,11 +6,19 @@
  * 1. dirty flag로 변경 시에만 그리기
  * 2. 중복 호출 방지
  * 3. 영역 클리어 최적화
+ * 4. RLE span 스프라이트 블릿 (눈 하나당 윈도우 1개, 오버드로우 없음)
+ * 5. 파라미터(눈꺼풀/기울기/동공) 트윈 + 바뀐 행만 전송
+ * 6. 호출당 SPI 바이트 예산 - 넘으면 다음 틱에 이어서 전송
+ *
+ * 표정 = 기본 모양(스프라이트) + 파라미터. 프레임마다 파라미터로 행별
+ * span을 만들고 섀도 버퍼와 비교해서 달라진 행 묶음만 윈도우로 보냄.
+ * 기본 모양이 바뀌는 전환은 눈꺼풀을 닫았다가 새 모양으로 다시 엶.
  */
 
 #include "drivers/eyes.h"
 #include "drivers/lcd_st7735.h"
 #include "drivers/lcd_gfx.h"
+#include "drivers/eye_sprites.h"
 #include "main.h"
 
 /* ===== 색상 정의 ===== */
@@ -27,12 +35,500 @@
 #define EYE_H   60
 #define EYE_Y   (CY - 30)
 
-/* ===== 상태 관리 ===== */
-static Expression_t current_expr = EXPR_NEUTRAL;
-static uint8_t dirty = 1;  // 처음엔 그려야 함
+#if EYE_SPRITE_W != EYE_W || EYE_SPRITE_H != EYE_H || EYE_SPRITE_Y != EYE_Y || \
+    EYE_SPRITE_LX != LX - EYE_W / 2 || EYE_SPRITE_RX != RX - EYE_W / 2
+#error "eye_sprites.h 박스 크기가 eyes.c 눈 영역과 다름 - make -C Tools sprites"
+#endif
+
+#if EYES_USE_SPRITES
+
+/* ===== 파라미터 모델 ===== */
+#define EYE_MAX_SPANS       3       // 행당 최대 span (기본 모양 2 + 동공 분할)
+#define EYE_TWEEN_FRAMES    4       // 표정 전환 프레임 수 (Eyes_Update 1회 = 1프레임)
+
+#define LID_OPEN_TOP        0
+#define LID_OPEN_BOT        EYE_H
+#define LID_CLOSED_TOP      27      // 감은 눈 = EXPR_BLINK 막대 (CY-3 ~ CY+3)
+#define LID_CLOSED_BOT      33
+
+#define PUPIL_Y0            20      // 동공 행 범위 (CY-10 ~ CY+10)
+#define PUPIL_Y1            40
+#define PUPIL_W             8
+#define PUPIL_X_LEFT        13      // cx - 12 (박스 기준)
+#define PUPIL_X_RIGHT       29      // cx + 4
+
+typedef struct {
+    uint8_t lid_top;        // 이 행부터 보임 (위 눈꺼풀)
+    uint8_t lid_bot;        // 이 행부터 안 보임 (아래 눈꺼풀)
+    int8_t  tilt;           // 위 눈꺼풀 기울기 (감았을 때 박스 끝에서의 행 차이)
+    uint8_t pupil_x;        // 동공 x (박스 기준)
+    uint8_t pupil_w;        // 동공 폭 (0 = 없음)
+} EyeParams_t;
+
+typedef struct {
+    Expression_t base;      // 기본 모양 스프라이트
+    EyeParams_t  p;         // 왼쪽 눈 기준 (오른쪽은 tilt 부호 반전)
+} EyePreset_t;
+
+static const EyePreset_t presets[EXPR_COUNT] = {
+    [EXPR_NEUTRAL]    = { EXPR_NEUTRAL, { LID_OPEN_TOP,   LID_OPEN_BOT,    0, PUPIL_X_LEFT,  0 } },
+    [EXPR_BLINK]      = { EXPR_NEUTRAL, { LID_CLOSED_TOP, LID_CLOSED_BOT,  0, PUPIL_X_LEFT,  0 } },
+    [EXPR_HAPPY]      = { EXPR_HAPPY,   { LID_OPEN_TOP,   LID_OPEN_BOT,    0, PUPIL_X_LEFT,  0 } },
+    [EXPR_ANGRY]      = { EXPR_ANGRY,   { LID_OPEN_TOP,   LID_OPEN_BOT,   -8, PUPIL_X_LEFT,  0 } },
+    [EXPR_SLEEPY]     = { EXPR_NEUTRAL, { LID_CLOSED_TOP, LID_CLOSED_BOT,  0, PUPIL_X_LEFT,  0 } },
+    [EXPR_SAD]        = { EXPR_SAD,     { LID_OPEN_TOP,   LID_OPEN_BOT,    8, PUPIL_X_LEFT,  0 } },
+    [EXPR_LOOK_LEFT]  = { EXPR_NEUTRAL, { LID_OPEN_TOP,   LID_OPEN_BOT,    0, PUPIL_X_LEFT,  PUPIL_W } },
+    [EXPR_LOOK_RIGHT] = { EXPR_NEUTRAL, { LID_OPEN_TOP,   LID_OPEN_BOT,    0, PUPIL_X_RIGHT, PUPIL_W } },
+};
+
+/* ===== 섀도 버퍼 (패널에 실제로 그려진 행별 span) ===== */
+typedef struct {
+    uint8_t n;
+    uint8_t span[EYE_MAX_SPANS][2];     // [x0, len]
+} EyeRow_t;
+
+static EyeRow_t shadow[2][EYE_H];
+static uint8_t  dirty_x0[2][EYE_H];     // 보내야 할 x 범위 [x0, x1)
+static uint8_t  dirty_x1[2][EYE_H];     // x1 == 0 이면 깨끗한 행
+
+/* ===== 트윈 상태 ===== */
+typedef enum {
+    TWEEN_IDLE = 0,
+    TWEEN_MORPH,            // 같은 기본 모양: 파라미터 보간
+    TWEEN_CLOSE,            // 눈꺼풀 닫기 (끝나면 기본 모양 교체)
+    TWEEN_OPEN              // 눈꺼풀 열기
+} TweenPhase_t;
+
+static Expression_t current_expr = EXPR_NEUTRAL;    // 목표 표정
+static Expression_t base_expr    = EXPR_NEUTRAL;    // 지금 그려지는 기본 모양
+static EyeParams_t  cur = { LID_OPEN_TOP, LID_OPEN_BOT, 0, PUPIL_X_LEFT, 0 }; // 지금 파라미터 (왼쪽 눈 기준)
+static EyeParams_t  from, to;
+static TweenPhase_t phase = TWEEN_IDLE;
+static uint8_t      step, steps;
+static uint8_t      frame_dirty = 1;                // 새 프레임 계산 필요
+static uint8_t      full_redraw = 1;                // 눈 박스 전체 다시 보내기
+
+/* ===== 전송 커서 (예산 단위로 끊어 보내기) =====
+ * 프레임 하나를 다 보내기 전에는 트윈을 진행하지 않고 섀도도 바꾸지 않음.
+ * 그래서 패널에는 항상 이전 프레임과 현재 프레임 행만 섞여 있고
+ * 서로 다른 표정이 섞이지 않음.
+ */
+#define EYE_WIN_COST        11      // LCD_SetWindow 바이트 (CASET/RASET/RAMWR)
+
+typedef struct {
+    uint8_t pending;        // 보내는 중인 프레임 있음
+    uint8_t eye;            // 0: 왼쪽, 1: 오른쪽, 2: 완료
+    uint8_t y;              // 현재 행 (묶음이 없으면 검색 시작 행)
+    uint8_t in_group;       // 현재 묶음 [y, y1) x [x0, x1) 진행 중
+    uint8_t y1;
+    uint8_t x0, x1;
+    uint8_t x;              // 현재 행에서 다음에 보낼 x
+} FlushCursor_t;
+
+static FlushCursor_t fc;
 
 /* ===== 내부 함수 ===== */
 
+static uint8_t lerp_u8(uint8_t a, uint8_t b, uint8_t t, uint8_t n)
+{
+    return (uint8_t)(a + ((int16_t)b - a) * t / n);
+}
+
+static EyeParams_t Params_Lerp(const EyeParams_t *a, const EyeParams_t *b, uint8_t t, uint8_t n)
+{
+    EyeParams_t r;
+    r.lid_top = lerp_u8(a->lid_top, b->lid_top, t, n);
+    r.lid_bot = lerp_u8(a->lid_bot, b->lid_bot, t, n);
+    r.tilt    = (int8_t)(a->tilt + ((int16_t)b->tilt - a->tilt) * t / n);
+    r.pupil_x = lerp_u8(a->pupil_x, b->pupil_x, t, n);
+    r.pupil_w = lerp_u8(a->pupil_w, b->pupil_w, t, n);
+    return r;
+}
+
+static EyeParams_t Params_Closed(const EyeParams_t *p)
+{
+    EyeParams_t r = *p;
+    r.lid_top = LID_CLOSED_TOP;
+    r.lid_bot = LID_CLOSED_BOT;
+    return r;
+}
+
+static void Tween_Start(TweenPhase_t ph, const EyeParams_t *target, uint8_t n)
+{
+    from  = cur;
+    to    = *target;
+    phase = ph;
+    step  = 0;
+    steps = n;
+}
+
+/* 정수 나눗셈 내림 (음수 포함) */
+static int16_t div_floor(int16_t a, int16_t b)
+{
+    int16_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
+}
+
+/**
+ * @brief 위 눈꺼풀 아래로 보이는 x 범위 [*x0, *x1) 계산
+ * @note  눈꺼풀 가장자리: edge(x) = lid_top + tilt * (x - W/2) / (W/2)
+ *        edge(x) <= y 인 x만 보임 (직선이므로 범위는 항상 연속)
+ */
+static void Lid_Visible(const EyeParams_t *p, int8_t tilt, uint8_t y, uint8_t *x0, uint8_t *x1)
+{
+    const int16_t half = EYE_W / 2;
+    int16_t d = ((int16_t)y - p->lid_top) * half;
+    int16_t lim;
+
+    *x0 = 0;
+    *x1 = EYE_W;
+
+    if (tilt == 0)
+    {
+        if (y < p->lid_top) *x1 = 0;
+        return;
+    }
+
+    if (tilt > 0)
+    {
+        /* x <= half + d / tilt */
+        lim = half + div_floor(d, tilt) + 1;
+        if (lim < 0) lim = 0;
+        if (lim < EYE_W) *x1 = (uint8_t)lim;
+    }
+    else
+    {
+        /* x >= half + d / tilt (올림) */
+        lim = half - div_floor(d, -tilt);
+        if (lim > EYE_W) lim = EYE_W;
+        if (lim > 0) *x0 = (uint8_t)lim;
+    }
+}
+
+/**
+ * @brief 기본 모양 한 행 + 파라미터 → 최종 span
+ * @param src  스프라이트 행 데이터 ([n][x0,len]...), 빈 행이면 NULL
+ */
+static void Row_Build(const uint8_t *src, const EyeParams_t *p, int8_t tilt,
+                      uint8_t y, EyeRow_t *out)
+{
+    uint8_t vx0, vx1;
+
+    out->n = 0;
+    if (src == NULL || y >= p->lid_bot) return;
+
+    Lid_Visible(p, tilt, y, &vx0, &vx1);
+    if (vx1 <= vx0) return;
+
+    uint8_t n = *src++;
+    uint8_t has_pupil = (p->pupil_w > 0 && y >= PUPIL_Y0 && y < PUPIL_Y1);
+
+    while (n--)
+    {
+        uint8_t sx = *src++;
+        uint8_t ex = sx + *src++;
+
+        if (sx < vx0) sx = vx0;
+        if (ex > vx1) ex = vx1;
+        if (ex <= sx) continue;
+
+        /* 동공 구멍으로 span 나누기 */
+        uint8_t px0 = p->pupil_x;
+        uint8_t px1 = p->pupil_x + p->pupil_w;
+        uint8_t piece[2][2] = { { sx, ex }, { 0, 0 } };
+        uint8_t pieces = 1;
+
+        if (has_pupil && px0 < ex && px1 > sx)
+        {
+            pieces = 0;
+            if (px0 > sx) { piece[pieces][0] = sx;  piece[pieces][1] = px0; pieces++; }
+            if (px1 < ex) { piece[pieces][0] = px1; piece[pieces][1] = ex;  pieces++; }
+        }
+
+        for (uint8_t k = 0; k < pieces && out->n < EYE_MAX_SPANS; k++)
+        {
+            out->span[out->n][0] = piece[k][0];
+            out->span[out->n][1] = piece[k][1] - piece[k][0];
+            out->n++;
+        }
+    }
+}
+
+static uint8_t Row_Equal(const EyeRow_t *a, const EyeRow_t *b)
+{
+    if (a->n != b->n) return 0;
+    for (uint8_t i = 0; i < a->n; i++)
+    {
+        if (a->span[i][0] != b->span[i][0] || a->span[i][1] != b->span[i][1])
+            return 0;
+    }
+    return 1;
+}
+
+static void Row_Extent(const EyeRow_t *r, uint8_t *x0, uint8_t *x1)
+{
+    if (r->n == 0) return;
+    if (r->span[0][0] < *x0) *x0 = r->span[0][0];
+
+    uint8_t end = r->span[r->n - 1][0] + r->span[r->n - 1][1];
+    if (end > *x1) *x1 = end;
+}
+
+/**
+ * @brief 현재 파라미터로 눈 하나의 프레임을 만들어 섀도와 비교
+ * @note  달라진 행은 섀도를 갱신하고 dirty 범위(이전 ∪ 새 span)를 기록
+ */
+static void Eye_Compose(uint8_t eye)
+{
+    const EyeSprite_t *spr = &eye_sprites[base_expr][eye];
+    const uint8_t *src = spr->rows;
+    /* 기울기는 눈꺼풀이 내려온 만큼만 적용 (완전히 뜬 눈은 기본 모양 그대로) */
+    int8_t tilt = (int8_t)((int16_t)cur.tilt * cur.lid_top / LID_CLOSED_TOP);
+    EyeRow_t row;
+
+    if (eye) tilt = -tilt;
+
+    for (uint8_t y = 0; y < EYE_H; y++)
+    {
+        const uint8_t *row_src = NULL;
+
+        if (y >= spr->y0 && y < spr->y0 + spr->h)
+        {
+            row_src = src;
+            src += 1 + 2 * src[0];
+        }
+
+        Row_Build(row_src, &cur, tilt, y, &row);
+
+        if (full_redraw)
+        {
+            dirty_x0[eye][y] = 0;
+            dirty_x1[eye][y] = EYE_W;
+        }
+        else if (!Row_Equal(&row, &shadow[eye][y]))
+        {
+            uint8_t x0 = dirty_x1[eye][y] ? dirty_x0[eye][y] : EYE_W;
+            uint8_t x1 = dirty_x1[eye][y];
+
+            Row_Extent(&shadow[eye][y], &x0, &x1);
+            Row_Extent(&row, &x0, &x1);
+            dirty_x0[eye][y] = x0;
+            dirty_x1[eye][y] = x1;
+        }
+
+        shadow[eye][y] = row;
+    }
+}
+
+/**
+ * @brief 섀도의 한 행을 [x0, x1) 구간만 스트림 출력
+ */
+static void Row_Stream(const EyeRow_t *r, uint8_t x0, uint8_t x1)
+{
+    uint8_t x = x0;
+
+    for (uint8_t i = 0; i < r->n; i++)
+    {
+        uint8_t sx = r->span[i][0];
+        uint8_t ex = sx + r->span[i][1];
+
+        if (sx < x)  sx = x;
+        if (ex > x1) ex = x1;
+        if (ex <= sx) continue;
+
+        LCD_StreamColor(BLACK, sx - x);
+        LCD_StreamColor(EYE_COLOR, ex - sx);
+        x = ex;
+    }
+    LCD_StreamColor(BLACK, x1 - x);
+}
+
+/**
+ * @brief 다음 dirty 행 묶음 찾기 (fc.eye의 fc.y부터)
+ * @return 1 = 묶음 있음 (fc에 범위 설정)
+ */
+static uint8_t Group_Next(void)
+{
+    uint8_t eye = fc.eye;
+    uint8_t y = fc.y;
+
+    while (y < EYE_H && dirty_x1[eye][y] == 0) y++;
+    if (y == EYE_H) return 0;
+
+    fc.y  = y;
+    fc.x0 = EYE_W;
+    fc.x1 = 0;
+
+    while (y < EYE_H && dirty_x1[eye][y])
+    {
+        if (dirty_x0[eye][y] < fc.x0) fc.x0 = dirty_x0[eye][y];
+        if (dirty_x1[eye][y] > fc.x1) fc.x1 = dirty_x1[eye][y];
+        y++;
+    }
+
+    fc.y1 = y;
+    fc.x  = fc.x0;
+    fc.in_group = 1;
+    return 1;
+}
+
+/**
+ * @brief 보내는 중인 프레임을 budget 바이트 안에서 이어서 전송
+ * @return 1 = 프레임 전송 완료
+ * @note  dirty 행 묶음마다 윈도우 하나. 예산이 행 중간에서 끝나면
+ *        다음 호출은 그 행 나머지만 1행 윈도우로 보낸 뒤 묶음 윈도우를 다시 엶
+ */
+static uint8_t Flush_Run(uint16_t budget)
+{
+    static const int16_t eye_cx[2] = { LX, RX };
+    uint8_t streaming = 0;      // 0: 닫힘, 1: 묶음 윈도우, 2: 1행 윈도우
+
+    while (fc.eye < 2)
+    {
+        if (!fc.in_group && !Group_Next())
+        {
+            fc.eye++;
+            fc.y = 0;
+            continue;
+        }
+
+        if (!streaming)
+        {
+            int16_t bx = eye_cx[fc.eye] - EYE_W / 2;
+
+            if (budget < EYE_WIN_COST + 2) break;
+            budget -= EYE_WIN_COST;
+
+            if (fc.x != fc.x0)
+            {
+                LCD_SetWindow(bx + fc.x, EYE_Y + fc.y, bx + fc.x1 - 1, EYE_Y + fc.y);
+                streaming = 2;
+            }
+            else
+            {
+                LCD_SetWindow(bx + fc.x0, EYE_Y + fc.y, bx + fc.x1 - 1, EYE_Y + fc.y1 - 1);
+                streaming = 1;
+            }
+            LCD_StreamBegin();
+        }
+
+        uint8_t n = fc.x1 - fc.x;
+        if (n > budget / 2) n = budget / 2;
+        if (n == 0) break;
+
+        Row_Stream(&shadow[fc.eye][fc.y], fc.x, fc.x + n);
+        budget -= 2 * n;
+        fc.x += n;
+
+        if (fc.x < fc.x1) break;    // 예산 소진 (행 중간)
+
+        dirty_x1[fc.eye][fc.y] = 0;
+        fc.y++;
+        fc.x = fc.x0;
+        if (fc.y == fc.y1) fc.in_group = 0;
+
+        if (streaming == 2 || !fc.in_group)
+        {
+            LCD_StreamEnd();
+            streaming = 0;
+        }
+    }
+
+    if (streaming) LCD_StreamEnd();
+
+    return (fc.eye >= 2);
+}
+
+/**
+ * @brief 트윈 한 단계 진행 (Eyes_Update 1회당 1프레임)
+ */
+static void Tween_Step(void)
+{
+    if (phase == TWEEN_IDLE) return;
+
+    step++;
+    cur = Params_Lerp(&from, &to, step, steps);
+    frame_dirty = 1;
+
+    if (step < steps) return;
+
+    if (phase == TWEEN_CLOSE)
+    {
+        /* 감은 상태에서 기본 모양 교체 후 목표 파라미터로 열기 */
+        const EyePreset_t *tp = &presets[current_expr];
+
+        base_expr = tp->base;
+        cur = Params_Closed(&tp->p);
+        Tween_Start(TWEEN_OPEN, &tp->p, EYE_TWEEN_FRAMES / 2);
+    }
+    else
+    {
+        phase = TWEEN_IDLE;
+    }
+}
+
+/**
+ * @brief 현재 파라미터에서 목표 표정으로 전환 시작
+ */
+static void Tween_To(Expression_t expr)
+{
+    const EyePreset_t *tp = &presets[expr];
+
+    if (tp->base == base_expr)
+    {
+        Tween_Start(TWEEN_MORPH, &tp->p, EYE_TWEEN_FRAMES);
+    }
+    else
+    {
+        EyeParams_t closed = Params_Closed(&cur);
+        Tween_Start(TWEEN_CLOSE, &closed, EYE_TWEEN_FRAMES / 2);
+    }
+}
+
+/**
+ * @brief 스프라이트 한 개를 눈 박스에 블릿
+ * @note  박스 전체를 윈도우 하나로 잡고 배경/눈 색 run을 스트림 전송
+ *        (클리어가 포함되므로 ClearEyeArea 불필요)
+ */
+static void Eye_Blit(int16_t cx, const EyeSprite_t *spr)
+{
+    const uint8_t *p = spr->rows;
+    int16_t x0 = cx - EYE_W / 2;
+
+    LCD_SetWindow(x0, EYE_Y, x0 + EYE_W - 1, EYE_Y + EYE_H - 1);
+    LCD_StreamBegin();
+
+    /* 위쪽 빈 행 */
+    LCD_StreamColor(BLACK, (uint32_t)spr->y0 * EYE_W);
+
+    for (uint8_t row = 0; row < spr->h; row++)
+    {
+        uint8_t n = *p++;
+        uint8_t x = 0;
+
+        while (n--)
+        {
+            uint8_t sx  = *p++;
+            uint8_t len = *p++;
+
+            LCD_StreamColor(BLACK, sx - x);
+            LCD_StreamColor(EYE_COLOR, len);
+            x = sx + len;
+        }
+        LCD_StreamColor(BLACK, EYE_W - x);
+    }
+
+    /* 아래쪽 빈 행 */
+    LCD_StreamColor(BLACK, (uint32_t)(EYE_H - spr->y0 - spr->h) * EYE_W);
+
+    LCD_StreamEnd();
+}
+
+#endif /* EYES_USE_SPRITES */
+
+#if !EYES_USE_SPRITES || defined(EYES_KEEP_PROCEDURAL)
+
 static void Eye_Normal(int16_t cx)
 {
     LCD_RoundRect(cx - 15, CY - 25, 30, 50, 10, EYE_COLOR);
@@ -93,12 +589,10 @@ static void ClearEyeArea(void)
     LCD_FillRect(RX - 25, EYE_Y, EYE_W, EYE_H, BLACK);
 }
 
-/* ===== 외부 API ===== */
-
 /**
- * @brief 표정 직접 그리기 (강제)
+ * @brief 도형 기반 표정 그리기 (스프라이트 생성 원본)
  */
-void Eyes_Draw(Expression_t expr)
+void Eyes_DrawProcedural(Expression_t expr)
 {
     ClearEyeArea();
 
@@ -149,7 +643,146 @@ void Eyes_Draw(Expression_t expr)
             Eye_Normal(RX);
             break;
     }
+}
+
+#endif /* !EYES_USE_SPRITES || EYES_KEEP_PROCEDURAL */
+
+/* ===== 외부 API ===== */
+
+#if EYES_USE_SPRITES
+
+/**
+ * @brief 표정 직접 그리기 (강제, 트윈 없음)
+ */
+void Eyes_Draw(Expression_t expr)
+{
+    if (expr >= EXPR_COUNT) expr = EXPR_NEUTRAL;
+
+    Eye_Blit(LX, &eye_sprites[expr][0]);
+    Eye_Blit(RX, &eye_sprites[expr][1]);
+
+    /* 섀도를 그려진 표정으로 맞춤 (프리셋 렌더 결과 = 스프라이트) */
+    current_expr = expr;
+    base_expr    = presets[expr].base;
+    cur          = presets[expr].p;
+    phase        = TWEEN_IDLE;
+    full_redraw  = 0;
+    fc.pending   = 0;
+
+    Eye_Compose(0);
+    Eye_Compose(1);
+    for (uint8_t y = 0; y < EYE_H; y++)
+    {
+        dirty_x1[0][y] = 0;
+        dirty_x1[1][y] = 0;
+    }
+    frame_dirty = 0;
+}
+
+/**
+ * @brief 표정 설정 (다음 Eyes_Update부터 트윈 전환)
+ */
+void Eyes_SetExpression(Expression_t expr)
+{
+    if (expr >= EXPR_COUNT || expr == current_expr) return;
+
+    current_expr = expr;
+    Tween_To(expr);
+}
+
+/**
+ * @brief 현재 표정에서 눈을 감았다 뜸 (기본 모양 유지, 바뀐 행만 전송)
+ */
+void Eyes_Blink(void)
+{
+    if (phase != TWEEN_IDLE) return;
+
+    EyeParams_t closed = Params_Closed(&cur);
+    base_expr = presets[current_expr].base;
+    Tween_Start(TWEEN_CLOSE, &closed, EYE_TWEEN_FRAMES / 2);
+}
+
+/**
+ * @brief 트윈 진행 중인지
+ */
+uint8_t Eyes_IsAnimating(void)
+{
+    return (phase != TWEEN_IDLE) || fc.pending;
+}
+
+/**
+ * @brief 현재 표정 반환
+ */
+Expression_t Eyes_GetExpression(void)
+{
+    return current_expr;
+}
+
+/**
+ * @brief 예산 안에서 그리기 진행
+ * @param budget_bytes 이번 호출에서 SPI로 보낼 최대 바이트 (윈도우 설정 포함)
+ * @return 1 = 보낼 것이 더 없음, 0 = 다음 호출에서 이어서 전송
+ * @note  보내던 프레임이 있으면 이어서 보내고, 없을 때만 트윈을 한 프레임
+ *        진행해서 새 프레임을 만듦 (새 프레임은 다음 호출부터 전송 시작 가능)
+ */
+uint8_t Eyes_Service(uint16_t budget_bytes)
+{
+    if (!fc.pending)
+    {
+        Tween_Step();
+
+        if (!frame_dirty && !full_redraw) return 1;
+
+        Eye_Compose(0);
+        Eye_Compose(1);
+        full_redraw = 0;
+        frame_dirty = 0;
+
+        fc.pending  = 1;
+        fc.eye      = 0;
+        fc.y        = 0;
+        fc.in_group = 0;
+    }
+
+    if (Flush_Run(budget_bytes))
+    {
+        fc.pending = 0;
+        return 1;
+    }
+    return 0;
+}
 
+/**
+ * @brief 한 프레임 진행 + 바뀐 행만 그리기 (UI 틱마다 호출)
+ */
+void Eyes_Update(void)
+{
+    Eyes_Service(EYES_TICK_BUDGET);
+}
+
+/**
+ * @brief 강제 갱신 (LCD_Clear 등으로 패널 내용이 바뀐 뒤 호출)
+ */
+void Eyes_Invalidate(void)
+{
+    full_redraw = 1;
+}
+
+#else /* !EYES_USE_SPRITES */
+
+#define BLINK_HOLD_MS   150     // 감은 눈을 보여 주는 시간 (트윈이 없으므로)
+
+static Expression_t current_expr = EXPR_NEUTRAL;
+static uint8_t dirty = 1;  // 처음엔 그려야 함
+static uint8_t blinking;
+static uint32_t blink_tick;
+
+/**
+ * @brief 표정 직접 그리기 (강제)
+ */
+void Eyes_Draw(Expression_t expr)
+{
+    Eyes_DrawProcedural(expr);
     dirty = 0;
 }
 
@@ -165,6 +798,32 @@ void Eyes_SetExpression(Expression_t expr)
     }
 }
 
+/**
+ * @brief 도형 경로에는 트윈이 없으므로 감은 눈을 바로 그리고 BLINK_HOLD_MS 뒤
+ *        Eyes_Update가 현재 표정으로 되돌림
+ */
+void Eyes_Blink(void)
+{
+    Eyes_Draw(EXPR_BLINK);
+    blinking = 1;
+    blink_tick = HAL_GetTick();
+}
+
+uint8_t Eyes_IsAnimating(void)
+{
+    return blinking;
+}
+
+/**
+ * @brief 도형 경로는 끊어 그릴 수 없으므로 예산과 관계없이 한 번에 그림
+ */
+uint8_t Eyes_Service(uint16_t budget_bytes)
+{
+    (void)budget_bytes;
+    Eyes_Update();
+    return 1;
+}
+
 /**
  * @brief 현재 표정 반환
  */
@@ -178,6 +837,17 @@ Expression_t Eyes_GetExpression(void)
  */
 void Eyes_Update(void)
 {
+    if (blinking)
+    {
+        if (HAL_GetTick() - blink_tick < BLINK_HOLD_MS)
+        {
+            if (dirty) Eyes_Draw(EXPR_BLINK);   // 감은 동안 화면을 덮어썼으면
+            return;
+        }
+        blinking = 0;
+        dirty = 1;
+    }
+
     if (dirty)
     {
         Eyes_Draw(current_expr);
@@ -191,3 +861,5 @@ void Eyes_Invalidate(void)
 {
     dirty = 1;
 }
+
+#endif /* EYES_USE_SPRITES */
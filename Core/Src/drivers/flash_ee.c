@@ -0,0 +1,239 @@
+/**
+ * @file flash_ee.c
+ * @brief 플래시 EEPROM 흉내 - 페이지 두 장, 레코드 덧붙이기 + 페이지 옮기기 (flash_ee.h)
+ *
+ * 페이지 머리 (하프워드 0): 상태
+ *   0xFFFF 지워짐 → 0xEEEE 받는 중 → 0x0000 활성
+ *   (F1 플래시는 지워지지 않은 하프워드에도 0x0000은 쓸 수 있어서 지우지 않고 상태를 내림)
+ * 레코드 (4바이트): [값][태그] - 값을 먼저, 태그를 나중에 써서 태그가 있는 레코드만 완성본.
+ *
+ * 옮기는 순서: 새 페이지 '받는 중' → 최신 값 복사 → 예전 페이지 지우기 → 새 페이지 '활성'.
+ * 부팅 때 (활성, 받는 중)이면 복사가 끊긴 것 → 받는 중 페이지를 버리고,
+ * (지워짐, 받는 중)이면 복사는 끝난 것 → 받는 중 페이지를 활성으로.
+ */
+
+#include "drivers/flash_ee.h"
+
+#define PAGE0           FLASH_EE_BASE
+#define PAGE1           (FLASH_EE_BASE + FLASH_EE_PAGE_SIZE)
+
+#define ST_ERASED       0xFFFFU
+#define ST_RECEIVE      0xEEEEU
+#define ST_VALID        0x0000U
+
+#define TAG_OK(t)       ((t) != 0x0000U && (t) != 0xFFFFU)
+#define HW(addr)        (*(volatile const uint16_t *)(uintptr_t)(addr))
+
+static uint32_t active;                 // 활성 페이지 (0 = 초기화 전)
+static uint32_t next;                   // 다음 빈 레코드 주소
+static uint32_t erases;
+
+/* ===== 내부 함수 ===== */
+
+static FlashEE_Result_t Program(uint32_t addr, uint16_t value)
+{
+    return (HAL_FLASH_Program(FLASH_TYPEPROGRAM_HALFWORD, addr, value) == HAL_OK) ?
+           FLASH_EE_OK : FLASH_EE_ERROR;
+}
+
+static uint8_t Blank(uint32_t page)
+{
+    for (uint32_t a = page; a < page + FLASH_EE_PAGE_SIZE; a += 2)
+        if (HW(a) != 0xFFFFU) return 0;
+    return 1;
+}
+
+/* 이미 비어 있으면 지우지 않음 (닳지 않게) */
+static FlashEE_Result_t Erase(uint32_t page)
+{
+    FLASH_EraseInitTypeDef e = { 0 };
+    uint32_t page_error;
+
+    if (Blank(page))
+        return FLASH_EE_OK;
+
+    e.TypeErase   = FLASH_TYPEERASE_PAGES;
+    e.PageAddress = page;
+    e.NbPages     = 1;
+    erases++;
+    return (HAL_FLASHEx_Erase(&e, &page_error) == HAL_OK) ? FLASH_EE_OK : FLASH_EE_ERROR;
+}
+
+static uint32_t Free_Slot(uint32_t page)
+{
+    uint32_t a = page + 4;
+
+    while (a < page + FLASH_EE_PAGE_SIZE && (HW(a) != 0xFFFFU || HW(a + 2) != 0xFFFFU))
+        a += 4;
+    return a;
+}
+
+/**
+ * @brief [page + 4, end) 안에서 tag의 가장 나중 레코드 주소 (0 = 없음)
+ */
+static uint32_t Find(uint32_t page, uint32_t end, uint16_t tag)
+{
+    for (uint32_t a = end; a > page + 4; )
+    {
+        a -= 4;
+        if (HW(a + 2) == tag) return a;
+    }
+    return 0;
+}
+
+static FlashEE_Result_t Format(void)
+{
+    active = 0;
+    if (Erase(PAGE0) != FLASH_EE_OK || Erase(PAGE1) != FLASH_EE_OK ||
+        Program(PAGE0, ST_VALID) != FLASH_EE_OK)
+        return FLASH_EE_ERROR;
+
+    active = PAGE0;
+    next   = PAGE0 + 4;
+    return FLASH_EE_OK;
+}
+
+/**
+ * @brief 활성 페이지가 찼을 때: 태그별 최신 값만 다른 페이지로
+ */
+static FlashEE_Result_t Transfer(void)
+{
+    uint32_t other = (active == PAGE0) ? PAGE1 : PAGE0;
+    uint32_t dst = other + 4;
+
+    if (Erase(other) != FLASH_EE_OK || Program(other, ST_RECEIVE) != FLASH_EE_OK)
+        return FLASH_EE_ERROR;
+
+    for (uint32_t a = next; a > active + 4; )
+    {
+        uint16_t tag;
+
+        a -= 4;
+        tag = HW(a + 2);
+        if (!TAG_OK(tag) || Find(other, dst, tag))
+            continue;
+        if (dst >= other + FLASH_EE_PAGE_SIZE)
+            return FLASH_EE_ERROR;          // 태그 종류가 페이지보다 많음
+
+        if (Program(dst, HW(a)) != FLASH_EE_OK || Program(dst + 2, tag) != FLASH_EE_OK)
+            return FLASH_EE_ERROR;
+        dst += 4;
+    }
+
+    if (Erase(active) != FLASH_EE_OK || Program(other, ST_VALID) != FLASH_EE_OK)
+        return FLASH_EE_ERROR;
+
+    active = other;
+    next   = dst;
+    return FLASH_EE_OK;
+}
+
+/**
+ * @brief 부팅 때 페이지 상태 조합 → 활성 페이지 (끊긴 옮기기 복구)
+ */
+static FlashEE_Result_t Recover(void)
+{
+    uint16_t s0 = HW(PAGE0), s1 = HW(PAGE1);
+
+    if (s0 == ST_VALID && s1 != ST_VALID)
+    {
+        active = PAGE0;
+        return Erase(PAGE1);
+    }
+    if (s1 == ST_VALID && s0 != ST_VALID)
+    {
+        active = PAGE1;
+        return Erase(PAGE0);
+    }
+    if (s0 == ST_RECEIVE && s1 == ST_ERASED)
+    {
+        active = PAGE0;
+        if (Erase(PAGE1) != FLASH_EE_OK) return FLASH_EE_ERROR;
+        return Program(PAGE0, ST_VALID);
+    }
+    if (s1 == ST_RECEIVE && s0 == ST_ERASED)
+    {
+        active = PAGE1;
+        if (Erase(PAGE0) != FLASH_EE_OK) return FLASH_EE_ERROR;
+        return Program(PAGE1, ST_VALID);
+    }
+    return Format();            // 처음 쓰는 칩 / 알 수 없는 상태
+}
+
+/* ===== 외부 API ===== */
+
+FlashEE_Result_t FlashEE_Init(void)
+{
+    FlashEE_Result_t r;
+
+    HAL_FLASH_Unlock();
+    r = Recover();
+    HAL_FLASH_Lock();
+
+    if (r != FLASH_EE_OK)
+    {
+        active = 0;
+        return r;
+    }
+    next = Free_Slot(active);
+    return FLASH_EE_OK;
+}
+
+FlashEE_Result_t FlashEE_Read(uint16_t tag, uint16_t *value)
+{
+    uint32_t a;
+
+    if (!TAG_OK(tag)) return FLASH_EE_BAD_TAG;
+    if (!active) return FLASH_EE_ERROR;
+
+    a = Find(active, next, tag);
+    if (!a) return FLASH_EE_NOT_FOUND;
+
+    *value = HW(a);
+    return FLASH_EE_OK;
+}
+
+FlashEE_Result_t FlashEE_Write(uint16_t tag, uint16_t value)
+{
+    FlashEE_Result_t r = FLASH_EE_OK;
+    uint16_t old;
+
+    if (!TAG_OK(tag)) return FLASH_EE_BAD_TAG;
+    if (!active) return FLASH_EE_ERROR;
+    if (FlashEE_Read(tag, &old) == FLASH_EE_OK && old == value) return FLASH_EE_OK;
+
+    HAL_FLASH_Unlock();
+    if (next >= active + FLASH_EE_PAGE_SIZE)
+        r = Transfer();
+    if (r == FLASH_EE_OK)
+        r = Program(next, value);
+    if (r == FLASH_EE_OK)
+        r = Program(next + 2, tag);
+    HAL_FLASH_Lock();
+
+    if (r == FLASH_EE_OK)
+        next += 4;
+    else if (active)
+        next = Free_Slot(active);       // 반쯤 쓴 레코드는 건너뜀
+    return r;
+}
+
+FlashEE_Result_t FlashEE_Format(void)
+{
+    FlashEE_Result_t r;
+
+    HAL_FLASH_Unlock();
+    r = Format();
+    HAL_FLASH_Lock();
+    return r;
+}
+
+uint16_t FlashEE_Used(void)
+{
+    return active ? (uint16_t)((next - active - 4) / 4) : 0;
+}
+
+uint32_t FlashEE_Erases(void)
+{
+    return erases;
+}
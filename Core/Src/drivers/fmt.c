@@ -0,0 +1,176 @@
+/**
+ * @file fmt.c
+ * @brief 정수 전용 서식 출력 (fmt.h)
+ *
+ * 숫자는 임시 버퍼 끝에서부터 거꾸로 채움 (나눗셈은 자릿수만큼).
+ * 폭 채우기 순서는 C와 같게: [공백][부호][0][숫자][공백('-')]
+ */
+
+#include <stdint.h>
+#include "drivers/fmt.h"
+
+#define NUM_MAX     24          // unsigned long (호스트 64비트 포함) 10진 20자리 + 여유
+
+extern int __io_putchar(int ch);
+
+typedef struct {
+    char  *p;
+    size_t room;                // 남은 칸 (끝 '\0' 포함)
+} Buf_t;
+
+/* ===== 내부 함수 ===== */
+
+static char *Utoa(char *end, unsigned long v, unsigned base, uint8_t upper)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    *--end = '\0';
+    do {
+        *--end = digits[v % base];
+        v /= base;
+    } while (v);
+    return end;
+}
+
+static void Pad(Fmt_Put_t put, void *ctx, char c, int n)
+{
+    while (n-- > 0)
+        put(ctx, c);
+}
+
+static void Put_Uart(void *ctx, char c)
+{
+    (void)ctx;
+    __io_putchar((unsigned char)c);
+}
+
+static void Put_Buf(void *ctx, char c)
+{
+    Buf_t *b = (Buf_t *)ctx;
+
+    if (b->room > 1)
+    {
+        *b->p++ = c;
+        b->room--;
+    }
+}
+
+/* ===== 외부 API ===== */
+
+int Fmt_Vformat(Fmt_Put_t put, void *ctx, const char *fmt, va_list ap)
+{
+    char num[NUM_MAX];
+    int n = 0;
+
+    while (*fmt)
+    {
+        uint8_t left = 0, zero = 0, lng = 0;
+        char sign = 0;
+        int width = 0, len = 0;
+        const char *s;
+
+        if (*fmt != '%')
+        {
+            put(ctx, *fmt++);
+            n++;
+            continue;
+        }
+        fmt++;
+
+        for (;; fmt++)
+        {
+            if (*fmt == '-')      left = 1;
+            else if (*fmt == '0') zero = 1;
+            else break;
+        }
+        while (*fmt >= '0' && *fmt <= '9')
+            width = width * 10 + (*fmt++ - '0');
+        while (*fmt == 'l')
+        {
+            lng = 1;
+            fmt++;
+        }
+
+        switch (*fmt)
+        {
+        case 'd':
+        {
+            long v = lng ? va_arg(ap, long) : va_arg(ap, int);
+
+            if (v < 0) sign = '-';
+            s = Utoa(num + NUM_MAX, (v < 0) ? 0UL - (unsigned long)v : (unsigned long)v, 10, 0);
+            break;
+        }
+        case 'u':
+        case 'x':
+        case 'X':
+        {
+            unsigned long v = lng ? va_arg(ap, unsigned long) : va_arg(ap, unsigned);
+
+            s = Utoa(num + NUM_MAX, v, (*fmt == 'u') ? 10 : 16, *fmt == 'X');
+            break;
+        }
+        case 's':
+            s = va_arg(ap, const char *);
+            if (!s) s = "(null)";
+            zero = 0;
+            break;
+        case 'c':
+            num[0] = (char)va_arg(ap, int);
+            num[1] = '\0';
+            s = num;
+            zero = 0;
+            break;
+        case '%':
+            put(ctx, '%');
+            n++;
+            fmt++;
+            continue;
+        case '\0':
+            return n;
+        default:                    // 모르는 변환 - 그대로
+            put(ctx, '%');
+            put(ctx, *fmt++);
+            n += 2;
+            continue;
+        }
+        fmt++;
+
+        while (s[len]) len++;
+        width -= len + (sign ? 1 : 0);
+
+        if (!left && !zero) Pad(put, ctx, ' ', width);
+        if (sign)           put(ctx, sign);
+        if (!left && zero)  Pad(put, ctx, '0', width);
+        for (int i = 0; i < len; i++) put(ctx, s[i]);
+        if (left)           Pad(put, ctx, ' ', width);
+
+        n += len + (sign ? 1 : 0) + (width > 0 ? width : 0);
+    }
+    return n;
+}
+
+int Fmt_Printf(const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = Fmt_Vformat(Put_Uart, NULL, fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+int Fmt_Snprintf(char *buf, size_t size, const char *fmt, ...)
+{
+    Buf_t b = { buf, size };
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = Fmt_Vformat(Put_Buf, &b, fmt, ap);
+    va_end(ap);
+    if (size)
+        *b.p = '\0';
+    return n;
+}
@@ -0,0 +1,250 @@
+/**
+ * @file heading.c
+ * @brief 제자리 회전 각도 제어 - 엔코더 한 쪽 + 2단 루프
+ *
+ * 제자리 회전은 좌/우가 같은 크기로 반대 방향이므로 엔코더 쪽 바퀴의
+ * 이동 거리 = 반지름(유효 트랙 / 2) x 회전각.
+ * 10ms마다:
+ * 0. 움직이던 중이면 먼저 멈춤 (직진 관성이 엔코더 쪽 바퀴를 회전으로 세지 않게)
+ * 1. 남은 거리 x HEADING_POS_KP → 바퀴 속도 목표 (최소/최대 속도로 제한)
+ * 2. 속도 목표 → 피드포워드(정지 마찰 + 비례) + PID → 듀티 (%)
+ * 3. 목표에 닿으면 힘을 빼고, 바퀴가 멈춘 뒤 허용 오차 밖이면 반대로 되돌아옴
+ *
+ * 고정 소수점: PID 이득은 Q12 (1.0 = 4096).
+ */
+
+#include "drivers/heading.h"
+#include "drivers/encoder.h"
+#include "drivers/motor.h"
+#include "drivers/timebase.h"
+
+#define HEADING_PERIOD_US   10000U
+#define HEADING_TIMEOUT_US  2000000U
+#define HEADING_UM_PER_DEG  ((3142UL * TRACK_EFFECTIVE_MM) / 360)  // 바퀴 이동 / 회전 1도
+
+/* 도착 판정 - 엔코더 분해능이 에지당 약 4도라 반 에지 안에서 힘을 빼고,
+ * 관성으로 더 돈 것은 허용 오차 안이면 그대로 끝냄 (넘으면 되돌아옴) */
+#define HEADING_ARRIVE_UM   (ENCODER_UM_PER_EDGE / 2)
+#define HEADING_TOL_DEG     5
+#define HEADING_TOL_UM      (HEADING_TOL_DEG * HEADING_UM_PER_DEG)
+#define HEADING_STOP_MMS    30      // 이보다 느리면 멈춘 것으로 봄
+#define HEADING_COAST_MS    40      // 힘을 뺀 뒤 관성으로 더 가는 시간 (속도 x 시간만큼 일찍 뺌)
+
+/* 위치 루프: 남은 거리 (mm) x KP = 속도 목표 (mm/s) */
+#define HEADING_POS_KP      5
+#define HEADING_V_MAX       300     // mm/s
+#define HEADING_V_MIN       60      // 이보다 느리면 4륜 스키드가 멈춤
+
+/* 속도 루프 피드포워드: 듀티 = STATIC + v x (100 - STATIC) / FULL_MMS */
+#define HEADING_FF_STATIC   25      // %
+#define HEADING_FF_FULL_MMS 400     // 듀티 100% 제자리 회전 바퀴 속도
+
+/* 속도 PID (Q12, 오차 mm/s → 듀티 %) */
+#define HEADING_KP          328     // 0.08
+#define HEADING_KI          41      // 0.01 / 주기
+#define HEADING_KD          0
+#define HEADING_I_LIMIT     40      // 적분 몫 최대 (%)
+
+typedef struct {
+    int32_t kp, ki, kd;             // Q12
+    int32_t i_sum;                  // 오차 누적 (mm/s x 주기)
+    int32_t i_max;
+    int16_t prev_meas;
+} Pid_t;
+
+static Pid_t speed_pid = { HEADING_KP, HEADING_KI, HEADING_KD, 0,
+                           (HEADING_I_LIMIT << 12) / (HEADING_KI ? HEADING_KI : 1), 0 };
+
+static HeadingStatus_t status = HEADING_IDLE;
+static int8_t   turn_sign;          // +1 / -1
+static int32_t  start_um;           // 회전 시작 때 엔코더 위치
+static int32_t  target_um;          // 엔코더 쪽 바퀴가 갈 거리 (양수)
+static uint32_t next_us;
+static uint32_t deadline_us;
+static uint8_t  coasting;           // 도착해서 힘을 뺀 상태
+static uint8_t  braking;            // 시작 전 정지 대기
+static volatile uint8_t abort_req;  // UART 명령(ISR)이 모터를 넘겨받음
+
+/* ===== 내부 함수 ===== */
+
+static int32_t Clamp(int32_t v, int32_t lo, int32_t hi)
+{
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+static void Pid_Reset(Pid_t *pid)
+{
+    pid->i_sum = 0;
+    pid->prev_meas = 0;
+}
+
+/**
+ * @brief 한 주기 (미분은 측정값에 - 목표가 바뀔 때 튀지 않게)
+ * @return 보정 듀티 (%)
+ */
+static int32_t Pid_Step(Pid_t *pid, int32_t target, int16_t meas)
+{
+    int32_t err = target - meas;
+    int32_t out;
+
+    pid->i_sum = Clamp(pid->i_sum + err, -pid->i_max, pid->i_max);
+    out = pid->kp * err + pid->ki * pid->i_sum - pid->kd * (meas - pid->prev_meas);
+    pid->prev_meas = meas;
+
+    return out / 4096;
+}
+
+/**
+ * @brief 회전 진행 거리 (um, 돌려는 방향이 +)
+ */
+static int32_t Progress_Um(void)
+{
+    return turn_sign * (Encoder_PositionUm() - start_um);
+}
+
+/**
+ * @brief 모터 출력 - ISR이 중단을 요청했으면 쓰지 않음 (ISR이 쓴 명령을 덮지 않게)
+ */
+static void Drive_Output(int8_t left, int8_t right)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (!abort_req) Motor_SetSpeed(left, right);
+    __set_PRIMASK(primask);
+}
+
+static void Turn_Finish(HeadingStatus_t result)
+{
+    Drive_Output(0, 0);
+    status = result;
+}
+
+/**
+ * @brief 제어 한 주기
+ */
+static void Control_Step(void)
+{
+    int32_t remain_um = target_um - Progress_Um();
+    int32_t remain_abs = (remain_um < 0) ? -remain_um : remain_um;
+    int16_t v_meas = turn_sign * Encoder_SpeedMmS();
+    uint8_t stopped = (v_meas < HEADING_STOP_MMS && v_meas > -HEADING_STOP_MMS);
+    int32_t coast_um = (v_meas > 0) ? v_meas * HEADING_COAST_MS : 0;
+    int32_t v_sp, duty;
+
+    if (braking)
+    {
+        if (!stopped) return;
+        braking  = 0;
+        start_um = Encoder_PositionUm();
+        remain_um = remain_abs = target_um;
+    }
+
+    /* 목표 에지에 (관성 거리 포함) 닿았거나, 힘을 뺀 뒤 허용 오차 안에서 멈춤 */
+    if ((remain_um <= (int32_t)HEADING_ARRIVE_UM + coast_um && remain_um >= -(int32_t)HEADING_ARRIVE_UM) ||
+        (coasting && remain_abs <= (int32_t)HEADING_TOL_UM))
+    {
+        if (stopped)
+        {
+            Turn_Finish(HEADING_DONE);
+            return;
+        }
+        Drive_Output(0, 0);
+        Pid_Reset(&speed_pid);
+        coasting = 1;
+        return;
+    }
+
+    /* 관성으로 지나친 만큼은 바퀴가 멈춘 뒤에 되돌림 (1채널이라 도는 중 역방향은 못 셈) */
+    if (coasting && !stopped) return;
+    coasting = 0;
+
+    v_sp = Clamp(remain_um / 1000 * HEADING_POS_KP, -HEADING_V_MAX, HEADING_V_MAX);
+    if (v_sp >= 0 && v_sp < HEADING_V_MIN)  v_sp = HEADING_V_MIN;
+    if (v_sp < 0 && v_sp > -HEADING_V_MIN)  v_sp = -HEADING_V_MIN;
+
+    duty = v_sp * (100 - HEADING_FF_STATIC) / HEADING_FF_FULL_MMS;
+    duty += (v_sp > 0) ? HEADING_FF_STATIC : -HEADING_FF_STATIC;
+    duty += Pid_Step(&speed_pid, v_sp, v_meas);
+    duty = Clamp(duty, -MOTOR_SPEED_MAX, MOTOR_SPEED_MAX);
+
+    Drive_Output((int8_t)(turn_sign * duty), (int8_t)(-turn_sign * duty));
+}
+
+/* ===== 외부 API ===== */
+
+void Heading_Init(void)
+{
+    status = HEADING_IDLE;
+    abort_req = 0;
+    Pid_Reset(&speed_pid);
+}
+
+/**
+ * @brief deg만큼 회전 시작 (진행 중이면 지금 위치에서 다시 시작)
+ */
+void Heading_TurnBy(int16_t deg)
+{
+    if (deg == 0)
+    {
+        status = HEADING_DONE;
+        return;
+    }
+
+    turn_sign   = (deg > 0) ? 1 : -1;
+    target_um   = (int32_t)(turn_sign * deg) * (int32_t)HEADING_UM_PER_DEG;
+    start_um    = Encoder_PositionUm();
+    braking     = (Encoder_SpeedMmS() != 0);
+    next_us     = Timebase_Us();
+    deadline_us = Timebase_Deadline(HEADING_TIMEOUT_US);
+    Pid_Reset(&speed_pid);
+    coasting  = 0;
+    abort_req = 0;
+    if (braking) Drive_Output(0, 0);
+    status = HEADING_TURNING;
+}
+
+/**
+ * @brief 회전 중단 (ISR에서도 호출 가능) - 모터는 건드리지 않음, 호출한 쪽이 새 명령을 씀
+ */
+void Heading_Abort(void)
+{
+    abort_req = 1;
+}
+
+void Heading_Update(void)
+{
+    if (status != HEADING_TURNING) return;
+    if (abort_req)
+    {
+        status = HEADING_IDLE;
+        return;
+    }
+    if (!Timebase_Expired(next_us)) return;
+
+    next_us += HEADING_PERIOD_US;
+    if (Timebase_Expired(next_us)) next_us = Timebase_Deadline(HEADING_PERIOD_US);   // 밀렸으면 건너뜀
+
+    if (Timebase_Expired(deadline_us))
+    {
+        Turn_Finish(HEADING_TIMEOUT);
+        return;
+    }
+
+    Control_Step();
+}
+
+HeadingStatus_t Heading_Status(void)
+{
+    return status;
+}
+
+uint8_t Heading_Busy(void)
+{
+    return status == HEADING_TURNING;
+}
+
+int16_t Heading_TurnedDeg(void)
+{
+    return (int16_t)(turn_sign * (Progress_Um() / (int32_t)HEADING_UM_PER_DEG));
+}
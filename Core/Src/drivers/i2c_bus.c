@@ -0,0 +1,330 @@
+/**
+ * @file i2c_bus.c
+ * @brief I2C1 트랜잭션 큐 - 인터럽트 완료 + 재시도 제한 + 버스 복구
+ *
+ * 동작:
+ * 1. I2CBus_Submit: 데이터를 큐에 복사하고 버스가 놀고 있으면 바로 시작
+ * 2. 완료 인터럽트: 통계 기록 후 다음 전송을 바로 시작
+ * 3. 오류 인터럽트: 버스를 멈추고 I2CBus_Poll에 처리를 넘김
+ * 4. I2CBus_Poll: 타임아웃 감시, 버스 오류면 SCL 9클럭 + STOP으로 복구,
+ *    재시도 (1ms x 횟수 간격), 재시도 초과면 버리고 콜백
+ *
+ * 어떤 경우에도 메인 루프를 기다리게 하지 않음 (I2CBus_Wait 제외).
+ */
+
+#include "drivers/i2c_bus.h"
+#include "drivers/timebase.h"
+
+/* ===== 복구용 핀 (stm32f1xx_hal_msp.c I2C1 설정과 같음) ===== */
+#define BUS_SCL_PORT    GPIOB
+#define BUS_SCL_PIN     GPIO_PIN_6
+#define BUS_SDA_PORT    GPIOB
+#define BUS_SDA_PIN     GPIO_PIN_7
+#define BUS_RECOVER_CLOCKS  9
+
+typedef enum {
+    BUS_IDLE = 0,
+    BUS_BUSY,
+    BUS_ERROR
+} BusState_t;
+
+typedef struct {
+    uint16_t addr;
+    uint8_t  len;
+    uint8_t  tries;             // 실패 횟수
+    uint8_t  dev;               // 통계 슬롯 (0xFF = 없음)
+    uint32_t t_submit;          // Timebase us
+    uint32_t tag;
+    I2CBus_FailCb_t on_fail;
+    uint8_t  data[I2CBUS_MAX_DATA];
+} I2CJob_t;
+
+static I2C_HandleTypeDef *bus;
+
+static I2CJob_t jobs[I2CBUS_QUEUE_LEN];
+static volatile uint8_t q_head;             // 진행 중(또는 다음) 전송
+static volatile uint8_t q_count;
+
+static volatile BusState_t bus_state = BUS_IDLE;
+static volatile uint32_t bus_error;         // HAL_I2C_ERROR_*
+static uint32_t t_deadline_us;              // 현재 전송 타임아웃 시각
+static uint32_t hold_until_us;              // 재시도 대기
+
+static I2CBus_DevStats_t dev_stats[I2CBUS_MAX_DEVICES];
+static uint8_t dev_count;
+static uint32_t recoveries;
+
+/* ===== 내부 함수 ===== */
+
+static uint8_t Dev_Slot(uint16_t addr)
+{
+    for (uint8_t i = 0; i < dev_count; i++)
+        if (dev_stats[i].addr == addr) return i;
+
+    if (dev_count >= I2CBUS_MAX_DEVICES) return 0xFF;
+
+    dev_stats[dev_count].addr = addr;
+    return dev_count++;
+}
+
+/**
+ * @brief 큐 맨 앞 전송 시작 (IRQ 금지 상태 또는 ISR에서 호출)
+ */
+static void Bus_Kick(void)
+{
+    I2CJob_t *job;
+
+    if (bus_state != BUS_IDLE || q_count == 0) return;
+    if (!Timebase_Expired(hold_until_us)) return;
+
+    job = &jobs[q_head];
+    bus_state     = BUS_BUSY;
+    t_deadline_us = Timebase_Deadline(I2CBUS_TIMEOUT_MS * 1000U);
+
+    if (HAL_I2C_Master_Transmit_IT(bus, job->addr, job->data, job->len) != HAL_OK)
+    {
+        /* 핸들이 BUSY (버스 BUSY 플래그 고착 등) - Poll에서 복구 */
+        bus_error = HAL_I2C_ERROR_TIMEOUT;
+        bus_state = BUS_ERROR;
+    }
+}
+
+static void Queue_Pop(void)
+{
+    q_head = (q_head + 1) % I2CBUS_QUEUE_LEN;
+    q_count--;
+}
+
+/**
+ * @brief 짧은 대기 (5us, 100kHz 반주기) - 버스 복구 전용
+ */
+static void Bus_Delay(void)
+{
+    Timebase_DelayUs(5);
+}
+
+/**
+ * @brief 버스 복구: 슬레이브가 SDA를 잡고 있으면 SCL을 최대 9번 쳐서 풀고 STOP 생성
+ * @note  주변장치를 DeInit 했다가 다시 Init (Init이 SWRST로 BUSY 고착도 해제)
+ */
+static void Bus_Recover(void)
+{
+    GPIO_InitTypeDef gpio = {0};
+
+    HAL_I2C_DeInit(bus);
+
+    __HAL_RCC_GPIOB_CLK_ENABLE();
+    HAL_GPIO_WritePin(BUS_SCL_PORT, BUS_SCL_PIN, GPIO_PIN_SET);
+    HAL_GPIO_WritePin(BUS_SDA_PORT, BUS_SDA_PIN, GPIO_PIN_SET);
+
+    gpio.Pin   = BUS_SCL_PIN | BUS_SDA_PIN;
+    gpio.Mode  = GPIO_MODE_OUTPUT_OD;
+    gpio.Pull  = GPIO_NOPULL;
+    gpio.Speed = GPIO_SPEED_FREQ_HIGH;
+    HAL_GPIO_Init(BUS_SCL_PORT, &gpio);
+
+    for (uint8_t i = 0; i < BUS_RECOVER_CLOCKS; i++)
+    {
+        if (HAL_GPIO_ReadPin(BUS_SDA_PORT, BUS_SDA_PIN) == GPIO_PIN_SET) break;
+
+        HAL_GPIO_WritePin(BUS_SCL_PORT, BUS_SCL_PIN, GPIO_PIN_RESET);
+        Bus_Delay();
+        HAL_GPIO_WritePin(BUS_SCL_PORT, BUS_SCL_PIN, GPIO_PIN_SET);
+        Bus_Delay();
+    }
+
+    /* STOP: SCL high 상태에서 SDA low → high */
+    HAL_GPIO_WritePin(BUS_SCL_PORT, BUS_SCL_PIN, GPIO_PIN_RESET);
+    Bus_Delay();
+    HAL_GPIO_WritePin(BUS_SDA_PORT, BUS_SDA_PIN, GPIO_PIN_RESET);
+    Bus_Delay();
+    HAL_GPIO_WritePin(BUS_SCL_PORT, BUS_SCL_PIN, GPIO_PIN_SET);
+    Bus_Delay();
+    HAL_GPIO_WritePin(BUS_SDA_PORT, BUS_SDA_PIN, GPIO_PIN_SET);
+    Bus_Delay();
+
+    HAL_I2C_Init(bus);     // MspInit이 핀을 다시 AF_OD로
+    recoveries++;
+}
+
+/* ===== HAL 콜백 (ISR) ===== */
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    I2CJob_t *job;
+
+    if (hi2c != bus || bus_state != BUS_BUSY) return;
+
+    job = &jobs[q_head];
+    if (job->dev != 0xFF)
+    {
+        I2CBus_DevStats_t *st = &dev_stats[job->dev];
+        uint32_t us = Timebase_Elapsed(job->t_submit);
+
+        st->ok++;
+        st->lat_last_us = us;
+        if (us > st->lat_max_us) st->lat_max_us = us;
+        st->lat_avg_us = st->lat_avg_us ? st->lat_avg_us + ((int32_t)(us - st->lat_avg_us) >> 3) : us;
+    }
+
+    Queue_Pop();
+    bus_state = BUS_IDLE;
+    Bus_Kick();
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c != bus) return;
+
+    bus_error = HAL_I2C_GetError(hi2c);
+    bus_state = BUS_ERROR;
+}
+
+/* ===== 외부 API ===== */
+
+void I2CBus_Init(I2C_HandleTypeDef *hi2c)
+{
+    bus = hi2c;
+    q_head = q_count = 0;
+    bus_state = BUS_IDLE;
+    hold_until_us = Timebase_Us();
+}
+
+/**
+ * @brief 전송 제출 (블로킹 없음)
+ * @param on_fail 재시도 초과로 버릴 때 호출 (NULL 가능), tag는 그대로 전달
+ */
+I2CBus_Result_t I2CBus_Submit(uint16_t addr, const uint8_t *data, uint8_t len,
+                              I2CBus_FailCb_t on_fail, uint32_t tag)
+{
+    uint32_t primask;
+    I2CJob_t *job;
+
+    if (len > I2CBUS_MAX_DATA) return I2CBUS_TOO_LONG;
+    if (q_count >= I2CBUS_QUEUE_LEN) return I2CBUS_FULL;
+
+    /* 꼬리 슬롯은 ISR이 건드리지 않으므로 채우는 동안은 IRQ 허용 */
+    job = &jobs[(q_head + q_count) % I2CBUS_QUEUE_LEN];
+    job->addr     = addr;
+    job->len      = len;
+    job->tries    = 0;
+    job->dev      = Dev_Slot(addr);
+    job->t_submit = Timebase_Us();
+    job->tag      = tag;
+    job->on_fail  = on_fail;
+    for (uint8_t i = 0; i < len; i++) job->data[i] = data[i];
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    q_count++;
+    Bus_Kick();
+    __set_PRIMASK(primask);
+
+    return I2CBUS_OK;
+}
+
+/**
+ * @brief 타임아웃 감시 / 오류 처리 / 재시도 (메인 루프에서 매번 호출)
+ */
+void I2CBus_Poll(void)
+{
+    uint32_t primask;
+    I2CJob_t *job;
+    uint32_t err;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (bus_state == BUS_BUSY && Timebase_Expired(t_deadline_us))
+    {
+        bus_error = HAL_I2C_ERROR_TIMEOUT;
+        bus_state = BUS_ERROR;
+    }
+    __set_PRIMASK(primask);
+
+    if (bus_state != BUS_ERROR)
+    {
+        /* 재시도 대기가 끝났으면 시작 */
+        primask = __get_PRIMASK();
+        __disable_irq();
+        Bus_Kick();
+        __set_PRIMASK(primask);
+        return;
+    }
+
+    job = &jobs[q_head];
+    err = bus_error;
+
+    if (job->dev != 0xFF)
+    {
+        I2CBus_DevStats_t *st = &dev_stats[job->dev];
+
+        if (err == HAL_I2C_ERROR_AF)           st->nack++;
+        else if (err & HAL_I2C_ERROR_TIMEOUT)  st->timeout++;
+        else                                   st->bus_err++;
+    }
+
+    /* NACK은 HAL이 STOP을 보내고 끝냄. 그 외에는 버스 상태를 믿을 수 없으므로 복구 */
+    if (err != HAL_I2C_ERROR_AF || bus->State != HAL_I2C_STATE_READY)
+        Bus_Recover();
+
+    job->tries++;
+    if (job->tries > I2CBUS_MAX_RETRIES)
+    {
+        if (job->dev != 0xFF) dev_stats[job->dev].dropped++;
+        if (job->on_fail) job->on_fail(job->tag);
+
+        primask = __get_PRIMASK();
+        __disable_irq();
+        Queue_Pop();
+        __set_PRIMASK(primask);
+        hold_until_us = Timebase_Us();
+    }
+    else
+    {
+        if (job->dev != 0xFF) dev_stats[job->dev].retries++;
+        hold_until_us = Timebase_Deadline(job->tries * 1000U);    // 1ms, 2ms ...
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    bus_error = HAL_I2C_ERROR_NONE;
+    bus_state = BUS_IDLE;
+    Bus_Kick();
+    __set_PRIMASK(primask);
+}
+
+uint8_t I2CBus_Idle(void)
+{
+    return (q_count == 0) && (bus_state == BUS_IDLE);
+}
+
+/**
+ * @brief 큐가 빌 때까지 기다림 (부팅 시 초기화 시퀀스 전용)
+ * @return 1 = 비었음, 0 = 시간 초과
+ */
+uint8_t I2CBus_Wait(uint32_t timeout_ms)
+{
+    uint32_t deadline = Timebase_Deadline(timeout_ms * 1000U);
+
+    while (!I2CBus_Idle())
+    {
+        if (Timebase_Expired(deadline)) return 0;
+        I2CBus_Poll();
+    }
+    return 1;
+}
+
+uint8_t I2CBus_DeviceCount(void)
+{
+    return dev_count;
+}
+
+const I2CBus_DevStats_t *I2CBus_Stats(uint8_t index)
+{
+    return (index < dev_count) ? &dev_stats[index] : 0;
+}
+
+uint32_t I2CBus_Recoveries(void)
+{
+    return recoveries;
+}
@@ -6,10 +6,20 @@
  * 1. FillCircle: 수평선 기반 (픽셀 단위 → 라인 단위)
  * 2. RoundRect: 중복 영역 제거
  * 3. ThickLine: Bresenham 알고리즘 적용
+ * 4. 래스터 루프(원, 둥근 사각형, 굵은 선)는 도형 눈(eyes.c)을 쓰는 빌드에서만 SRAM에서 실행 -
+ *    기본 스프라이트 눈은 이 함수들을 부르지 않으므로 SRAM을 쓰지 않음 (플래시)
  */
 
 #include "drivers/lcd_gfx.h"
 #include "drivers/lcd_st7735.h"
+#include "drivers/eyes.h"
+#include "drivers/ramfunc.h"
+
+#if !EYES_USE_SPRITES || defined(EYES_KEEP_PROCEDURAL)
+#define GFX_RAMFUNC     RAMFUNC
+#else
+#define GFX_RAMFUNC
+#endif
 
 /**
  * @brief 사각형 채우기
@@ -44,7 +54,7 @@ static inline void LCD_HLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 /**
  * @brief 원 채우기 - 수평선 기반 (10배 이상 빠름)
  */
-void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+GFX_RAMFUNC void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
     int16_t x = r;
     int16_t y = 0;
@@ -81,7 +91,7 @@ void LCD_FillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 /**
  * @brief 둥근 모서리 사각형 - 최적화
  */
-void LCD_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+GFX_RAMFUNC void LCD_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
 {
     if (r > w / 2) r = w / 2;
     if (r > h / 2) r = h / 2;
@@ -137,7 +147,7 @@ void LCD_RoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16
 /**
  * @brief 두꺼운 선 - Bresenham 알고리즘
  */
-void LCD_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
+GFX_RAMFUNC void LCD_ThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t t, uint16_t color)
 {
     int16_t dx = (x1 > x0) ? (x1 - x0) : (x0 - x1);
     int16_t dy = (y1 > y0) ? (y1 - y0) : (y0 - y1);
@@ -0,0 +1,232 @@
+/**
+ * @file lcd_i2c.c
+ * @brief HD44780 문자 LCD (PCF8574 I2C 백팩) - 섀도 버퍼 + 변경 칸만 전송
+ *
+ * 최적화 내용:
+ * 1. 쓰기는 섀도 버퍼에만, LCD_FLUSH에서 패널에 있는 내용과 비교
+ * 2. 바뀐 칸 묶음마다 커서 이동 1회 (연속 칸은 자동 증가 주소 사용,
+ *    이미 그 주소에 있으면 생략)
+ * 3. 글자 하나의 니블 4바이트(EN 상승/하강 x 상위/하위)를 묶음 단위로
+ *    I2C 전송 1회에 담음 - 바이트 간격(100kHz에서 ~90us)이 EN 펄스 폭과
+ *    HD44780 명령 실행 시간(37us)보다 길어서 별도 지연이 필요 없음
+ * 4. 전송은 i2c_bus 큐로 (블로킹 없음). 재시도까지 실패한 묶음은
+ *    콜백에서 다시 보낼 칸으로 표시
+ */
+
+#include "drivers/lcd_i2c.h"
+#include "drivers/i2c_bus.h"
+
+/* ===== PCF8574 비트 ===== */
+#define PCF_RS          0x01
+#define PCF_EN          0x04
+#define PCF_BACKLIGHT   0x08
+
+#define LCD_CMD_CLEAR   0x01
+#define LCD_CMD_ENTRY   0x06    // 주소 자동 증가
+#define LCD_CMD_DISPLAY 0x0C    // 표시 ON, 커서 OFF
+#define LCD_CMD_FUNC    0x28    // 4비트, 2줄
+#define LCD_CMD_DDRAM   0x80
+
+#define INIT_WAIT_MS    50      // 초기화 명령 하나 최대 대기 (재시도 포함)
+#define STALE_CELL      0       // 패널 내용을 모르는 칸 (어떤 글자와도 다름)
+
+/* 커서 이동 1회 + 한 줄 전체 글자 */
+#define TX_MAX          (4 * (1 + LCD_I2C_COLS))
+
+#if TX_MAX > I2CBUS_MAX_DATA
+#error "I2CBUS_MAX_DATA가 HD44780 한 줄 전송보다 작음"
+#endif
+
+static const uint8_t row_addr[4] = { 0x00, 0x40, 0x14, 0x54 };
+
+static char want[LCD_I2C_ROWS][LCD_I2C_COLS];   // 그려야 할 내용
+static char shown[LCD_I2C_ROWS][LCD_I2C_COLS];  // 패널에 있는 내용
+static uint8_t cur_x, cur_y;                    // 섀도 쓰기 위치
+static int8_t  panel_addr = -1;                 // 패널 DDRAM 주소 (-1 = 모름)
+
+static uint8_t tx_buf[TX_MAX];
+static uint8_t tx_len;
+
+/* ===== 내부 함수 ===== */
+
+/**
+ * @brief 바이트 하나(명령/데이터)를 니블 4바이트로 버퍼에 추가
+ */
+static void Tx_Byte(uint8_t value, uint8_t rs)
+{
+    uint8_t hi = (value & 0xF0) | rs | PCF_BACKLIGHT;
+    uint8_t lo = ((value << 4) & 0xF0) | rs | PCF_BACKLIGHT;
+
+    tx_buf[tx_len++] = hi | PCF_EN;
+    tx_buf[tx_len++] = hi;
+    tx_buf[tx_len++] = lo | PCF_EN;
+    tx_buf[tx_len++] = lo;
+}
+
+/**
+ * @brief 재시도까지 실패한 묶음 → 다시 보낼 칸으로 표시
+ * @param tag  y | x0 << 8 | x1 << 16
+ */
+static void Tx_Failed(uint32_t tag)
+{
+    uint8_t y  = tag & 0xFF;
+    uint8_t x0 = (tag >> 8) & 0xFF;
+    uint8_t x1 = (tag >> 16) & 0xFF;
+
+    for (uint8_t x = x0; x < x1; x++)
+        shown[y][x] = STALE_CELL;
+    panel_addr = -1;
+}
+
+static I2CBus_Result_t Tx_Send(uint32_t tag)
+{
+    I2CBus_Result_t ret = I2CBUS_OK;
+
+    if (tx_len > 0)
+        ret = I2CBus_Submit(LCD_I2C_ADDR, tx_buf, tx_len, Tx_Failed, tag);
+    tx_len = 0;
+    return ret;
+}
+
+/**
+ * @brief 초기화 명령 전송 후 완료까지 대기 (부팅 시에만)
+ */
+static void Tx_SendWait(void)
+{
+    Tx_Send(0);
+    I2CBus_Wait(INIT_WAIT_MS);
+}
+
+/**
+ * @brief 초기화용 명령 (상위 니블만, 8비트 모드에서 전송)
+ */
+static void Cmd_Nibble(uint8_t nibble)
+{
+    tx_buf[0] = (nibble << 4) | PCF_EN | PCF_BACKLIGHT;
+    tx_buf[1] = (nibble << 4) | PCF_BACKLIGHT;
+    tx_len = 2;
+    Tx_SendWait();
+}
+
+static void Cmd(uint8_t cmd)
+{
+    Tx_Byte(cmd, 0);
+    Tx_SendWait();
+}
+
+/**
+ * @brief 한 줄에서 바뀐 칸 묶음 [x0, x1) 큐에 제출
+ * @return 0 = 큐가 참 (남은 칸은 다음 Flush에서)
+ */
+static uint8_t Flush_Run(uint8_t y, uint8_t x0, uint8_t x1)
+{
+    uint8_t addr = row_addr[y] + x0;
+
+    if (panel_addr != (int8_t)addr)
+        Tx_Byte(LCD_CMD_DDRAM | addr, 0);
+
+    for (uint8_t x = x0; x < x1; x++)
+        Tx_Byte((uint8_t)want[y][x], PCF_RS);
+
+    if (Tx_Send(y | (x0 << 8) | ((uint32_t)x1 << 16)) != I2CBUS_OK)
+        return 0;
+
+    /* 보낸 것으로 보고 갱신 - 실패하면 Tx_Failed가 되돌림 */
+    for (uint8_t x = x0; x < x1; x++)
+        shown[y][x] = want[y][x];
+    panel_addr = addr + (x1 - x0);
+    return 1;
+}
+
+/* ===== 외부 API ===== */
+
+/**
+ * @brief 패널 초기화 (4비트 모드 진입 시퀀스)
+ */
+void LCD_INIT(void)
+{
+    HAL_Delay(100);
+    Cmd_Nibble(0x03); HAL_Delay(5);
+    Cmd_Nibble(0x03); HAL_Delay(1);
+    Cmd_Nibble(0x03); HAL_Delay(1);
+    Cmd_Nibble(0x02); HAL_Delay(1);
+
+    Cmd(LCD_CMD_FUNC);
+    Cmd(0x08);                  // 표시 OFF
+    Cmd(LCD_CMD_CLEAR);
+    HAL_Delay(3);
+    Cmd(LCD_CMD_ENTRY);
+    Cmd(LCD_CMD_DISPLAY);
+
+    for (uint8_t y = 0; y < LCD_I2C_ROWS; y++)
+    {
+        for (uint8_t x = 0; x < LCD_I2C_COLS; x++)
+        {
+            want[y][x]  = ' ';
+            shown[y][x] = ' ';
+        }
+    }
+    panel_addr = 0;
+    cur_x = cur_y = 0;
+}
+
+/**
+ * @brief 섀도를 공백으로 (패널에는 LCD_FLUSH에서 바뀐 칸만 반영)
+ */
+void LCD_CLEAR(void)
+{
+    for (uint8_t y = 0; y < LCD_I2C_ROWS; y++)
+        for (uint8_t x = 0; x < LCD_I2C_COLS; x++)
+            want[y][x] = ' ';
+    cur_x = cur_y = 0;
+}
+
+void LCD_XY(char x, char y)
+{
+    cur_x = (uint8_t)x;
+    cur_y = (uint8_t)y;
+}
+
+/**
+ * @brief 섀도에 문자열 쓰기 (줄 끝을 넘는 글자는 버림)
+ */
+void LCD_PUTS(char *str)
+{
+    if (cur_y >= LCD_I2C_ROWS) return;
+
+    while (*str && cur_x < LCD_I2C_COLS)
+        want[cur_y][cur_x++] = *str++;
+}
+
+/**
+ * @brief 패널과 다른 칸만 전송
+ * @note  변경 없으면 I2C 트랜잭션 0회. 큐가 차면 나머지는 다음 호출에서
+ */
+void LCD_FLUSH(void)
+{
+    for (uint8_t y = 0; y < LCD_I2C_ROWS; y++)
+    {
+        uint8_t x = 0;
+
+        while (x < LCD_I2C_COLS)
+        {
+            if (want[y][x] == shown[y][x]) { x++; continue; }
+
+            uint8_t x0 = x, x1 = x;
+
+            /* 같은 칸 1개 사이의 묶음은 합침 (다시 쓰는 비용 = 커서 이동 비용) */
+            while (x < LCD_I2C_COLS)
+            {
+                if (want[y][x] != shown[y][x])
+                    x1 = ++x;
+                else if (x + 1 < LCD_I2C_COLS && want[y][x + 1] != shown[y][x + 1])
+                    x++;
+                else
+                    break;
+            }
+
+            if (!Flush_Run(y, x0, x1)) return;
+            x = x1;
+        }
+    }
+}
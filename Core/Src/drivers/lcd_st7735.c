@@ -6,10 +6,12 @@
  * 1. DMA 전송 지원 (선택적)
  * 2. 버퍼 기반 bulk 전송
  * 3. CS 토글 최소화
+ * 4. 버퍼 채우기 / 바이트 스왑 루프는 SRAM에서 실행 (RAMFUNC)
  */
 
 #include "drivers/lcd_st7735.h"
 #include "stm32f1xx_hal.h"
+#include "drivers/ramfunc.h"
 
 extern SPI_HandleTypeDef hspi2;
 
@@ -38,6 +40,7 @@ extern SPI_HandleTypeDef hspi2;
 /* ===== 전송 버퍼 (스택 절약을 위해 static) ===== */
 #define TX_BUF_SIZE 128
 static uint8_t tx_buf[TX_BUF_SIZE];
+static uint16_t stream_len = 0;     // 스트림 모드에서 tx_buf에 쌓인 바이트 수
 
 /* ===== 내부 함수 ===== */
 
@@ -84,7 +87,7 @@ void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 /**
  * @brief 색상을 count개 연속 출력 (버퍼 기반 bulk 전송)
  */
-void LCD_WriteColorFast(uint16_t color, uint32_t count)
+RAMFUNC void LCD_WriteColorFast(uint16_t color, uint32_t count)
 {
     uint8_t hi = color >> 8;
     uint8_t lo = color & 0xFF;
@@ -120,7 +123,7 @@ void LCD_WriteColorFast(uint16_t color, uint32_t count)
 /**
  * @brief 색상 배열을 직접 전송 (이미지 출력용)
  */
-void LCD_WriteBuffer(uint16_t *buf, uint32_t count)
+RAMFUNC void LCD_WriteBuffer(uint16_t *buf, uint32_t count)
 {
     LCD_DC_HIGH();
     LCD_CS_LOW();
@@ -144,6 +147,53 @@ void LCD_WriteBuffer(uint16_t *buf, uint32_t count)
     LCD_CS_HIGH();
 }
 
+/**
+ * @brief 스트림 시작 (LCD_SetWindow 직후 호출)
+ * @note  CS를 LCD_StreamEnd()까지 유지하므로 run 단위 CS 토글이 없음
+ */
+void LCD_StreamBegin(void)
+{
+    stream_len = 0;
+    LCD_DC_HIGH();
+    LCD_CS_LOW();
+}
+
+/**
+ * @brief 같은 색상 count개를 스트림에 추가 (버퍼가 차면 전송)
+ */
+RAMFUNC void LCD_StreamColor(uint16_t color, uint32_t count)
+{
+    uint8_t hi = color >> 8;
+    uint8_t lo = color & 0xFF;
+
+    while (count > 0)
+    {
+        tx_buf[stream_len++] = hi;
+        tx_buf[stream_len++] = lo;
+        count--;
+
+        if (stream_len >= TX_BUF_SIZE)
+        {
+            HAL_SPI_Transmit(&hspi2, tx_buf, TX_BUF_SIZE, HAL_MAX_DELAY);
+            stream_len = 0;
+        }
+    }
+}
+
+/**
+ * @brief 남은 버퍼 전송 후 스트림 종료
+ */
+void LCD_StreamEnd(void)
+{
+    if (stream_len > 0)
+    {
+        HAL_SPI_Transmit(&hspi2, tx_buf, stream_len, HAL_MAX_DELAY);
+        stream_len = 0;
+    }
+
+    LCD_CS_HIGH();
+}
+
 void LCD_Clear(uint16_t color)
 {
     LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
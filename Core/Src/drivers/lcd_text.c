@@ -0,0 +1,193 @@
+/**
+ * @file lcd_text.c
+ * @brief ST7735 텍스트 출력 - 글리프 span 캐시 + 바뀐 글자만 다시 그리기
+ *
+ * 구성:
+ * 1. 글리프 캐시: 열 단위 폰트를 행별 run(배경/글자색 번갈아) 목록으로 펼쳐 보관
+ * 2. 문자열 한 묶음 = 윈도우 1개, 행마다 글리프 run을 이어서 스트림 전송
+ * 3. 텍스트 필드: 이전 내용과 비교해서 바뀐 글자 묶음만 전송
+ */
+
+#include "drivers/lcd_text.h"
+#include "drivers/lcd_st7735.h"
+
+/* ===== 글리프 캐시 =====
+ * 2-way 집합 연관: 글리프 번호 하위 4비트로 집합, 집합마다 최근에 안 쓴 쪽을 교체.
+ * LCD_DrawText는 행마다 글자를 다시 찾으므로 한 문자열 안에서 같은 집합 글자가 ways보다 많으면
+ * 매 글자 다시 펼침 - ' '/'0', 'A'/'1', 'S'/'c'/'3'처럼 하위 비트가 같은 글자가 상태 표시줄에
+ * 섞여 있어서 직접 사상(16칸)은 줄마다 밀어냈음. 상태 표시줄 문자열은 어느 집합에도 2글자 이하.
+ * 행마다 run 길이를 니블로 저장: 첫 run은 배경색, 이후 번갈아 글자색/배경색.
+ * 첫 픽셀이 켜져 있으면 길이 0 배경 run이 붙으므로 6픽셀 셀은 최대 7 run.
+ */
+#define GLYPH_CACHE_SETS    16
+#define GLYPH_CACHE_WAYS    2       // 교체 대상 = 방금 안 쓴 쪽 (way ^ 1)
+#define GLYPH_MAX_RUNS      (LCD_FONT_CELL_W + 2)  // 니블 짝수 개로 올림
+
+typedef struct {
+    uint8_t code;                                   // 글리프 번호 + 1 (0 = 빈 슬롯)
+    uint8_t n[LCD_FONT_CELL_H];                     // 행별 run 수
+    uint8_t run[LCD_FONT_CELL_H][GLYPH_MAX_RUNS / 2];
+} GlyphSpans_t;
+
+static GlyphSpans_t glyph_cache[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS];
+static uint8_t glyph_victim[GLYPH_CACHE_SETS];      // 다음에 바꿀 way
+
+/* ===== 내부 함수 ===== */
+
+static uint8_t Glyph_Index(uint8_t ch)
+{
+    if (ch == 0xDF) ch = LCD_FONT_LAST;             // HD44780 ° 코드
+    if (ch < LCD_FONT_FIRST || ch > LCD_FONT_LAST) ch = '?';
+    return ch - LCD_FONT_FIRST;
+}
+
+/**
+ * @brief 글리프를 행별 run 목록으로 펼침 (캐시에 없을 때만)
+ */
+static const GlyphSpans_t *Glyph_Get(uint8_t ch)
+{
+    uint8_t idx = Glyph_Index(ch);
+    uint8_t set = idx % GLYPH_CACHE_SETS;
+    const uint8_t *cols = lcd_font5x7[idx];
+    GlyphSpans_t *g;
+
+    /* 글자 대신 글리프 번호로 기억 (대체 글자 '?'와 0xDF도 같은 항목 공유) */
+    for (uint8_t w = 0; w < GLYPH_CACHE_WAYS; w++)
+    {
+        if (glyph_cache[set][w].code == idx + 1)
+        {
+            glyph_victim[set] = w ^ 1U;
+            return &glyph_cache[set][w];
+        }
+    }
+
+    g = &glyph_cache[set][glyph_victim[set]];
+    glyph_victim[set] ^= 1U;
+
+    for (uint8_t row = 0; row < LCD_FONT_CELL_H; row++)
+    {
+        uint8_t n = 0, len = 0, on = 0;
+
+        for (uint8_t i = 0; i < GLYPH_MAX_RUNS / 2; i++) g->run[row][i] = 0;
+
+        for (uint8_t x = 0; x < LCD_FONT_CELL_W; x++)
+        {
+            uint8_t bit = (x < LCD_FONT_W) ? ((cols[x] >> row) & 1) : 0;
+
+            if (bit != on)
+            {
+                g->run[row][n / 2] |= len << ((n & 1) * 4);
+                n++;
+                len = 0;
+                on = bit;
+            }
+            len++;
+        }
+        g->run[row][n / 2] |= len << ((n & 1) * 4);
+        g->n[row] = n + 1;
+    }
+
+    g->code = idx + 1;
+    return g;
+}
+
+/* ===== 외부 API ===== */
+
+/**
+ * @brief 문자열 n글자를 윈도우 하나로 그리기
+ * @note  화면 밖으로 나가는 글자는 잘라냄 (셀 단위)
+ */
+void LCD_DrawText(int16_t x, int16_t y, const char *str, uint8_t n, uint16_t fg, uint16_t bg)
+{
+    if (x < 0 || y < 0 || y + LCD_FONT_CELL_H > LCD_HEIGHT) return;
+    if (x + n * LCD_FONT_CELL_W > LCD_WIDTH) n = (LCD_WIDTH - x) / LCD_FONT_CELL_W;
+    if (n == 0) return;
+
+    LCD_SetWindow(x, y, x + n * LCD_FONT_CELL_W - 1, y + LCD_FONT_CELL_H - 1);
+    LCD_StreamBegin();
+
+    for (uint8_t row = 0; row < LCD_FONT_CELL_H; row++)
+    {
+        for (uint8_t i = 0; i < n; i++)
+        {
+            const GlyphSpans_t *g = Glyph_Get((uint8_t)str[i]);
+
+            for (uint8_t k = 0; k < g->n[row]; k++)
+            {
+                uint8_t len = (g->run[row][k / 2] >> ((k & 1) * 4)) & 0x0F;
+                LCD_StreamColor((k & 1) ? fg : bg, len);
+            }
+        }
+    }
+
+    LCD_StreamEnd();
+}
+
+/**
+ * @brief NUL 종료 문자열 그리기
+ */
+void LCD_DrawString(int16_t x, int16_t y, const char *str, uint16_t fg, uint16_t bg)
+{
+    uint8_t n = 0;
+
+    while (str[n] && n < LCD_WIDTH / LCD_FONT_CELL_W) n++;
+    LCD_DrawText(x, y, str, n, fg, bg);
+}
+
+/**
+ * @brief 텍스트 필드 초기화 (그리지는 않음, 다음 Set에서 전체 그림)
+ */
+void LCD_TextField_Init(LCD_TextField_t *f, uint8_t x, uint8_t y, uint8_t len,
+                        uint16_t fg, uint16_t bg)
+{
+    f->x   = x;
+    f->y   = y;
+    f->len = (len > LCD_TEXT_FIELD_MAX) ? LCD_TEXT_FIELD_MAX : len;
+    f->fg  = fg;
+    f->bg  = bg;
+    f->valid = 0;
+}
+
+/**
+ * @brief 필드 내용 바꾸기 - 바뀐 글자 묶음마다 윈도우 하나
+ * @return 다시 그린 글자 수
+ */
+uint8_t LCD_TextField_Set(LCD_TextField_t *f, const char *str)
+{
+    char next[LCD_TEXT_FIELD_MAX];
+    uint8_t drawn = 0;
+    uint8_t i = 0;
+
+    /* 짧으면 공백으로 채움 */
+    for (uint8_t k = 0, end = 0; k < f->len; k++)
+    {
+        if (!end && str[k] == '\0') end = 1;
+        next[k] = end ? ' ' : str[k];
+    }
+
+    while (i < f->len)
+    {
+        if (f->valid && next[i] == f->shown[i]) { i++; continue; }
+
+        uint8_t start = i;
+        while (i < f->len && !(f->valid && next[i] == f->shown[i]))
+        {
+            f->shown[i] = next[i];
+            i++;
+        }
+
+        LCD_DrawText(f->x + start * LCD_FONT_CELL_W, f->y, &next[start], i - start, f->fg, f->bg);
+        drawn += i - start;
+    }
+
+    f->valid = 1;
+    return drawn;
+}
+
+/**
+ * @brief 패널 내용이 바뀐 뒤(LCD_Clear 등) 다음 Set에서 전체 다시 그리기
+ */
+void LCD_TextField_Invalidate(LCD_TextField_t *f)
+{
+    f->valid = 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file led_fx.c
+ * @brief RGB LED 효과 - 1ms마다 위상을 진행하고 색이 바뀔 때만 RGB_SetColor
+ *
+ * 깜빡임은 ms 단위 위상으로 정확히 끊기고 (메인 루프 타이밍과 무관),
+ * 숨쉬기/섞기는 삼각파 0→255→0 가중치로 밝기 단계를 보간
+ * (단계 → 듀티 감마는 rgb_led.c).
+ */
+
+#include "drivers/led_fx.h"
+
+static const LedFx_t *volatile fx_now;
+static uint16_t fx_phase;               // ms, ISR 전용
+static RgbColor_t fx_shown;
+
+/* ===== 내부 함수 ===== */
+
+static uint8_t Mix(uint8_t a, uint8_t b, uint8_t w)
+{
+    return (uint8_t)(a + ((int16_t)(b - a) * w) / 255);
+}
+
+/**
+ * @brief 삼각파 가중치 (0 → 255 → 0, 한 주기)
+ */
+static uint8_t Triangle(uint16_t phase, uint16_t period)
+{
+    uint16_t half = period / 2;
+
+    if (half == 0) return 255;
+    if (phase < half) return (uint8_t)((uint32_t)phase * 255 / half);
+    return (uint8_t)((uint32_t)(period - phase) * 255 / (period - half));
+}
+
+static RgbColor_t Fx_Color(const LedFx_t *fx, uint16_t phase)
+{
+    uint8_t w;
+
+    switch (fx->type)
+    {
+    case LED_FX_BLINK:
+        return (phase < fx->period_ms / 2) ? fx->a : fx->b;
+
+    case LED_FX_BREATHE:
+        w = Triangle(phase, fx->period_ms);
+        return RGB(Mix(0, fx->a.r, w), Mix(0, fx->a.g, w), Mix(0, fx->a.b, w));
+
+    case LED_FX_FADE:
+        w = Triangle(phase, fx->period_ms);
+        return RGB(Mix(fx->a.r, fx->b.r, w), Mix(fx->a.g, fx->b.g, w), Mix(fx->a.b, fx->b.b, w));
+
+    case LED_FX_SOLID:
+    default:
+        return fx->a;
+    }
+}
+
+/* ===== 외부 API ===== */
+
+void LedFx_Play(const LedFx_t *fx)
+{
+    uint32_t primask;
+
+    if (fx == fx_now) return;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    fx_now   = fx;
+    fx_phase = 0;
+    __set_PRIMASK(primask);
+}
+
+void LedFx_OnTick(void)
+{
+    const LedFx_t *fx = fx_now;
+    RgbColor_t c;
+
+    if (!fx) return;
+
+    c = Fx_Color(fx, fx_phase);
+    if (++fx_phase >= fx->period_ms) fx_phase = 0;
+
+    if (c.r != fx_shown.r || c.g != fx_shown.g || c.b != fx_shown.b)
+    {
+        fx_shown = c;
+        RGB_SetColor(c);
+    }
+}
@@ -0,0 +1,102 @@
+/**
+ * @file memmon.c
+ * @brief 스택 칠하기 / 최고 수위 스캔 + 힙 통계 (memmon.h)
+ *
+ * 칠한 구간 아래쪽은 나중에 힙이 자라며 덮을 수 있으므로 스캔은 항상
+ * max(칠한 시작, 힙 최고 끝)부터. 칠과 같은 값을 스택에 쓴 경우는 못 알아봄 (수위가 조금 낮게 나옴).
+ */
+
+#include "stm32f1xx_hal.h"
+#include "drivers/memmon.h"
+
+/* 링커 스크립트 심볼 */
+extern uint8_t _sdata, _ebss, _end, _estack;
+extern uint8_t _sramfunc, _eramfunc;
+extern uint8_t _Min_Stack_Size;
+
+static uint32_t *paint_lo;              // 칠한 구간 [paint_lo, paint_hi)
+static uint32_t *paint_hi;
+static uint32_t *lowest;                // 지금까지 찾은 가장 낮은 스택 주소
+static uint32_t last_scan_ms;
+static uint32_t reported;               // 마지막으로 알린 최고 수위
+
+/* ===== 내부 함수 ===== */
+
+static uint32_t *Word_Up(const uint8_t *p)
+{
+    return (uint32_t *)(((uintptr_t)p + 3U) & ~(uintptr_t)3U);
+}
+
+static uint8_t *Heap_Top(void)
+{
+    uint8_t *peak = Sysmem_HeapPeak();
+
+    return peak ? peak : &_end;
+}
+
+/**
+ * @brief 아래에서부터 칠이 지워진 첫 워드 (지금 lowest보다 높으면 그대로)
+ */
+static void Scan(void)
+{
+    uint32_t *p = Word_Up(Heap_Top());
+
+    if (p < paint_lo) p = paint_lo;
+    while (p < lowest && *p == MEMMON_PAINT)
+        p++;
+    if (p < lowest)
+        lowest = p;
+}
+
+/* ===== 외부 API ===== */
+
+/* 함수를 부르지 않는 루프 - 지금 프레임 아래만 칠함 */
+void MemMon_Init(void)
+{
+    volatile uint32_t *p;
+
+    paint_lo = Word_Up(Heap_Top());
+    paint_hi = (uint32_t *)((__get_MSP() - MEMMON_SP_MARGIN) & ~3U);
+    for (p = paint_lo; p < paint_hi; p++)
+        *p = MEMMON_PAINT;
+
+    lowest = paint_hi;
+    last_scan_ms = HAL_GetTick();
+    reported = 0;
+}
+
+uint8_t MemMon_Poll(void)
+{
+    uint32_t peak;
+
+    if (!paint_hi || HAL_GetTick() - last_scan_ms < MEMMON_SCAN_MS)
+        return 0;
+    last_scan_ms = HAL_GetTick();
+
+    Scan();
+    peak = (uint32_t)(&_estack - (uint8_t *)lowest);
+    if (peak < reported + MEMMON_REPORT_STEP)
+        return 0;
+    reported = peak;
+    return 1;
+}
+
+void MemMon_Get(MemMon_Stats_t *out)
+{
+    uint8_t *heap_peak = Heap_Top();
+    uint8_t *heap_end  = Sysmem_HeapEnd() ? Sysmem_HeapEnd() : &_end;
+
+    if (paint_hi)
+        Scan();
+
+    out->ram            = (uint32_t)(&_estack - &_sdata);
+    out->static_used    = (uint32_t)(&_ebss - &_sdata);
+    out->ramfunc        = (uint32_t)(&_eramfunc - &_sramfunc);
+    out->heap_used      = (uint32_t)(heap_end - &_end);
+    out->heap_peak      = (uint32_t)(heap_peak - &_end);
+    out->heap_fails     = Sysmem_HeapFails();
+    out->stack_reserved = (uint32_t)(uintptr_t)&_Min_Stack_Size;
+    out->stack_peak     = paint_hi ? (uint32_t)(&_estack - (uint8_t *)lowest) : 0;
+    out->headroom       = (paint_hi && (uint8_t *)lowest > heap_peak) ?
+                          (uint32_t)((uint8_t *)lowest - heap_peak) : 0;
+}
@@ -1,119 +1,312 @@
+/**
+ * @file motor.c
+ * @brief TC118S 4륜 모터 - 좌/우 묶음별 PWM 속도 + 가감속 램프
+ *
+ * 모터 핀(PA9/PA10/PB3~5/PB8~10)이 한 타이머의 출력 채널로 모이지 않아서
+ * TIM3(1MHz, 주기 1ms)를 PWM 시계로만 쓰고 핀은 인터럽트에서 직접 씀.
+ * - 업데이트(주기 시작): 램프 한 단계 → 켜야 할 쪽 방향 핀 ON, CCRx = 듀티
+ * - CC1 / CC2 비교 일치: 왼쪽 / 오른쪽 핀 OFF (코스팅)
+ * 듀티 100%는 CCR이 ARR보다 커서 비교가 일어나지 않으므로 계속 ON.
+ * 핀 쓰기는 방향별로 미리 계산한 BSRR 마스크 - 포트마다 레지스터 쓰기 한 번.
+ *
+ * 곡선: 바깥쪽은 speed, 안쪽은 turn에 따라 speed → 0(피벗) → -speed(제자리 회전).
+ * 시간 제한 곡선은 같은 1ms 인터럽트에서 세다가 끝나면 같은 속도 직진으로 돌아옴.
+ */
+
 #include "drivers/motor.h"
+#include "drivers/gpio_batch.h"
 #include "robot_config.h"
 
+#define PWM_PERIOD      MOTOR_PWM_PERIOD_US     // TIM3 ARR + 1 (us)
+#define DUTY_SCALE      (PWM_PERIOD / MOTOR_SPEED_MAX)
+
+static TIM_HandleTypeDef *pwm_tim;
+
+/* ISR과 공유 */
+static volatile int8_t speed_target[MOTOR_SIDE_COUNT];
+static volatile int8_t speed_now[MOTOR_SIDE_COUNT];
+static volatile uint16_t hold_ms;               // 0 = 시간 제한 없음
+static volatile int8_t speed_after;             // 시간이 끝나면 양쪽 이 속도 (직진)
+
 /* ===============================
- * 내부 모터 제어 유틸
+ * 방향 → BSRR 마스크 (컴파일 시간)
  * =============================== */
 
-static void RF(MotorDir_t dir)
-{
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_RFF_PORT, MOTOR_RFF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_RFB_PORT, MOTOR_RFB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_RFF_PORT, MOTOR_RFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RFB_PORT, MOTOR_RFB_PIN, GPIO_PIN_SET);
-    }
-    else {
-        HAL_GPIO_WritePin(MOTOR_RFF_PORT, MOTOR_RFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RFB_PORT, MOTOR_RFB_PIN, GPIO_PIN_RESET);
-    }
-}
+/* 모터 핀이 있는 포트 (핀이 다른 포트로 옮겨가면 아래 static assert가 잡음) */
+#define MOTOR_PORT_COUNT    2
+#define MOTOR_PORT_0        GPIOA
+#define MOTOR_PORT_1        GPIOB
+
+static GPIO_TypeDef *const motor_ports[MOTOR_PORT_COUNT] = { MOTOR_PORT_0, MOTOR_PORT_1 };
+
+#define PIN_ON(name, port)  GPIO_MASK_ON(MOTOR_##name##_PORT, MOTOR_##name##_PIN, port)
 
-static void RB(MotorDir_t dir)
+/* S = L / R, 앞뒤 바퀴의 전진(F) / 후진(B) 입력 */
+#define FWD_PINS(S, port)   (PIN_ON(S##FF, port) | PIN_ON(S##BF, port))
+#define BWD_PINS(S, port)   (PIN_ON(S##FB, port) | PIN_ON(S##BB, port))
+
+#define DIR_BSRR(S, port) { \
+    [MOTOR_STOP]     = GPIO_BSRR(0, FWD_PINS(S, port) | BWD_PINS(S, port)), \
+    [MOTOR_FORWARD]  = GPIO_BSRR(FWD_PINS(S, port), BWD_PINS(S, port)), \
+    [MOTOR_BACKWARD] = GPIO_BSRR(BWD_PINS(S, port), FWD_PINS(S, port)) }
+
+/* [쪽][포트][방향] */
+static const uint32_t side_bsrr[MOTOR_SIDE_COUNT][MOTOR_PORT_COUNT][3] = {
+    [MOTOR_SIDE_LEFT]  = { DIR_BSRR(L, MOTOR_PORT_0), DIR_BSRR(L, MOTOR_PORT_1) },
+    [MOTOR_SIDE_RIGHT] = { DIR_BSRR(R, MOTOR_PORT_0), DIR_BSRR(R, MOTOR_PORT_1) },
+};
+
+#define PIN_ON_ANY(name)    (PIN_ON(name, MOTOR_PORT_0) | PIN_ON(name, MOTOR_PORT_1))
+#define ASSERT_MOTOR_PIN(name) \
+    _Static_assert(PIN_ON_ANY(name) == MOTOR_##name##_PIN, "MOTOR_" #name " 핀이 MOTOR_PORT_0/1 밖에 있음")
+
+ASSERT_MOTOR_PIN(LFF); ASSERT_MOTOR_PIN(LFB); ASSERT_MOTOR_PIN(LBF); ASSERT_MOTOR_PIN(LBB);
+ASSERT_MOTOR_PIN(RFF); ASSERT_MOTOR_PIN(RFB); ASSERT_MOTOR_PIN(RBF); ASSERT_MOTOR_PIN(RBB);
+
+/**
+ * @brief 한쪽 방향 적용 - 포트마다 BSRR 한 번
+ */
+static void Side_Drive(MotorSide_t side, MotorDir_t dir)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_RBF_PORT, MOTOR_RBF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_RBB_PORT, MOTOR_RBB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_RBF_PORT, MOTOR_RBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RBB_PORT, MOTOR_RBB_PIN, GPIO_PIN_SET);
-    }
-    else {
-        HAL_GPIO_WritePin(MOTOR_RBF_PORT, MOTOR_RBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_RBB_PORT, MOTOR_RBB_PIN, GPIO_PIN_RESET);
+    for (uint8_t p = 0; p < MOTOR_PORT_COUNT; p++)
+    {
+        uint32_t m = side_bsrr[side][p][dir];
+        if (m) motor_ports[p]->BSRR = m;
     }
 }
 
-static void LF(MotorDir_t dir)
+/**
+ * @brief 1ms 램프 한 단계 - 0에서 멀어지면 가속 폭, 0으로 다가가면 감속 폭
+ * @note  방향이 바뀔 때는 0에서 한 번 멈춤 (H브리지 양쪽이 동시에 켜지지 않게)
+ */
+static int8_t Ramp_Step(int8_t now, int8_t target)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_LFF_PORT, MOTOR_LFF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_LFB_PORT, MOTOR_LFB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_LFF_PORT, MOTOR_LFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LFB_PORT, MOTOR_LFB_PIN, GPIO_PIN_SET);
+    int16_t next;
+
+    if (now == target) return now;
+
+    if (target > now)
+    {
+        next = now + ((now >= 0) ? MOTOR_RAMP_UP : MOTOR_RAMP_DOWN);
+        if (now < 0 && next > 0) next = 0;
+        if (next > target) next = target;
     }
-    else {
-        HAL_GPIO_WritePin(MOTOR_LFF_PORT, MOTOR_LFF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LFB_PORT, MOTOR_LFB_PIN, GPIO_PIN_RESET);
+    else
+    {
+        next = now - ((now <= 0) ? MOTOR_RAMP_UP : MOTOR_RAMP_DOWN);
+        if (now > 0 && next < 0) next = 0;
+        if (next < target) next = target;
     }
+    return (int8_t)next;
 }
 
-static void LB(MotorDir_t dir)
+static int8_t Clamp_Speed(int8_t v)
 {
-    if (dir == MOTOR_FORWARD) {
-        HAL_GPIO_WritePin(MOTOR_LBF_PORT, MOTOR_LBF_PIN, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(MOTOR_LBB_PORT, MOTOR_LBB_PIN, GPIO_PIN_RESET);
-    }
-    else if (dir == MOTOR_BACKWARD) {
-        HAL_GPIO_WritePin(MOTOR_LBF_PORT, MOTOR_LBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LBB_PORT, MOTOR_LBB_PIN, GPIO_PIN_SET);
-    }
-    else {
-        HAL_GPIO_WritePin(MOTOR_LBF_PORT, MOTOR_LBF_PIN, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(MOTOR_LBB_PORT, MOTOR_LBB_PIN, GPIO_PIN_RESET);
-    }
+    if (v > MOTOR_SPEED_MAX) return MOTOR_SPEED_MAX;
+    if (v < -MOTOR_SPEED_MAX) return -MOTOR_SPEED_MAX;
+    return v;
 }
 
 /* ===============================
  * 외부 API
  * =============================== */
 
-void Motor_Init(void)
+void Motor_Init(TIM_HandleTypeDef *htim)
 {
-    Motor_Stop();
+    pwm_tim = htim;
+
+    speed_target[MOTOR_SIDE_LEFT] = speed_target[MOTOR_SIDE_RIGHT] = 0;
+    speed_now[MOTOR_SIDE_LEFT] = speed_now[MOTOR_SIDE_RIGHT] = 0;
+    Side_Drive(MOTOR_SIDE_LEFT, MOTOR_STOP);
+    Side_Drive(MOTOR_SIDE_RIGHT, MOTOR_STOP);
+
+    /* 채널 출력은 켜지 않고 비교 인터럽트만 사용 */
+    __HAL_TIM_SET_COMPARE(pwm_tim, TIM_CHANNEL_1, 0);
+    __HAL_TIM_SET_COMPARE(pwm_tim, TIM_CHANNEL_2, 0);
+    __HAL_TIM_CLEAR_FLAG(pwm_tim, TIM_FLAG_UPDATE | TIM_FLAG_CC1 | TIM_FLAG_CC2);
+    __HAL_TIM_ENABLE_IT(pwm_tim, TIM_IT_CC1 | TIM_IT_CC2);
+    HAL_TIM_Base_Start_IT(pwm_tim);
+}
+
+/**
+ * @brief 곡선 → 좌/우 속도
+ * @param turn -100 ~ 100, + = Motor_Left 회전 방향 (오른쪽이 안쪽)
+ *             0 직진, 1~49 곡선, 50 피벗 (안쪽 정지), 100 제자리 회전
+ */
+static void Curve_Speeds(int8_t speed, int8_t turn, int8_t *left, int8_t *right)
+{
+    int16_t mag = (turn < 0) ? -turn : turn;
+    int8_t inner;
+
+    if (mag > 100) mag = 100;
+    speed = Clamp_Speed(speed);
+    inner = (int8_t)(speed * (100 - 2 * mag) / 100);
+
+    *left  = (turn >= 0) ? speed : inner;
+    *right = (turn >= 0) ? inner : speed;
+}
+
+/**
+ * @brief 좌/우 목표 속도 (ISR이 1ms마다 램프로 따라감) - 시간 제한 곡선은 취소
+ */
+void Motor_SetSpeed(int8_t left, int8_t right)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    hold_ms = 0;
+    speed_target[MOTOR_SIDE_LEFT]  = Clamp_Speed(left);
+    speed_target[MOTOR_SIDE_RIGHT] = Clamp_Speed(right);
+    __set_PRIMASK(primask);
+}
+
+/**
+ * @brief 곡선 주행 (계속)
+ */
+void Motor_Curve(int8_t speed, int8_t turn)
+{
+    int8_t left, right;
+
+    Curve_Speeds(speed, turn, &left, &right);
+    Motor_SetSpeed(left, right);
+}
+
+/**
+ * @brief ms 동안 곡선 후 같은 속도로 직진 (멈추지 않고 비켜가기)
+ */
+void Motor_CurveFor(int8_t speed, int8_t turn, uint16_t ms)
+{
+    int8_t left, right;
+    uint32_t primask;
+
+    Curve_Speeds(speed, turn, &left, &right);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    speed_target[MOTOR_SIDE_LEFT]  = left;
+    speed_target[MOTOR_SIDE_RIGHT] = right;
+    speed_after = Clamp_Speed(speed);
+    hold_ms = ms;
+    __set_PRIMASK(primask);
+}
+
+int8_t Motor_GetSpeed(MotorSide_t side)
+{
+    return speed_now[side];
+}
+
+uint8_t Motor_IsSettled(void)
+{
+    return speed_now[MOTOR_SIDE_LEFT] == speed_target[MOTOR_SIDE_LEFT] &&
+           speed_now[MOTOR_SIDE_RIGHT] == speed_target[MOTOR_SIDE_RIGHT];
 }
 
 void Motor_Stop(void)
 {
-    RF(MOTOR_STOP);
-    RB(MOTOR_STOP);
-    LF(MOTOR_STOP);
-    LB(MOTOR_STOP);
+    Motor_SetSpeed(0, 0);
 }
 
 void Motor_Forward(void)
 {
-    RF(MOTOR_FORWARD);
-    RB(MOTOR_FORWARD);
-    LF(MOTOR_FORWARD);
-    LB(MOTOR_FORWARD);
+    Motor_SetSpeed(MOTOR_BASE_SPEED, MOTOR_BASE_SPEED);
 }
 
 void Motor_Backward(void)
 {
-    RF(MOTOR_BACKWARD);
-    RB(MOTOR_BACKWARD);
-    LF(MOTOR_BACKWARD);
-    LB(MOTOR_BACKWARD);
+    Motor_SetSpeed(-MOTOR_BASE_SPEED, -MOTOR_BASE_SPEED);
 }
 
 void Motor_Right(void)
 {
-    LF(MOTOR_BACKWARD);
-    LB(MOTOR_BACKWARD);
-    RF(MOTOR_FORWARD);
-    RB(MOTOR_FORWARD);
+    Motor_SetSpeed(-MOTOR_TURN_SPEED, MOTOR_TURN_SPEED);
 }
 
 void Motor_Left(void)
 {
-    LF(MOTOR_FORWARD);
-    LB(MOTOR_FORWARD);
-    RF(MOTOR_BACKWARD);
-    RB(MOTOR_BACKWARD);
+    Motor_SetSpeed(MOTOR_TURN_SPEED, -MOTOR_TURN_SPEED);
+}
+
+/* 곡선 회전 - 방향 이름은 Motor_Left/Right와 같은 회전 방향,
+ * _Back은 후진하면서 같은 쪽 바퀴를 안쪽으로 (차가 핸들을 꺾고 후진하는 것과 같음) */
+void Motor_TurnLeft_Front(void)
+{
+    Motor_Curve(MOTOR_BASE_SPEED, MOTOR_ARC_TURN);
+}
+
+void Motor_TurnRight_Front(void)
+{
+    Motor_Curve(MOTOR_BASE_SPEED, -MOTOR_ARC_TURN);
+}
+
+void Motor_TurnLeft_Back(void)
+{
+    Motor_Curve(-MOTOR_BASE_SPEED, MOTOR_ARC_TURN);
+}
+
+void Motor_TurnRight_Back(void)
+{
+    Motor_Curve(-MOTOR_BASE_SPEED, -MOTOR_ARC_TURN);
+}
+
+/* 피벗 - 안쪽 바퀴를 세우고 바깥쪽만 */
+void Motor_PivotLeft(void)
+{
+    Motor_Curve(MOTOR_TURN_SPEED, 50);
+}
+
+void Motor_PivotRight(void)
+{
+    Motor_Curve(MOTOR_TURN_SPEED, -50);
+}
+
+/* ===============================
+ * TIM3 인터럽트
+ * =============================== */
+
+/**
+ * @brief PWM 주기 시작: 램프 진행 + 켤 쪽 핀 ON + 끌 시점(CCR) 설정
+ * @note  좌/우 마스크를 합쳐서 포트마다 BSRR 한 번 (두 쪽이 같은 순간에 바뀜)
+ *        ISR이 늦어 카운터가 이미 CCR을 지났으면 비교 인터럽트가 안 오므로 (100% 듀티) 바로 코스팅
+ */
+void Motor_OnPeriod(void)
+{
+    uint32_t bsrr[MOTOR_PORT_COUNT] = {0};
+    uint32_t ccr[MOTOR_SIDE_COUNT] = {0};
+
+    if (hold_ms && --hold_ms == 0)
+        speed_target[MOTOR_SIDE_LEFT] = speed_target[MOTOR_SIDE_RIGHT] = speed_after;
+
+    for (uint8_t side = 0; side < MOTOR_SIDE_COUNT; side++)
+    {
+        int8_t v = Ramp_Step(speed_now[side], speed_target[side]);
+        uint32_t channel = (side == MOTOR_SIDE_LEFT) ? TIM_CHANNEL_1 : TIM_CHANNEL_2;
+        MotorDir_t dir = MOTOR_STOP;
+
+        speed_now[side] = v;
+
+        if (v != 0)
+        {
+            ccr[side] = (uint32_t)(v > 0 ? v : -v) * DUTY_SCALE;
+            __HAL_TIM_SET_COMPARE(pwm_tim, channel, ccr[side]);
+            dir = (v > 0) ? MOTOR_FORWARD : MOTOR_BACKWARD;
+        }
+
+        for (uint8_t p = 0; p < MOTOR_PORT_COUNT; p++)
+            bsrr[p] |= side_bsrr[side][p][dir];
+    }
+
+    for (uint8_t p = 0; p < MOTOR_PORT_COUNT; p++)
+        if (bsrr[p]) motor_ports[p]->BSRR = bsrr[p];
+
+    for (uint8_t side = 0; side < MOTOR_SIDE_COUNT; side++)
+        if (ccr[side] && __HAL_TIM_GET_COUNTER(pwm_tim) >= ccr[side])
+            Side_Drive(side, MOTOR_STOP);
+}
+
+/**
+ * @brief 듀티 끝: 해당 쪽 코스팅
+ */
+void Motor_OnCompare(MotorSide_t side)
+{
+    Side_Drive(side, MOTOR_STOP);
 }
@@ -0,0 +1,364 @@
+/**
+ * @file radar.c
+ * @brief 초음파 스캔 레이더 화면 - 샘플 단위 부분 갱신
+ *
+ * 구성:
+ * 1. 배경 (거리 눈금 원 + 원점) - 진입 시 한 번, 틱 예산만큼 행 단위로 나눠 그림
+ * 2. 방향별 반사점 (3x3) - 나이에 따라 어두워지다 사라짐
+ * 3. 빔 표시 (3x3, 바깥 원 위) - 현재 서보 방향
+ *
+ * 샘플이 들어오면 바뀐 점만 dirty로 표시하고, 갱신은 점이 있던 자리와
+ * 새 자리 3x3 박스 두 개만 다시 그림 (겹친 점/눈금은 픽셀 단위로 합성).
+ * 극좌표 → 화면 좌표는 Q14 사분 사인 표로 계산 (루프 안에 삼각함수 없음).
+ */
+
+#include "drivers/radar.h"
+#include "drivers/lcd_st7735.h"
+#include "robot_config.h"
+
+/* ===== 색상 ===== */
+#define RING_COLOR      RGB565(4, 8, 4)     // 어두운 회색
+#define ORIGIN_COLOR    COLOR_WHITE
+#define BEAM_COLOR      COLOR_YELLOW
+
+static const uint16_t fade_color[RADAR_FADE_LEVELS] = {
+    RGB565(0, 63, 0),       // 최신
+    RGB565(0, 44, 0),
+    RGB565(0, 28, 0),
+    RGB565(0, 14, 0),
+};
+
+/* ===== 점 (방향별 반사점 + 빔) ===== */
+#define RADAR_SLOTS     ((SERVO_MAX_ANGLE - SERVO_MIN_ANGLE) / SERVO_STEP_ANGLE + 1)
+#define MARK_BEAM       RADAR_SLOTS
+#define MARK_COUNT      (RADAR_SLOTS + 1)
+
+#if MARK_COUNT > 32
+#error "레이더 점 개수가 dirty 비트마스크(32비트)보다 많음"
+#endif
+
+#define WIN_COST        11                  // LCD_SetWindow 바이트
+#define BOX_COST        (WIN_COST + 9 * 2)  // 3x3 박스 하나
+#define ROW_COST        (LCD_WIDTH * 2)
+
+typedef struct {
+    uint8_t x, y;       // 목표 위치 (화면 좌표)
+    uint8_t dx, dy;     // 패널에 그려진 위치
+    uint8_t live;       // 보이는 점 (0 = 반사 없음 / 사라짐)
+    uint8_t level;      // 어두워진 단계 (0 = 최신)
+    uint8_t age;        // 마지막 샘플 이후 지난 샘플 수
+    uint8_t drawn;      // 패널에 그려져 있음
+} RadarMark_t;
+
+static RadarMark_t marks[MARK_COUNT];
+static uint32_t dirty;
+
+/* ===== 배경 상태 ===== */
+typedef enum {
+    BG_DONE = 0,
+    BG_GRID,            // 눈금 배경 그리는 중
+    BG_BLACK            // 화면 지우는 중 (Radar_Leave)
+} BgMode_t;
+
+static uint8_t  active;         // 레이더 화면 표시 중
+static BgMode_t bg_mode;
+static uint8_t  bg_row;
+
+/* ===== 극좌표 표 =====
+ * sin(0..90도) * 16384. cos와 90~180도는 대칭으로 구함
+ */
+static const int16_t sin_q14[91] = {
+        0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+     2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+     5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+     8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+/* ===== 내부 함수 ===== */
+
+static int16_t Sin_Q14(uint8_t deg)
+{
+    return sin_q14[deg <= 90 ? deg : 180 - deg];
+}
+
+static int16_t Cos_Q14(uint8_t deg)
+{
+    return (deg <= 90) ? sin_q14[90 - deg] : -sin_q14[deg - 90];
+}
+
+/**
+ * @brief 서보 각도 + 반지름(px) → 화면 좌표
+ * @note  90도 = 정면(위), 90도 미만 = 왼쪽
+ */
+static void Polar_ToScreen(uint8_t deg, uint8_t r, uint8_t *x, uint8_t *y)
+{
+    if (deg > 180) deg = 180;
+
+    *x = (uint8_t)(RADAR_OX - (((int32_t)r * Cos_Q14(deg) + 8192) >> 14));
+    *y = (uint8_t)(RADAR_OY - (((int32_t)r * Sin_Q14(deg) + 8192) >> 14));
+}
+
+static uint8_t Angle_ToSlot(uint8_t angle)
+{
+    if (angle <= SERVO_MIN_ANGLE) return 0;
+    if (angle >= SERVO_MAX_ANGLE) return RADAR_SLOTS - 1;
+    return (angle - SERVO_MIN_ANGLE + SERVO_STEP_ANGLE / 2) / SERVO_STEP_ANGLE;
+}
+
+/**
+ * @brief 배경 픽셀 색 (눈금 원 / 원점)
+ */
+static uint16_t Bg_Color(uint8_t x, uint8_t y)
+{
+    int32_t dx = (int32_t)x - RADAR_OX;
+    int32_t dy = (int32_t)RADAR_OY - y;
+    int32_t d2x4 = 4 * (dx * dx + dy * dy);
+
+    if (d2x4 <= 4 * 4) return ORIGIN_COLOR;
+
+    /* |d - R| < 0.5  ⇔  (2R-1)^2 <= 4d^2 < (2R+1)^2 */
+    for (uint8_t cm = RADAR_RING_CM; cm <= RADAR_RANGE_CM; cm += RADAR_RING_CM)
+    {
+        int32_t r2 = 2 * ((int32_t)RADAR_R * cm / RADAR_RANGE_CM);
+
+        if (d2x4 >= (r2 - 1) * (r2 - 1) && d2x4 < (r2 + 1) * (r2 + 1))
+            return RING_COLOR;
+    }
+    return COLOR_BLACK;
+}
+
+/**
+ * @brief 한 픽셀의 최종 색 (빔 > 최신 점 > 오래된 점 > 배경)
+ */
+static uint16_t Pixel_Color(uint8_t x, uint8_t y)
+{
+    uint8_t best = 0;
+    uint16_t color = 0;
+
+    for (uint8_t i = 0; i < MARK_COUNT; i++)
+    {
+        const RadarMark_t *m = &marks[i];
+        uint8_t prio;
+
+        if (!m->live) continue;
+        if (x + 1 < m->x || x > m->x + 1 || y + 1 < m->y || y > m->y + 1) continue;
+
+        prio = (i == MARK_BEAM) ? RADAR_FADE_LEVELS + 1 : RADAR_FADE_LEVELS - m->level;
+        if (prio > best)
+        {
+            best  = prio;
+            color = (i == MARK_BEAM) ? BEAM_COLOR : fade_color[m->level];
+        }
+    }
+
+    return best ? color : Bg_Color(x, y);
+}
+
+/**
+ * @brief (cx, cy) 중심 3x3 박스를 현재 상태로 다시 그림
+ * @return 보낸 바이트
+ */
+static uint16_t Box_Draw(uint8_t cx, uint8_t cy)
+{
+    uint8_t x0 = cx ? cx - 1 : 0;
+    uint8_t y0 = cy ? cy - 1 : 0;
+    uint8_t x1 = (cx + 1 < LCD_WIDTH)  ? cx + 1 : LCD_WIDTH - 1;
+    uint8_t y1 = (cy + 1 < LCD_HEIGHT) ? cy + 1 : LCD_HEIGHT - 1;
+
+    LCD_SetWindow(x0, y0, x1, y1);
+    LCD_StreamBegin();
+    for (uint8_t y = y0; y <= y1; y++)
+        for (uint8_t x = x0; x <= x1; x++)
+            LCD_StreamColor(Pixel_Color(x, y), 1);
+    LCD_StreamEnd();
+
+    return WIN_COST + 2 * (x1 - x0 + 1) * (y1 - y0 + 1);
+}
+
+/**
+ * @brief 점 하나 갱신 (이전 자리 지우기 + 새 자리 그리기)
+ */
+static uint16_t Mark_Redraw(uint8_t i)
+{
+    RadarMark_t *m = &marks[i];
+    uint16_t used = 0;
+
+    if (m->drawn && (!m->live || m->dx != m->x || m->dy != m->y))
+        used += Box_Draw(m->dx, m->dy);
+
+    if (m->live)
+    {
+        used += Box_Draw(m->x, m->y);
+        m->dx = m->x;
+        m->dy = m->y;
+    }
+    m->drawn = m->live;
+
+    return used;
+}
+
+/**
+ * @brief 배경 행을 예산만큼 이어서 그림
+ * @return 1 = 배경 완료
+ */
+static uint8_t Bg_Run(uint16_t *budget)
+{
+    if (bg_row >= LCD_HEIGHT) return 1;
+    if (*budget < WIN_COST + ROW_COST) return 0;
+
+    LCD_SetWindow(0, bg_row, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    LCD_StreamBegin();
+    *budget -= WIN_COST;
+
+    while (bg_row < LCD_HEIGHT && *budget >= ROW_COST)
+    {
+        if (bg_mode == BG_BLACK)
+        {
+            LCD_StreamColor(COLOR_BLACK, LCD_WIDTH);
+        }
+        else
+        {
+            uint16_t run_color = Bg_Color(0, bg_row);
+            uint8_t  run_len = 0;
+
+            for (uint8_t x = 0; x < LCD_WIDTH; x++)
+            {
+                uint16_t c = Bg_Color(x, bg_row);
+
+                if (c != run_color)
+                {
+                    LCD_StreamColor(run_color, run_len);
+                    run_color = c;
+                    run_len = 0;
+                }
+                run_len++;
+            }
+            LCD_StreamColor(run_color, run_len);
+        }
+
+        bg_row++;
+        *budget -= ROW_COST;
+    }
+
+    LCD_StreamEnd();
+    return (bg_row >= LCD_HEIGHT);
+}
+
+/* ===== 외부 API ===== */
+
+/**
+ * @brief 레이더 화면 시작
+ * @note  화면 전체를 바로 그리지 않고 Radar_Update()에서 예산만큼 나눠 그림
+ */
+void Radar_Enter(void)
+{
+    active  = 1;
+    bg_mode = BG_GRID;
+    bg_row  = 0;
+
+    /* 배경이 덮어쓰므로 점은 배경이 끝난 뒤 전부 다시 그림 */
+    for (uint8_t i = 0; i < MARK_COUNT; i++)
+        marks[i].drawn = 0;
+    dirty = (1UL << MARK_COUNT) - 1;
+}
+
+/**
+ * @brief 레이더 화면 끝내기 (화면을 검게 지운 뒤 비활성)
+ */
+void Radar_Leave(void)
+{
+    if (!active) return;
+
+    bg_mode = BG_BLACK;
+    bg_row  = 0;
+}
+
+/**
+ * @brief 스캔 샘플 1개 반영
+ * @param angle   서보 각도 (도)
+ * @param dist_cm 거리 (0 또는 범위 밖 = 반사 없음)
+ * @note  화면이 꺼져 있어도 상태는 갱신 (다시 켜면 최근 점이 보임)
+ */
+void Radar_AddSample(uint8_t angle, uint16_t dist_cm)
+{
+    uint8_t slot = Angle_ToSlot(angle);
+
+    /* 다른 방향 점 나이 증가 - 단계가 바뀐 점만 다시 그림 */
+    for (uint8_t i = 0; i < RADAR_SLOTS; i++)
+    {
+        RadarMark_t *m = &marks[i];
+        uint8_t level;
+
+        if (i == slot || !m->live) continue;
+
+        m->age++;
+        level = m->age / RADAR_FADE_STEP;
+        if (level != m->level)
+        {
+            m->level = level;
+            if (level >= RADAR_FADE_LEVELS) m->live = 0;
+            dirty |= 1UL << i;
+        }
+    }
+
+    /* 이번 방향 */
+    {
+        RadarMark_t *m = &marks[slot];
+
+        m->age = 0;
+        if (dist_cm > 0 && dist_cm <= RADAR_RANGE_CM)
+        {
+            Polar_ToScreen(angle, (uint8_t)(dist_cm * RADAR_R / RADAR_RANGE_CM), &m->x, &m->y);
+            m->live  = 1;
+            m->level = 0;
+        }
+        else
+        {
+            m->live = 0;
+        }
+        dirty |= 1UL << slot;
+    }
+
+    /* 빔 */
+    Polar_ToScreen(angle, RADAR_R, &marks[MARK_BEAM].x, &marks[MARK_BEAM].y);
+    marks[MARK_BEAM].live = 1;
+    dirty |= 1UL << MARK_BEAM;
+}
+
+/**
+ * @brief 예산 안에서 그리기 진행 (UI 틱마다 호출)
+ * @param budget_bytes 이번 호출에서 SPI로 보낼 최대 바이트 (윈도우 설정 포함)
+ * @return 1 = 그릴 것이 더 없음
+ */
+uint8_t Radar_Update(uint16_t budget_bytes)
+{
+    if (bg_mode != BG_DONE)
+    {
+        if (!Bg_Run(&budget_bytes)) return 0;
+
+        if (bg_mode == BG_BLACK) active = 0;
+        bg_mode = BG_DONE;
+    }
+
+    if (!active) return 1;
+
+    while (dirty)
+    {
+        uint8_t i = 0;
+
+        /* 점 하나당 박스 최대 2개 */
+        if (budget_bytes < 2 * BOX_COST) return 0;
+
+        while (!(dirty & (1UL << i))) i++;
+        dirty &= ~(1UL << i);
+        budget_bytes -= Mark_Redraw(i);
+    }
+
+    return 1;
+}
@@ -1,48 +1,157 @@
-/* rgb_led.c - 주황색 수정 버전 */
+/* rgb_led.c - RGB LED 소프트웨어 PWM (TIM3 1kHz, CC3 비교 하나로 세 채널)
+ *
+ * PC5/PC6/PC8은 TIM3 출력 채널로 모이지 않아서 (PC5는 타이머 핀 없음)
+ * 모터와 같은 방식으로 인터럽트에서 핀을 씀:
+ * - 업데이트(주기 시작): 듀티가 있는 채널 ON (BSRR 한 번), 끌 시각을 정렬해서 CCR3에 첫 시각
+ * - CC3: 그 시각에 끌 채널 OFF, CCR3을 다음 시각으로
+ * 주기당 CC3 인터럽트 최대 3번. 0%와 100%는 비교 없이 계속 OFF / ON.
+ */
 
 #include "main.h"
 #include "drivers/rgb_led.h"
+#include "drivers/gpio_batch.h"
+#include "robot_config.h"
 
-void RGB_Init(void)
+#define RGB_PORT    RED_GPIO_Port
+#define RGB_ALL     (RED_Pin | GREEN_Pin | BLUE_Pin)
+
+#define PWM_PERIOD  MOTOR_PWM_PERIOD_US // TIM3 ARR + 1 (us)
+#define CCR_IDLE    0xFFFFU             // ARR보다 커서 비교가 일어나지 않음
+
+_Static_assert(GREEN_GPIO_Port == RGB_PORT && BLUE_GPIO_Port == RGB_PORT,
+               "RGB 핀은 한 포트에 있어야 함");
+
+static const uint16_t rgb_pins[3] = { RED_Pin, GREEN_Pin, BLUE_Pin };
+
+/* RGB_Set 색 번호 → 채널 켜기/끄기 */
+static const RgbColor_t rgb_colors[] = {
+    [RGB_COLOR_GREEN]  = { 0,   255, 0 },   // 0 - 🟢 초록색
+    [RGB_COLOR_RED]    = { 255, 0,   0 },   // 1 - 🔴 빨강색
+    [RGB_COLOR_ORANGE] = { 255, 255, 0 },   // 2 - 🟠 주황색 (GREEN + RED)
+};
+
+static TIM_HandleTypeDef *pwm_tim;
+
+static volatile uint16_t duty_next[3];  // 다음 주기 듀티 (us)
+
+/* 이번 주기 끌 시각 (정렬) - ISR 전용 */
+static uint16_t off_time[3];
+static uint16_t off_mask[3];
+static uint8_t  off_count;
+static uint8_t  off_index;
+
+/**
+ * @brief 밝기 단계 → 듀티 (us), 감마 2 (255 → 1000)
+ */
+static uint16_t Level_To_Duty(uint8_t level)
 {
+    uint32_t d = ((uint32_t)level * level + 32) / 65;
+
+    return (d > PWM_PERIOD) ? PWM_PERIOD : (uint16_t)d;
+}
+
+void RGB_Init(TIM_HandleTypeDef *htim)
+{
+    pwm_tim = htim;
     RGB_Off();
+    RGB_PORT->BSRR = GPIO_BSRR(0, RGB_ALL);
+
+    /* TIM3 시작은 Motor_Init이 함 - 여기서는 CC3 인터럽트만 */
+    __HAL_TIM_SET_COMPARE(pwm_tim, TIM_CHANNEL_3, CCR_IDLE);
+    __HAL_TIM_CLEAR_FLAG(pwm_tim, TIM_FLAG_CC3);
+    __HAL_TIM_ENABLE_IT(pwm_tim, TIM_IT_CC3);
+}
+
+/**
+ * @brief 색 바꾸기 (다음 주기 시작에 세 채널이 같이 바뀜)
+ */
+void RGB_SetColor(RgbColor_t c)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint16_t r = Level_To_Duty(c.r), g = Level_To_Duty(c.g), b = Level_To_Duty(c.b);
+
+    __disable_irq();
+    duty_next[0] = r;
+    duty_next[1] = g;
+    duty_next[2] = b;
+    __set_PRIMASK(primask);
 }
 
 void RGB_Set(int color)
 {
-    switch (color)
-    {
-    case RGB_COLOR_GREEN:   // 0 - 🟢 초록색
+    if (color >= 0 && color < (int)(sizeof(rgb_colors) / sizeof(rgb_colors[0])))
+        RGB_SetColor(rgb_colors[color]);
+    else
+        RGB_Off();
+}
+
+void RGB_Off(void)
+{
+    RGB_SetColor(RGB(0, 0, 0));
+}
 
-        HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
-        break;
+/* ===== TIM3 인터럽트 ===== */
 
-    case RGB_COLOR_RED:     // 1 - 🔴 빨강색
+/**
+ * @brief PWM 주기 시작: 켤 채널 ON + 끌 시각 정렬
+ */
+void RGB_OnPeriod(void)
+{
+    uint32_t set = 0, reset = 0;
 
-        HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_RESET);
-        HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_SET);
-        HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
-        break;
+    off_count = 0;
+    off_index = 0;
 
-    case RGB_COLOR_ORANGE:  // 2 - 🟠 주황색 (GREEN + RED)
+    for (uint8_t ch = 0; ch < 3; ch++)
+    {
+        uint16_t d = duty_next[ch];
+        uint8_t i;
 
-        HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_SET);   // GREEN ON
-        HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_SET);     // RED ON
-        HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);  // BLUE OFF
-        break;
+        if (d == 0)
+        {
+            reset |= rgb_pins[ch];
+            continue;
+        }
+        set |= rgb_pins[ch];
+        if (d >= PWM_PERIOD) continue;
 
-    default:
-        RGB_Off();
-        break;
+        /* 삽입 정렬 (같은 시각은 한 번에) */
+        for (i = 0; i < off_count && off_time[i] < d; i++);
+        if (i < off_count && off_time[i] == d)
+        {
+            off_mask[i] |= rgb_pins[ch];
+            continue;
+        }
+        for (uint8_t k = off_count; k > i; k--)
+        {
+            off_time[k] = off_time[k - 1];
+            off_mask[k] = off_mask[k - 1];
+        }
+        off_time[i] = d;
+        off_mask[i] = rgb_pins[ch];
+        off_count++;
     }
+
+    RGB_PORT->BSRR = GPIO_BSRR(set, reset);
+    __HAL_TIM_SET_COMPARE(pwm_tim, TIM_CHANNEL_3, off_count ? off_time[0] : CCR_IDLE);
 }
 
-void RGB_Off(void)
+/**
+ * @brief CC3: 이 시각에 끌 채널 OFF, 다음 시각 예약 (이미 지났으면 같이 처리)
+ */
+void RGB_OnCompare(void)
 {
+    uint32_t reset = 0;
+
+    while (off_index < off_count)
+    {
+        reset |= off_mask[off_index++];
+
+        if (off_index < off_count && off_time[off_index] > __HAL_TIM_GET_COUNTER(pwm_tim) + 1)
+            break;
+    }
 
-    HAL_GPIO_WritePin(GPIOC, RED_Pin, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(GPIOC, GREEN_Pin, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
+    if (reset) RGB_PORT->BSRR = GPIO_BSRR(0, reset);
+    __HAL_TIM_SET_COMPARE(pwm_tim, TIM_CHANNEL_3,
+                          (off_index < off_count) ? off_time[off_index] : CCR_IDLE);
 }
@@ -1,9 +1,10 @@
 #include "drivers/servo.h"
+#include "robot_config.h"
 
-/* ===== PWM 파라미터 ===== */
-#define SERVO_MIN 25     // 0.5ms
-#define SERVO_MAX 125    // 2.5ms
-#define SERVO_CENTER 75 // 1.5ms
+/* ===== PWM 파라미터 (TIM2 틱, 하드웨어 프로파일 펄스 폭에서 계산) ===== */
+#define SERVO_MIN       SERVO_CCR_MIN                                   // 0도
+#define SERVO_MAX       SERVO_CCR_MAX                                   // 180도
+#define SERVO_CENTER    (SERVO_MIN + SERVO_CENTER_ANGLE * (SERVO_MAX - SERVO_MIN) / 180)
 
 static TIM_HandleTypeDef *servo_tim;
 static uint32_t servo_channel;
@@ -0,0 +1,77 @@
+/**
+ * @file timebase.c
+ * @brief 1us 해상도 32비트 타임스탬프 - TIM1 16비트 카운터 + 업데이트 인터럽트로 상위 16비트
+ *
+ * 읽기: IRQ 금지 상태에서 상위 값과 CNT를 읽고, 오버플로 플래그가 이미 섰는데
+ * ISR이 아직 못 돈 경우(다른 ISR 안이나 IRQ 금지 구간에서 호출)는 직접 보정.
+ * TIM1 업데이트 인터럽트는 다른 인터럽트와 같은 최고 우선순위(0)라서
+ * 플래그를 지운 뒤 상위 값을 올리기 전에 끼어드는 읽기는 없음.
+ *
+ * 읽기(Timebase_Us / Elapsed)는 SRAM에서 - 초음파 ECHO 대기 루프(RAMFUNC)가 바퀴마다 부르므로
+ * 플래시에 두면 루프가 결국 플래시 대기 + veneer로 돎.
+ */
+
+#include "drivers/timebase.h"
+#include "drivers/ramfunc.h"
+
+static TIM_HandleTypeDef *tb_tim;
+static volatile uint32_t tb_high;           // 오버플로 횟수 << 16
+
+/* ===== 외부 API ===== */
+
+void Timebase_Init(TIM_HandleTypeDef *htim)
+{
+    tb_tim  = htim;
+    tb_high = 0;
+
+    __HAL_TIM_SET_COUNTER(tb_tim, 0);
+    __HAL_TIM_CLEAR_FLAG(tb_tim, TIM_FLAG_UPDATE);
+    HAL_TIM_Base_Start_IT(tb_tim);
+}
+
+void Timebase_OnOverflow(void)
+{
+    tb_high += 0x10000U;
+}
+
+RAMFUNC uint32_t Timebase_Us(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t high, cnt;
+
+    __disable_irq();
+    high = tb_high;
+    cnt  = __HAL_TIM_GET_COUNTER(tb_tim);
+
+    /* 넘어간 직후인데 ISR이 아직 - CNT가 작으면 넘어간 뒤에 읽은 값 */
+    if (__HAL_TIM_GET_FLAG(tb_tim, TIM_FLAG_UPDATE) && cnt < 0x8000U)
+        high += 0x10000U;
+    __set_PRIMASK(primask);
+
+    return high | cnt;
+}
+
+RAMFUNC uint32_t Timebase_Elapsed(uint32_t since_us)
+{
+    return Timebase_Us() - since_us;
+}
+
+/**
+ * @brief 최소 us 대기 (읽기 해상도 1us라 1틱 더 기다림)
+ */
+void Timebase_DelayUs(uint32_t us)
+{
+    uint32_t start = Timebase_Us();
+
+    while (Timebase_Us() - start <= us);
+}
+
+uint32_t Timebase_Deadline(uint32_t after_us)
+{
+    return Timebase_Us() + after_us;
+}
+
+uint8_t Timebase_Expired(uint32_t deadline_us)
+{
+    return (int32_t)(Timebase_Us() - deadline_us) >= 0;
+}
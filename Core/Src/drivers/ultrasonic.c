@@ -1,71 +1,92 @@
 #include "drivers/ultrasonic.h"
+#include "drivers/timebase.h"
+#include "robot_config.h"
+#include "drivers/ramfunc.h"
 
-/* ===== 핀맵 (robot_config.h로 나중에 이동 가능) ===== */
-#define ULTRASONIC_TRIG_PORT   GPIOA
-#define ULTRASONIC_TRIG_PIN    GPIO_PIN_0
-
-#define ULTRASONIC_ECHO_PORT   GPIOA
-#define ULTRASONIC_ECHO_PIN    GPIO_PIN_1
-
-/* ===== 내부 변수 ===== */
-static TIM_HandleTypeDef *us_tim;
+/* 왕복 시간 (us) = 거리 (cm) x 58.8 - 유효 ECHO 폭은 하드웨어 프로파일 */
+#define ECHO_MIN_US     ULTRASONIC_ECHO_MIN_US
+#define ECHO_MAX_US     ULTRASONIC_ECHO_MAX_US
+#define ECHO_TIMEOUT_US 30000U      // 센서가 아무것도 못 보면 약 38ms HIGH
 
 /* ===== 내부 함수 ===== */
-static void delay_us(uint16_t us)
-{
-    __HAL_TIM_SET_COUNTER(us_tim, 0);
-    while (__HAL_TIM_GET_COUNTER(us_tim) < us);
-}
-
 static void trig_pulse(void)
 {
     HAL_GPIO_WritePin(ULTRASONIC_TRIG_PORT, ULTRASONIC_TRIG_PIN, GPIO_PIN_SET);
-    delay_us(10);
+    Timebase_DelayUs(10);
     HAL_GPIO_WritePin(ULTRASONIC_TRIG_PORT, ULTRASONIC_TRIG_PIN, GPIO_PIN_RESET);
 }
 
-static uint32_t echo_time_us(void)
+/* 에지를 놓치는 폭 = 루프 한 바퀴 - SRAM에서 (Timebase 읽기도 SRAM), 핀은 IDR 직접 읽기 (HAL 호출 없이) */
+#define ECHO_LEVEL()    (ULTRASONIC_ECHO_PORT->IDR & ULTRASONIC_ECHO_PIN)
+
+/**
+ * @brief ECHO가 level(핀 마스크 또는 0)이 될 때까지 대기 - 1 = 도달, 0 = 타임아웃
+ *        돈 바퀴 수를 *polls에 더함 ('p' 벤치마크)
+ */
+static RAMFUNC uint8_t echo_wait(uint32_t level, uint32_t start, uint32_t timeout, uint32_t *polls)
 {
-    uint32_t timeout = 30000; // 30ms
-    uint32_t start = __HAL_TIM_GET_COUNTER(us_tim);
+    uint32_t n = 0;
 
-    // ECHO가 HIGH 될 때까지 대기 (타임아웃 포함)
-    while (HAL_GPIO_ReadPin(ULTRASONIC_ECHO_PORT, ULTRASONIC_ECHO_PIN) == GPIO_PIN_RESET)
+    while (ECHO_LEVEL() != level)
     {
-        if ((__HAL_TIM_GET_COUNTER(us_tim) - start) > timeout)
+        n++;
+        if (Timebase_Elapsed(start) > timeout)
+        {
+            *polls += n;
             return 0;
+        }
     }
+    *polls += n;
+    return 1;
+}
+
+static RAMFUNC uint32_t echo_time_us(uint32_t *polls)
+{
+    uint32_t start = Timebase_Us();
+
+    // ECHO가 HIGH 될 때까지 대기 (타임아웃 포함)
+    if (!echo_wait(ULTRASONIC_ECHO_PIN, start, ECHO_TIMEOUT_US, polls))
+        return 0;
 
-    __HAL_TIM_SET_COUNTER(us_tim, 0);
+    start = Timebase_Us();
 
     // ECHO가 LOW로 떨어질 때까지 대기 (타임아웃 포함)
-    while (HAL_GPIO_ReadPin(ULTRASONIC_ECHO_PORT, ULTRASONIC_ECHO_PIN) == GPIO_PIN_SET)
-    {
-        if (__HAL_TIM_GET_COUNTER(us_tim) > timeout)
-            return 0;
-    }
+    if (!echo_wait(0, start, ECHO_TIMEOUT_US, polls))
+        return 0;
 
-    return __HAL_TIM_GET_COUNTER(us_tim);
+    return Timebase_Elapsed(start);
 }
 
 /* ===== 외부 함수 ===== */
 
-void Ultrasonic_Init(TIM_HandleTypeDef *htim)
+/* 시간 측정은 Timebase 공용 시계 (main에서 먼저 Timebase_Init) */
+void Ultrasonic_Init(void)
 {
-    us_tim = htim;
-    HAL_TIM_Base_Start(us_tim);
+    HAL_GPIO_WritePin(ULTRASONIC_TRIG_PORT, ULTRASONIC_TRIG_PIN, GPIO_PIN_RESET);
 }
 
 uint16_t Ultrasonic_GetDistance(void)
 {
-    uint32_t echo_us;
+    uint32_t echo_us, polls = 0;
 
     trig_pulse();
-    echo_us = echo_time_us();
+    echo_us = echo_time_us(&polls);
 
-    if (echo_us < 240 || echo_us > 23000)
+    if (echo_us < ECHO_MIN_US || echo_us > ECHO_MAX_US)
         return 0;
 
-    /* cm 단위 변환 */
-    return (uint16_t)(echo_us * 0.017);
+    /* cm 단위 변환 (x 0.017, 정수) */
+    return (uint16_t)(echo_us * 17U / 1000U);
+}
+
+/**
+ * @brief 'p' 벤치마크 - TRIG 없이 ECHO HIGH 대기 루프만 timeout_us 동안, 돈 바퀴 수
+ *        (센서가 조용하면 ECHO는 LOW라 끝까지 돎)
+ */
+uint32_t Ultrasonic_EchoPolls(uint32_t timeout_us)
+{
+    uint32_t polls = 0;
+
+    echo_wait(ULTRASONIC_ECHO_PIN, Timebase_Us(), timeout_us, &polls);
+    return polls;
 }
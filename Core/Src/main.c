@@ -12,15 +12,30 @@
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include <stdio.h>
+#include "drivers/timebase.h"
 #include "drivers/ultrasonic.h"
 #include "drivers/servo.h"
 #include "robot_config.h"
 #include "robot_state.h"
+#include "robot_behavior.h"
+#include "robot_command.h"
 #include "drivers/motor.h"
+#include "drivers/encoder.h"
+#include "drivers/heading.h"
+#include "drivers/rgb_led.h"
+#include "drivers/led_fx.h"
 #include "drivers/buzzer.h"
 #include "drivers/anim.h"
 #include "drivers/lcd_st7735.h"
+#include "drivers/lcd_i2c.h"
+#include "drivers/i2c_bus.h"
+#include "drivers/radar.h"
+#include "drivers/memmon.h"
+#include "drivers/fmt.h"
+#include "drivers/lcd_gfx.h"
 #include "ui_fsm.h"
+#include "param.h"
+#include "reclog.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -30,12 +45,6 @@
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define delay_ms HAL_Delay
-#define ADDRESS   0x27 << 1
-#define RS1_EN1   0x05
-#define RS1_EN0   0x01
-#define RS0_EN1   0x04
-#define RS0_EN0   0x00
-#define BackLight 0x08
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -48,26 +57,18 @@ SPI_HandleTypeDef hspi2;
 TIM_HandleTypeDef htim1;
 TIM_HandleTypeDef htim2;
 TIM_HandleTypeDef htim3;
+TIM_HandleTypeDef htim4;
 UART_HandleTypeDef huart2;
 
 /* USER CODE BEGIN PV */
-int delay = 0;
-int value = 0;
-
-static RobotState_t prevState = STATE_IDLE;
-int8_t scan_dir = 1;
-uint8_t scan_angle = 30;
-uint32_t last_scan_tick = 0;
 uint8_t bt_rx_char;
 
-uint8_t start_flag = 0;
-uint8_t manual_mode = 0;
 uint8_t rx_char;
 
-uint16_t min_dist = 999;
-uint8_t  min_angle = 90;
-
-uint8_t manual_command = 0;
+/* UART 진단 명령 - 출력이 길어서 USART2 ISR이 아니라 메인 루프에서 (블로킹 TX 동안 TIM1/TIM3/EXTI가 멈춤) */
+static volatile uint8_t i2c_req;
+static volatile uint8_t fsm_req;
+static volatile uint8_t mem_req;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -77,101 +78,21 @@ static void MX_USART2_UART_Init(void);
 static void MX_TIM1_Init(void);
 static void MX_TIM2_Init(void);
 static void MX_TIM3_Init(void);
+static void MX_TIM4_Init(void);
 static void MX_SPI2_Init(void);
 static void MX_I2C1_Init(void);
 
 /* USER CODE BEGIN PFP */
-void Set_LED_By_State(RobotState_t state);
 void I2C_ScanAddresses(void);
-
-void delay_us(int us){
-	value = 3;
-	delay = us * value;
-	for(int i=0;i < delay;i++);
-}
-
-void LCD_DATA(uint8_t data){
-	uint8_t temp=(data & 0xF0)|RS1_EN1|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	temp=(data & 0xF0)|RS1_EN0|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	delay_us(4);
-	temp=((data << 4) & 0xF0)|RS1_EN1|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	temp = ((data << 4) & 0xF0)|RS1_EN0|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	delay_us(50);
-}
-
-void LCD_CMD(uint8_t cmd){
-	uint8_t temp=(cmd & 0xF0)|RS0_EN1|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	temp=(cmd & 0xF0)|RS0_EN0|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	delay_us(4);
-	temp=((cmd << 4) & 0xF0)|RS0_EN1|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	temp=((cmd << 4) & 0xF0)|RS0_EN0|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	delay_us(50);
-}
-
-void LCD_CMD_4bit(uint8_t cmd){
-	uint8_t temp=((cmd << 4) & 0xF0)|RS0_EN1|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	temp=((cmd << 4) & 0xF0)|RS0_EN0|BackLight;
-	while(HAL_I2C_Master_Transmit(&hi2c1, ADDRESS, &temp, 1, 1000)!=HAL_OK);
-	delay_us(50);
-}
-
-void LCD_INIT(void){
-	delay_ms(100);
-	LCD_CMD_4bit(0x03); delay_ms(5);
-	LCD_CMD_4bit(0x03); delay_us(100);
-	LCD_CMD_4bit(0x03); delay_us(100);
-	LCD_CMD_4bit(0x02); delay_us(100);
-	LCD_CMD(0x28);
-	LCD_CMD(0x08);
-	LCD_CMD(0x01);
-	delay_ms(3);
-	LCD_CMD(0x06);
-	LCD_CMD(0x0C);
-}
-
-void LCD_XY(char x, char y){
-	if      (y == 0) LCD_CMD(0x80 + x);
-	else if (y == 1) LCD_CMD(0xC0 + x);
-	else if (y == 2) LCD_CMD(0x94 + x);
-	else if (y == 3) LCD_CMD(0xD4 + x);
-}
-
-void LCD_CLEAR(void){
-	LCD_CMD(0x01);
-	delay_ms(2);
-}
-
-void LCD_PUTS(char *str){
-	while (*str) LCD_DATA(*str++);
-}
+void I2C_PrintStats(void);
+void FSM_PrintTrace(void);
+void MEM_PrintStats(void);
+void PERF_RamFuncs(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
-const char* StateToStr(RobotState_t state)
-{
-    switch (state)
-    {
-    case STATE_IDLE:   return "IDLE";
-    case STATE_SCAN:   return "SCAN";
-    case STATE_DECIDE: return "DECIDE";
-    case STATE_MOVE:   return "MOVE";
-    case STATE_ALERT:  return "ALERT";
-    case STATE_REVERSE: return "REVERSE";
-    default:           return "UNKNOWN";
-    }
-}
-
 #ifdef __GNUC__
 #define PUTCHAR_PROTOTYPE int __io_putchar(int ch)
 #else
@@ -190,113 +111,226 @@ void I2C_ScanAddresses(void) {
     HAL_StatusTypeDef result;
     uint8_t i;
 
-    printf("Scanning I2C addresses...\r\n");
+    Fmt_Printf("Scanning I2C addresses...\r\n");
 
     for (i = 1; i < 128; i++) {
         result = HAL_I2C_IsDeviceReady(&hi2c1, (uint16_t)(i << 1), 1, 10);
         if (result == HAL_OK) {
-            printf("I2C device found at address 0x%02X\r\n", i);
+            Fmt_Printf("I2C device found at address 0x%02X\r\n", i);
+        }
+    }
+
+    Fmt_Printf("Scan complete.\r\n");
+}
+
+void I2C_PrintStats(void)
+{
+    Fmt_Printf("I2C recoveries=%lu\r\n", (unsigned long)I2CBus_Recoveries());
+
+    for (uint8_t i = 0; i < I2CBus_DeviceCount(); i++)
+    {
+        const I2CBus_DevStats_t *st = I2CBus_Stats(i);
+
+        Fmt_Printf("I2C 0x%02X ok=%lu nack=%lu berr=%lu tout=%lu retry=%lu drop=%lu "
+                   "lat=%lu/%lu/%lu us\r\n",
+                   st->addr >> 1, (unsigned long)st->ok, (unsigned long)st->nack,
+                   (unsigned long)st->bus_err, (unsigned long)st->timeout,
+                   (unsigned long)st->retries, (unsigned long)st->dropped,
+                   (unsigned long)st->lat_last_us, (unsigned long)st->lat_avg_us,
+                   (unsigned long)st->lat_max_us);
+    }
+}
+
+/**
+ * @brief RAM 사용량 - 정적 / 힙 / 스택 최고 수위 / 한 번도 안 쓴 여유
+ */
+void MEM_PrintStats(void)
+{
+    MemMon_Stats_t m;
+
+    MemMon_Get(&m);
+    Fmt_Printf("MEM ram=%lu static=%lu (ramfunc %lu) heap=%lu peak=%lu fail=%lu\r\n",
+               (unsigned long)m.ram, (unsigned long)m.static_used, (unsigned long)m.ramfunc,
+               (unsigned long)m.heap_used, (unsigned long)m.heap_peak, (unsigned long)m.heap_fails);
+    Fmt_Printf("MEM stack peak=%lu reserved=%lu%s headroom=%lu\r\n",
+               (unsigned long)m.stack_peak, (unsigned long)m.stack_reserved,
+               (m.stack_peak > m.stack_reserved) ? " (OVER)" : "", (unsigned long)m.headroom);
+}
+
+/* ===== RAMFUNC 벤치마크 ('p') - 같은 일을 -DRAMFUNC_ENABLE=0 빌드와 비교 ===== */
+#define PERF_RUNS   8
+#define PERF_ECHO_US 2000U      // 초음파 ECHO 대기 루프를 도는 시간 (바퀴당 사이클 = 에지 해상도)
+
+static uint16_t perf_pixels[64];
+static volatile uint8_t perf_req;
+
+static void Perf_Fill(void)     { LCD_SetWindow(0, 0, 63, 0); LCD_WriteColorFast(COLOR_BLACK, 64); }
+static void Perf_Buffer(void)   { LCD_SetWindow(0, 0, 63, 0); LCD_WriteBuffer(perf_pixels, 64); }
+static void Perf_Stream(void)
+{
+    LCD_SetWindow(0, 0, 63, 0);
+    LCD_StreamBegin();
+    for (uint8_t i = 0; i < 16; i++) LCD_StreamColor(COLOR_BLACK, 4);
+    LCD_StreamEnd();
+}
+static void Perf_Circle(void)   { LCD_FillCircle(12, 12, 10, COLOR_BLACK); }
+static void Perf_Round(void)    { LCD_RoundRect(0, 0, 40, 20, 6, COLOR_BLACK); }
+static void Perf_Line(void)     { LCD_ThickLine(0, 0, 40, 20, 3, COLOR_BLACK); }
+
+typedef struct {
+    const char *name;
+    void (*run)(void);
+    const void *fn;             // 재는 함수 (위치 표시용)
+} PerfCase_t;
+
+static const PerfCase_t perf_cases[] = {
+    { "WriteColorFast x64", Perf_Fill,   (const void *)LCD_WriteColorFast },
+    { "WriteBuffer x64",    Perf_Buffer, (const void *)LCD_WriteBuffer },
+    { "StreamColor 16x4",   Perf_Stream, (const void *)LCD_StreamColor },
+    { "FillCircle r10",     Perf_Circle, (const void *)LCD_FillCircle },
+    { "RoundRect 40x20",    Perf_Round,  (const void *)LCD_RoundRect },
+    { "ThickLine t3",       Perf_Line,   (const void *)LCD_ThickLine },
+};
+
+/**
+ * @brief 함수별 최소 사이클 (DWT, PERF_RUNS번 중) - 화면 왼쪽 위(상태 표시줄, 눈 윗부분)를 검게 칠하므로
+ *        끝나면 UI_Invalidate로 다음 UI_Update부터 다시 그림
+ */
+void PERF_RamFuncs(void)
+{
+    MemMon_Stats_t m;
+    uint32_t t0, polls;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint8_t k = 0; k < sizeof(perf_cases) / sizeof(perf_cases[0]); k++)
+    {
+        const PerfCase_t *c = &perf_cases[k];
+        uint32_t best = 0xFFFFFFFFU;
+
+        for (uint8_t r = 0; r < PERF_RUNS; r++)
+        {
+            uint32_t t0 = DWT->CYCCNT;
+
+            c->run();
+            if (DWT->CYCCNT - t0 < best) best = DWT->CYCCNT - t0;
         }
+        Fmt_Printf("PERF %-18s %7lu cyc %5lu us  %s\r\n", c->name, (unsigned long)best,
+                   (unsigned long)(best / (SystemCoreClock / 1000000U)),
+                   (((uintptr_t)c->fn >> 28) == 0x2U) ? "SRAM" : "FLASH");
     }
 
-    printf("Scan complete.\r\n");
+    UI_Invalidate();
+
+    /* ECHO 대기는 타임아웃까지 시간이 정해져 있으므로 한 바퀴 비용으로 (위치는 같이 올라가는 Timebase_Us) */
+    t0 = DWT->CYCCNT;
+    polls = Ultrasonic_EchoPolls(PERF_ECHO_US);
+    t0 = DWT->CYCCNT - t0;
+    Fmt_Printf("PERF %-18s %7lu cyc/poll %4lu polls  %s\r\n", "Echo wait loop",
+               (unsigned long)(polls ? t0 / polls : 0), (unsigned long)polls,
+               (((uintptr_t)Timebase_Us >> 28) == 0x2U) ? "SRAM" : "FLASH");
+
+    MemMon_Get(&m);
+    Fmt_Printf("PERF ramfunc RAM cost %lu bytes\r\n", (unsigned long)m.ramfunc);
 }
 
+/**
+ * @brief 최근 상태 전이 (시각 ms) + 상태별 누적 체류 시간
+ */
+void FSM_PrintTrace(void)
+{
+    RobotTrace_t tr[ROBOT_TRACE_LEN];
+    uint8_t n = RobotState_Trace(tr, ROBOT_TRACE_LEN);
+    uint32_t total = 0;
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        Fmt_Printf("FSM %8lu.%03lu ms %s -> %s\r\n",
+                   (unsigned long)(tr[i].t_us / 1000U), (unsigned long)(tr[i].t_us % 1000U),
+                   RobotState_Name(tr[i].from), RobotState_Name(tr[i].to));
+    }
+
+    for (uint8_t s = 0; s < STATE_COUNT; s++)
+        if (s != STATE_AUTO) total += RobotState_TimeInMs(s);
+
+    for (uint8_t s = 0; s < STATE_COUNT; s++)
+    {
+        uint32_t ms = RobotState_TimeInMs(s);
+
+        Fmt_Printf("FSM %-7s %7lu ms %3lu%% x%u\r\n", RobotState_Name(s), (unsigned long)ms,
+                   (unsigned long)(total ? (uint64_t)ms * 100U / total : 0), RobotState_Entries(s));
+    }
+}
+
+/* 주행 명령은 robot_command.c - 여기는 진단 / 화면 명령만 */
 void Handle_Command(uint8_t cmd)
 {
+    if (RobotCommand_Handle(cmd))
+        return;
+
     switch (cmd)
     {
-    case 't':
-    case 'T':
-        start_flag  = 1;
-        manual_mode = 0;
-        Buzzer_Stop();
-        printf("AUTO MODE START\r\n");
-        RobotState_Set(STATE_SCAN);
+    case 'i':
+    case 'I':
+        i2c_req = 1;
+        break;
+
+    case 'f':
+    case 'F':
+        fsm_req = 1;
         break;
 
-    case 'x':
-    case 'X':
-        start_flag  = 0;
-        manual_mode = 0;
-        Motor_Stop();
-        Buzzer_Stop();
-        printf("STOP\r\n");
-        RobotState_Set(STATE_IDLE);
-        manual_command = 0;
+    case 'm':
+    case 'M':
+        mem_req = 1;            // 스택 칠한 RAM 훑기도 메인 루프에서
         break;
 
-    case 'w':
-    case 'W':
-        manual_mode = 1;
-        start_flag  = 0;
-        Buzzer_Stop();
-        Motor_Forward();
-        printf("MANUAL: FORWARD\r\n");
-        RobotState_Set(STATE_MOVE);
-        manual_command = 1;
+    case 'p':
+    case 'P':
+        perf_req = 1;           // LCD를 쓰므로 메인 루프에서
         break;
 
-    case 's':
-    case 'S':
-        manual_mode = 1;
-        start_flag  = 0;
-        Motor_Backward();
-        Buzzer_PlayMario();
-        RobotState_Set(STATE_REVERSE);
-        printf("MANUAL: BACKWARD\r\n");
-        manual_command = 2;
+    case 'v':
+    case 'V':
+        UI_ToggleView();
+        Fmt_Printf("VIEW TOGGLE\r\n");
         break;
 
-    case 'a':
-    case 'A':
-        manual_mode = 1;
-        start_flag  = 0;
-        Buzzer_Stop();
-        Motor_Left();
-        printf("MANUAL: LEFT\r\n");
-        manual_command = 3;
+    case 'c':
+    case 'C':
+        RecLog_Start(RECLOG_RAM);
+        Fmt_Printf("REC RAM (%u bytes)\r\n", (unsigned)RECLOG_RAM_SIZE);
         break;
 
-    case 'd':
-    case 'D':
-        manual_mode = 1;
-        start_flag  = 0;
-        Buzzer_Stop();
-        Motor_Right();
-        printf("MANUAL: RIGHT\r\n");
-        manual_command = 4;
+    case 'o':
+    case 'O':
+        RecLog_Start(RECLOG_STREAM);
+        Fmt_Printf("REC STREAM\r\n");
         break;
 
-    case 'r':
-    case 'R':
-        Servo_SetAngle(90);
-        printf("SERVO RESET (90 deg)\r\n");
-        manual_command = 5;
+    case 'l':
+    case 'L':
+        RecLog_RequestDump();   // 길어서 메인 루프에서
         break;
     }
 }
 
-void Set_LED_By_State(RobotState_t state)
+/* 상태별 LED 효과 - 상태가 바뀔 때 한 번 LedFx_Play, 이후는 TIM3 인터럽트가 진행 */
+static const LedFx_t state_fx[] = {
+    [STATE_IDLE]    = { LED_FX_BREATHE, {   0,   0, 160 }, { 0, 0,  0 }, 3000 },  // 대기 - 파랑 숨쉬기
+    [STATE_SCAN]    = { LED_FX_SOLID,   {   0, 255,   0 }, { 0, 0,  0 }, 0    },
+    [STATE_DECIDE]  = { LED_FX_SOLID,   { 255,  96,   0 }, { 0, 0,  0 }, 0    },  // 주황
+    [STATE_MOVE]    = { LED_FX_SOLID,   {   0, 255,   0 }, { 0, 0,  0 }, 0    },
+    [STATE_REVERSE] = { LED_FX_BLINK,   { 255,  96,   0 }, { 0, 0,  0 }, 500  },  // 주황 250ms 깜빡임
+    [STATE_ALERT]   = { LED_FX_FADE,    { 255,   0,   0 }, { 255, 0, 96 }, 400 }, // 빨강 ↔ 자홍
+};
+
+static void On_StateChange(RobotState_t state)
 {
-    switch (state)
-    {
-    case STATE_SCAN:
-    case STATE_MOVE:
-        RGB_Set(RGB_COLOR_GREEN);
-        break;
-    case STATE_REVERSE:
-        break;
-    case STATE_ALERT:
-        RGB_Set(RGB_COLOR_RED);
-        break;
-    case STATE_DECIDE:
-        RGB_Set(RGB_COLOR_ORANGE);
-        break;
-    default:
-        RGB_Off();
-        break;
-    }
+    RecLog_State((uint8_t)state);
+    if ((unsigned)state < sizeof(state_fx) / sizeof(state_fx[0]))
+        LedFx_Play(&state_fx[state]);
 }
 
 /* USER CODE END 0 */
@@ -304,6 +338,7 @@ void Set_LED_By_State(RobotState_t state)
 int main(void)
 {
   /* USER CODE BEGIN 1 */
+  MemMon_Init();
   /* USER CODE END 1 */
 
   HAL_Init();
@@ -323,27 +358,37 @@ int main(void)
   MX_TIM1_Init();
   MX_TIM2_Init();
   MX_TIM3_Init();
+  MX_TIM4_Init();
   MX_SPI2_Init();
   MX_I2C1_Init();
 
   /* USER CODE BEGIN 2 */
+  Timebase_Init(&htim1);
+
   I2C_ScanAddresses();
 
+  I2CBus_Init(&hi2c1);
   LCD_INIT();
 
-  Motor_Init();
-  Ultrasonic_Init(&htim1);
+  Motor_Init(&htim3);
+  RGB_Init(&htim3);
+  Encoder_Init();
+  Heading_Init();
+  Ultrasonic_Init();
   Servo_Init(&htim2, TIM_CHANNEL_1);
 
-  Buzzer_Off();
+  Buzzer_Init(&htim4);
 
-  RobotState_Init();
-  RobotState_Set(STATE_IDLE);
+  Param_Init();
+  Behavior_Init();
+  RobotState_SetListener(On_StateChange);
+  On_StateChange(RobotState_Get());
+  RecLog_Start(RECLOG_BOOT_MODE);
 
-  Servo_SetAngle(90);
+  Servo_SetAngle(SERVO_CENTER_ANGLE);
   HAL_Delay(500);
 
-  printf("시작하시려면 t 키를 눌러주세요.\r\n");
+  Fmt_Printf("시작하시려면 t 키를 눌러주세요.\r\n");
   HAL_UART_Receive_IT(&huart2, &rx_char, 1);
 
   LCD_Init();
@@ -358,10 +403,8 @@ int main(void)
 
   while (1)
   {
-      RobotState_t currentState = RobotState_Get();
-      Set_LED_By_State(currentState);
-
-      Buzzer_Update();
+      I2CBus_Poll();
+      Heading_Update();
 
       static uint32_t ui_tick = 0;
       uint32_t now = HAL_GetTick();
@@ -370,149 +413,38 @@ int main(void)
       {
           ui_tick = now;
           UI_Update();
-          Anim_Update();
+          if (UI_EyesVisible())
+              Anim_Update();
       }
 
-      if (currentState != prevState)
-      {
-          switch (currentState)
-          {
-          case STATE_REVERSE:
-          {
-              Motor_Backward();
-              static uint32_t reverse_blink_tick = 0;
-              uint32_t now = HAL_GetTick();
-
-              if (now - reverse_blink_tick >= 500)
-              {
-                  reverse_blink_tick = now;
-                  RGB_Set(RGB_COLOR_ORANGE);
-              }
-              else if (now - reverse_blink_tick >= 250)
-              {
-                  RGB_Off();
-              }
-              break;
-          }
-
-          case STATE_ALERT:
-              Buzzer_PlayAlert();
-              break;
-
-          default:
-              break;
-          }
-          prevState = currentState;
-      }
+      Param_Poll();
+      RecLog_Poll();
 
-      if (!start_flag)
+      if (i2c_req)
       {
-          continue;
+          i2c_req = 0;
+          I2C_PrintStats();
       }
 
-      switch (currentState)
-      {
-      case STATE_IDLE:
-          break;
-
-      case STATE_SCAN:
+      if (fsm_req)
       {
-          if (HAL_GetTick() - last_scan_tick < 40)
-              break;
-
-          last_scan_tick = HAL_GetTick();
-
-          Servo_SetAngle(scan_angle);
-
-          uint16_t dist = Ultrasonic_GetDistance();
-
-          printf("STATE:%s | angle=%3d | dist=%3d cm\r\n",
-                 StateToStr(currentState), scan_angle, dist);
-
-          if (dist > 0 && dist < min_dist)
-          {
-              min_dist  = dist;
-              min_angle = scan_angle;
-          }
-
-          scan_angle += scan_dir * 10;
-
-          if (scan_angle >= 150)
-          {
-              scan_angle = 150;
-              scan_dir = -1;
-              RobotState_Set(STATE_DECIDE);
-          }
-          else if (scan_angle <= 30)
-          {
-              scan_angle = 30;
-              scan_dir = 1;
-              RobotState_Set(STATE_DECIDE);
-          }
-
-          break;
+          fsm_req = 0;
+          FSM_PrintTrace();
       }
 
-      case STATE_DECIDE:
-          printf("STATE:%s | min_angle=%d | min_dist=%d cm\r\n",
-                 StateToStr(currentState), min_angle, min_dist);
-
-          if (min_dist > DIST_SAFE)
-              RobotState_Set(STATE_MOVE);
-          else
-              RobotState_Set(STATE_ALERT);
-          break;
-
-      case STATE_MOVE:
+      if (perf_req)
       {
-          printf("STATE:%s | FORWARD\r\n", StateToStr(currentState));
-          Motor_Forward();
-          RobotState_Set(STATE_SCAN);
-          break;
+          perf_req = 0;
+          PERF_RamFuncs();
       }
 
-      case STATE_REVERSE:
+      /* 스택 최고 수위가 늘 때만 알림 (또는 'm') */
+      if (MemMon_Poll() || mem_req)
       {
-          Motor_Backward();
-          static uint32_t reverse_blink_tick = 0;
-          uint32_t now = HAL_GetTick();
-
-          if (now - reverse_blink_tick >= 500)
-          {
-              reverse_blink_tick = now;
-              RGB_Set(RGB_COLOR_ORANGE);
-          }
-          else if (now - reverse_blink_tick >= 250)
-          {
-              RGB_Off();
-          }
-          break;
-      }
-
-      case STATE_ALERT:
-      {
-          static uint32_t avoid_start = 0;
-          static uint8_t  avoiding = 0;
-
-          if (!avoiding)
-          {
-              if (min_angle < 90) Motor_Right();
-              else Motor_Left();
-
-              avoid_start = HAL_GetTick();
-              avoiding = 1;
-          }
-
-          if (avoiding && HAL_GetTick() - avoid_start > 120)
-          {
-              Motor_Stop();
-              avoiding = 0;
-              min_dist = 999;
-              RobotState_Set(STATE_SCAN);
-          }
-          break;
-      }
+          mem_req = 0;
+          MEM_PrintStats();
       }
+      RobotState_Run(start_flag);
 
     /* USER CODE END WHILE */
 
@@ -594,7 +526,7 @@ static void MX_TIM1_Init(void)
   TIM_MasterConfigTypeDef sMasterConfig = {0};
 
   htim1.Instance = TIM1;
-  htim1.Init.Prescaler = 63;
+  htim1.Init.Prescaler = TIMEBASE_TIM_PSC;
   htim1.Init.CounterMode = TIM_COUNTERMODE_UP;
   htim1.Init.Period = 65535;
   htim1.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
@@ -624,9 +556,9 @@ static void MX_TIM2_Init(void)
   TIM_OC_InitTypeDef sConfigOC = {0};
 
   htim2.Instance = TIM2;
-  htim2.Init.Prescaler = 1279;
+  htim2.Init.Prescaler = SERVO_TIM_PSC;
   htim2.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim2.Init.Period = 999;
+  htim2.Init.Period = SERVO_TIM_ARR;
   htim2.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
   htim2.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
   if (HAL_TIM_Base_Init(&htim2) != HAL_OK)
@@ -666,9 +598,9 @@ static void MX_TIM3_Init(void)
   TIM_OC_InitTypeDef sConfigOC = {0};
 
   htim3.Instance = TIM3;
-  htim3.Init.Prescaler = 1279;
+  htim3.Init.Prescaler = MOTOR_TIM_PSC;
   htim3.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim3.Init.Period = 999;
+  htim3.Init.Period = MOTOR_TIM_ARR;
   htim3.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
   htim3.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
   if (HAL_TIM_Base_Init(&htim3) != HAL_OK)
@@ -680,7 +612,7 @@ static void MX_TIM3_Init(void)
   {
     Error_Handler();
   }
-  if (HAL_TIM_PWM_Init(&htim3) != HAL_OK)
+  if (HAL_TIM_OC_Init(&htim3) != HAL_OK)
   {
     Error_Handler();
   }
@@ -690,15 +622,50 @@ static void MX_TIM3_Init(void)
   {
     Error_Handler();
   }
-  sConfigOC.OCMode = TIM_OCMODE_PWM1;
+  sConfigOC.OCMode = TIM_OCMODE_TIMING;
   sConfigOC.Pulse = 0;
   sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
   sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
-  if (HAL_TIM_PWM_ConfigChannel(&htim3, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  if (HAL_TIM_OC_ConfigChannel(&htim3, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_OC_ConfigChannel(&htim3, &sConfigOC, TIM_CHANNEL_2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  if (HAL_TIM_OC_ConfigChannel(&htim3, &sConfigOC, TIM_CHANNEL_3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+static void MX_TIM4_Init(void)
+{
+  TIM_ClockConfigTypeDef sClockSourceConfig = {0};
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  htim4.Instance = TIM4;
+  htim4.Init.Prescaler = BUZZER_TIM_PSC;
+  htim4.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim4.Init.Period = 999;
+  htim4.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
+  htim4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim4) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sClockSourceConfig.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+  if (HAL_TIM_ConfigClockSource(&htim4, &sClockSourceConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim4, &sMasterConfig) != HAL_OK)
   {
     Error_Handler();
   }
-  HAL_TIM_MspPostInit(&htim3);
 }
 
 static void MX_USART2_UART_Init(void)
@@ -748,10 +715,10 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   HAL_GPIO_Init(ECHO_GPIO_Port, &GPIO_InitStruct);
 
-  GPIO_InitStruct.Pin = GPIO_PIN_5;
-  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+  GPIO_InitStruct.Pin = ENC_L_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
   GPIO_InitStruct.Pull = GPIO_NOPULL;
-  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+  HAL_GPIO_Init(ENC_L_GPIO_Port, &GPIO_InitStruct);
 
   GPIO_InitStruct.Pin = LBB_Pin|LFF_Pin|RFF_Pin|RFB_Pin|RBF_Pin|RBB_Pin;
   GPIO_InitStruct.Mode = GPIO_MODE_OUTPUT_PP;
@@ -776,17 +743,63 @@ static void MX_GPIO_Init(void)
   GPIO_InitStruct.Pull = GPIO_NOPULL;
   GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
   HAL_GPIO_Init(GPIOD_GPIO_Port, &GPIO_InitStruct);
+
+  /* EXTI interrupt init*/
+  HAL_NVIC_SetPriority(EXTI9_5_IRQn, 1, 0);
+  HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
 }
 
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
     if (huart->Instance == USART2)
     {
-        Handle_Command(rx_char);
+        RecLog_Rx(rx_char);
+        if (!Param_RxChar(rx_char))     // ':' 줄은 파라미터 명령
+            Handle_Command(rx_char);
         HAL_UART_Receive_IT(&huart2, &rx_char, 1);
     }
 }
 
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin == ENC_L_Pin)
+    {
+        RecLog_Edge();
+        Encoder_OnEdge();
+    }
+}
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == TIM1)
+    {
+        Timebase_OnOverflow();
+    }
+    else if (htim->Instance == TIM3)
+    {
+        Motor_OnPeriod();
+        RGB_OnPeriod();
+        LedFx_OnTick();
+    }
+    else if (htim->Instance == TIM4)
+    {
+        Buzzer_OnTimer();
+    }
+}
+
+void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef *htim)
+{
+    if (htim->Instance == TIM3)
+    {
+        if (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_1)
+            Motor_OnCompare(MOTOR_SIDE_LEFT);
+        else if (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_2)
+            Motor_OnCompare(MOTOR_SIDE_RIGHT);
+        else if (htim->Channel == HAL_TIM_ACTIVE_CHANNEL_3)
+            RGB_OnCompare();
+    }
+}
+
 void Error_Handler(void)
 {
   __disable_irq();
@@ -0,0 +1,295 @@
+/**
+ * @file param.c
+ * @brief 튜닝 파라미터 표 + UART 명령 줄 + 플래시 저장 (param.h)
+ *
+ * 플래시 태그 = (PARAM_LAYOUT << 8) | (번호 + 1).
+ * 파라미터 번호나 뜻이 바뀌면 PARAM_LAYOUT을 올림 - 예전 레코드는 태그가 달라서 무시됨.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "stm32f1xx_hal.h"
+#include "param.h"
+#include "robot_config.h"
+#include "robot_state.h"
+#include "drivers/flash_ee.h"
+#include "drivers/fmt.h"
+
+#define PARAM_LAYOUT    1
+#define PARAM_TAG(id)   ((uint16_t)((PARAM_LAYOUT << 8) | ((id) + 1)))
+
+#define LINE_MAX        32
+#define LINE_GAP_MS     2000        // 줄 중간에 이만큼 끊기면 버림 - 떠돌던 ':' 뒤 'x'(정지)가 먹히지 않게
+
+typedef struct {
+    const char *name;
+    uint16_t min, max;
+    uint16_t def;                   // 튜닝 프로파일 값
+} ParamDef_t;
+
+static const ParamDef_t defs[PARAM_COUNT] = {
+    [PARAM_SCAN_STEP]      = { "scan_step",    1,   45,   SERVO_STEP_ANGLE },
+    [PARAM_SCAN_PERIOD_MS] = { "scan_period",  SERVO_FRAME_US / 1000U, 1000, SCAN_PERIOD_MS },
+    [PARAM_SCAN_MIN]       = { "scan_min",     0,   180,  SERVO_MIN_ANGLE },
+    [PARAM_SCAN_MAX]       = { "scan_max",     0,   180,  SERVO_MAX_ANGLE },
+    [PARAM_DIST_SAFE]      = { "dist_safe",    ULTRASONIC_MIN_CM, ULTRASONIC_MAX_CM, DIST_SAFE },
+    [PARAM_DIST_WARNING]   = { "dist_warning", ULTRASONIC_MIN_CM, ULTRASONIC_MAX_CM, DIST_WARNING },
+    [PARAM_AVOID_TURN_DEG] = { "avoid_turn",   1,   180,  AVOID_TURN_DEG },
+    [PARAM_AVOID_ARC_MS]   = { "avoid_arc_ms", 50,  5000, AVOID_ARC_MS },
+    [PARAM_CRUISE_SPEED]   = { "cruise_speed", 20,  100,  MOTOR_BASE_SPEED },
+};
+
+uint16_t param_val[PARAM_COUNT];
+
+/* 수신 줄 - ISR이 채우고 메인 루프가 처리 */
+typedef enum { LINE_IDLE = 0, LINE_COLLECT, LINE_READY } LineState_t;
+
+static char line[LINE_MAX];
+static volatile uint8_t line_len;
+static volatile LineState_t line_state;
+static volatile uint32_t line_tick;     // 마지막으로 받은 바이트 (LINE_COLLECT)
+
+/* ===== 내부 함수 ===== */
+
+static uint8_t In_Range(ParamId_t id, uint16_t v)
+{
+    return v >= defs[id].min && v <= defs[id].max;
+}
+
+/**
+ * @brief 파라미터 사이 관계
+ */
+static uint8_t Consistent(const uint16_t *v)
+{
+    return v[PARAM_SCAN_MIN] < v[PARAM_SCAN_MAX] &&
+           v[PARAM_SCAN_STEP] <= v[PARAM_SCAN_MAX] - v[PARAM_SCAN_MIN] &&
+           v[PARAM_DIST_WARNING] < v[PARAM_DIST_SAFE];
+}
+
+static int Find(const char *name)
+{
+    for (uint8_t i = 0; i < PARAM_COUNT; i++)
+        if (strcmp(name, defs[i].name) == 0) return i;
+    return -1;
+}
+
+static void Print(ParamId_t id)
+{
+    Fmt_Printf("PARAM %s=%u (%u..%u, default %u)\r\n", defs[id].name, param_val[id],
+               defs[id].min, defs[id].max, defs[id].def);
+}
+
+static const char *Result_Str(ParamResult_t r)
+{
+    switch (r)
+    {
+    case PARAM_OK:       return "OK";
+    case PARAM_UNKNOWN:  return "unknown name";
+    case PARAM_RANGE:    return "out of range";
+    case PARAM_NUMBER:   return "not a number";
+    case PARAM_CONFLICT: return "conflicts with another param";
+    case PARAM_FLASH:    return "flash error";
+    default:             return "?";
+    }
+}
+
+/**
+ * @brief 명령 줄 하나 (':' 뒤) - "set 이름 값" 등
+ */
+static void Handle_Line(char *s)
+{
+    char *cmd  = strtok(s, " ");
+    char *name = strtok(NULL, " ");
+    char *val  = strtok(NULL, " ");
+    int id = name ? Find(name) : -1;
+
+    if (!cmd)
+        return;
+
+    if (strcmp(cmd, "list") == 0)
+    {
+        for (uint8_t i = 0; i < PARAM_COUNT; i++) Print(i);
+        Fmt_Printf("PARAM flash %u/%u records\r\n", FlashEE_Used(), (unsigned)FLASH_EE_RECORDS);
+    }
+    else if (strcmp(cmd, "get") == 0)
+    {
+        if (id < 0) Fmt_Printf("PARAM ERR %s\r\n", Result_Str(PARAM_UNKNOWN));
+        else        Print(id);
+    }
+    else if (strcmp(cmd, "set") == 0 && val)
+    {
+        char *end;
+        unsigned long v = strtoul(val, &end, 10);
+        ParamResult_t r;
+
+        /* 숫자만, uint16_t로 줄이기 전에 범위 검사 (65636 → 100이 되지 않게) */
+        if (id < 0)                                          r = PARAM_UNKNOWN;
+        else if (*val < '0' || *val > '9' || *end != '\0')   r = PARAM_NUMBER;
+        else if (v < defs[id].min || v > defs[id].max)       r = PARAM_RANGE;
+        else                                                 r = Param_Set(id, (uint16_t)v);
+
+        if (r == PARAM_OK) Print(id);
+        else               Fmt_Printf("PARAM ERR %s\r\n", Result_Str(r));
+    }
+    else if (strcmp(cmd, "save") == 0)
+    {
+        if (RobotState_Get() != STATE_IDLE)
+            Fmt_Printf("PARAM ERR save only in IDLE (x)\r\n");
+        else
+            Fmt_Printf("PARAM save %s\r\n", Result_Str(Param_Save()));
+    }
+    else if (strcmp(cmd, "defaults") == 0)
+    {
+        Param_Defaults();
+        Fmt_Printf("PARAM defaults (not saved)\r\n");
+    }
+    else
+    {
+        Fmt_Printf("PARAM ERR usage: :list | :get <name> | :set <name> <value> | :save | :defaults\r\n");
+    }
+}
+
+/* ===== 외부 API ===== */
+
+void Param_Init(void)
+{
+    uint16_t v[PARAM_COUNT];
+    uint8_t loaded = 0;
+
+    Param_Defaults();
+    if (FlashEE_Init() != FLASH_EE_OK)
+    {
+        Fmt_Printf("PARAM flash init failed - defaults\r\n");
+        return;
+    }
+
+    for (uint8_t i = 0; i < PARAM_COUNT; i++)
+    {
+        uint16_t f;
+
+        v[i] = param_val[i];
+        if (FlashEE_Read(PARAM_TAG(i), &f) == FLASH_EE_OK && In_Range(i, f))
+        {
+            v[i] = f;
+            loaded++;
+        }
+    }
+
+    if (!Consistent(v))
+    {
+        Fmt_Printf("PARAM flash values inconsistent - defaults\r\n");
+        return;
+    }
+    memcpy(param_val, v, sizeof(param_val));
+    if (loaded)
+        Fmt_Printf("PARAM %u loaded from flash\r\n", loaded);
+}
+
+ParamResult_t Param_Set(ParamId_t id, uint16_t value)
+{
+    uint16_t v[PARAM_COUNT];
+
+    if ((unsigned)id >= PARAM_COUNT) return PARAM_UNKNOWN;
+    if (!In_Range(id, value))        return PARAM_RANGE;
+
+    memcpy(v, param_val, sizeof(v));
+    v[id] = value;
+    if (!Consistent(v))              return PARAM_CONFLICT;
+
+    param_val[id] = value;
+    return PARAM_OK;
+}
+
+/* 플래시에 같은 값이 있으면 FlashEE_Write가 건너뜀 - 바뀐 것만 덧붙음 */
+ParamResult_t Param_Save(void)
+{
+    for (uint8_t i = 0; i < PARAM_COUNT; i++)
+        if (FlashEE_Write(PARAM_TAG(i), param_val[i]) != FLASH_EE_OK)
+            return PARAM_FLASH;
+    return PARAM_OK;
+}
+
+void Param_Defaults(void)
+{
+    for (uint8_t i = 0; i < PARAM_COUNT; i++)
+        param_val[i] = defs[i].def;
+}
+
+const char *Param_Name(ParamId_t id)
+{
+    return ((unsigned)id < PARAM_COUNT) ? defs[id].name : "?";
+}
+
+/**
+ * @brief UART 수신 ISR - ':'부터 줄 끝까지 모음 (처리 전 새 줄은 버림)
+ * @note  줄 중간에 LINE_GAP_MS 넘게 끊기면 그 줄은 버리고 이 바이트는 한 글자 명령으로
+ *        (이름에 x/s/a/d/t가 들어가서 글자로는 못 가름 - 서버는 한 줄을 한 번에 보냄)
+ */
+uint8_t Param_RxChar(uint8_t c)
+{
+    switch (line_state)
+    {
+    case LINE_IDLE:
+        if (c != ':') return 0;
+        line_len = 0;
+        line_tick = HAL_GetTick();
+        line_state = LINE_COLLECT;
+        return 1;
+
+    case LINE_COLLECT:
+        if (HAL_GetTick() - line_tick > LINE_GAP_MS)
+        {
+            line_state = LINE_IDLE;
+            return Param_RxChar(c);
+        }
+        line_tick = HAL_GetTick();
+
+        if (c == '\r' || c == '\n')
+        {
+            line[line_len] = '\0';
+            line_state = LINE_READY;
+        }
+        else if (c == '\b' || c == 0x7F)
+        {
+            if (line_len) line_len--;
+        }
+        else if (line_len < LINE_MAX - 1)
+        {
+            line[line_len++] = (char)c;
+        }
+        return 1;
+
+    case LINE_READY:
+    default:
+        return c == ':';
+    }
+}
+
+void Param_Poll(void)
+{
+    char buf[LINE_MAX];
+    uint32_t primask;
+
+    if (line_state == LINE_COLLECT)
+    {
+        uint8_t stale;
+
+        /* ISR이 그사이 바이트를 더하지 않게 */
+        primask = __get_PRIMASK();
+        __disable_irq();
+        stale = (line_state == LINE_COLLECT && HAL_GetTick() - line_tick > LINE_GAP_MS);
+        if (stale) line_state = LINE_IDLE;
+        __set_PRIMASK(primask);
+
+        if (stale)
+            Fmt_Printf("PARAM ERR line timeout\r\n");
+        return;
+    }
+
+    if (line_state != LINE_READY)
+        return;
+
+    memcpy(buf, line, sizeof(buf));
+    line_state = LINE_IDLE;
+    Handle_Line(buf);
+}
@@ -0,0 +1,279 @@
+/**
+ * @file reclog.c
+ * @brief 주행 기록 (reclog.h) - RAM 버퍼 / 스트림 대기열에 사건 덧붙이기, UART로 hex 줄 출력
+ *
+ * 사건은 ISR(UART 수신, 엔코더)과 메인 루프(거리, 상태) 양쪽에서 오므로
+ * tick 읽기부터 덧붙이기까지 인터럽트를 막음 (tick 차가 음수가 되지 않게).
+ */
+
+#include "stm32f1xx_hal.h"
+#include "reclog.h"
+#include "param.h"
+#include "robot_command.h"
+#include "robot_state.h"
+#include "drivers/fmt.h"
+
+#define EVENT_MAX       9               // 머리 바이트 + varint tick 차 (5) + 값 (3)
+#define LINE_BYTES      32              // "REC " 줄 하나
+#define STREAM_FLUSH_MS 100             // 덜 찬 줄도 이 시간이 지나면 내보냄
+
+static RecLog_Mode_t mode;
+static uint32_t last_tick;
+
+/* RAM 모드 */
+static uint8_t  ram[RECLOG_RAM_SIZE];
+static uint32_t ram_len;
+
+/* 스트림 모드 - ISR이 채우고 메인 루프가 비움 */
+static uint8_t  fifo[RECLOG_STREAM_SIZE];
+static volatile uint16_t fifo_head, fifo_tail;
+static uint32_t flush_tick;
+
+static volatile uint16_t lost;          // 자리가 없어 버린 사건 수
+static uint16_t lost_reported;
+
+/* 'l' 꺼내기 - RecLog_Poll 한 번에 한 줄 (2 KB를 한꺼번에 보내면 메인 루프가 약 390 ms 멈춤) */
+static volatile uint8_t dump_req;
+static uint8_t  dumping;
+static uint32_t dump_pos, dump_len;
+
+/* ===== 내부 함수 ===== */
+
+static uint8_t Put_Varint(uint8_t *p, uint32_t v)
+{
+    uint8_t n = 0;
+
+    while (v >= 0x80U)
+    {
+        p[n++] = (uint8_t)(v | 0x80U);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+static uint16_t Fifo_Free(void)
+{
+    return (uint16_t)((fifo_tail + RECLOG_STREAM_SIZE - fifo_head - 1U) % RECLOG_STREAM_SIZE);
+}
+
+/* 인터럽트가 막힌 상태에서 */
+static uint8_t Store(const uint8_t *p, uint8_t n)
+{
+    if (mode == RECLOG_RAM)
+    {
+        if (ram_len + n > RECLOG_RAM_SIZE) return 0;
+        for (uint8_t i = 0; i < n; i++) ram[ram_len++] = p[i];
+        return 1;
+    }
+
+    if (Fifo_Free() < n) return 0;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        fifo[fifo_head] = p[i];
+        fifo_head = (uint16_t)((fifo_head + 1U) % RECLOG_STREAM_SIZE);
+    }
+    return 1;
+}
+
+/**
+ * @brief 사건 하나 - 값은 이미 인코딩된 바이트 (없으면 n = 0)
+ */
+static void Event(RecLog_Type_t type, const uint8_t *val, uint8_t n)
+{
+    uint8_t buf[EVENT_MAX + EVENT_MAX];
+    uint8_t len = 0;
+    uint32_t primask, now, dt;
+
+    if (mode == RECLOG_OFF)
+        return;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    now = HAL_GetTick();
+    dt  = now - last_tick;
+
+    /* 스트림에서 버린 사건이 있으면 먼저 알림 (시각은 이 사건과 같음) */
+    if (lost != lost_reported)
+    {
+        buf[len++] = (uint8_t)((RECLOG_LOST << 5) | (dt < 31U ? dt : 31U));
+        if (dt >= 31U) len += Put_Varint(&buf[len], dt);
+        len += Put_Varint(&buf[len], (uint16_t)(lost - lost_reported));
+        dt = 0;
+    }
+
+    buf[len++] = (uint8_t)((type << 5) | (dt < 31U ? dt : 31U));
+    if (dt >= 31U) len += Put_Varint(&buf[len], dt);
+    for (uint8_t i = 0; i < n; i++) buf[len++] = val[i];
+
+    if (Store(buf, len))
+    {
+        last_tick = now;
+        lost_reported = lost;
+    }
+    else
+    {
+        lost++;
+    }
+
+    __set_PRIMASK(primask);
+}
+
+static void Print_Hex(const uint8_t *p, uint16_t n)
+{
+    Fmt_Printf("REC ");
+    for (uint16_t i = 0; i < n; i++)
+        Fmt_Printf("%02X", p[i]);
+    Fmt_Printf("\r\n");
+}
+
+/* RAM 기록에서 한 줄, 다 보냈으면 끝 줄 */
+static void Dump_Line(void)
+{
+    uint32_t n = dump_len - dump_pos;
+
+    if (n)
+    {
+        if (n > LINE_BYTES) n = LINE_BYTES;
+        Print_Hex(&ram[dump_pos], (uint16_t)n);
+        dump_pos += n;
+        return;
+    }
+
+    dumping = 0;
+    Fmt_Printf("REC END %lu bytes, %u lost%s\r\n", (unsigned long)dump_len, lost,
+               (mode == RECLOG_RAM && lost) ? " (buffer full)" : "");
+}
+
+/* 스트림 대기열에서 한 줄 (force = 덜 차도) */
+static void Stream_Flush(uint8_t force)
+{
+    uint8_t line[LINE_BYTES];
+    uint16_t n = 0;
+
+    if (!force && (uint16_t)((fifo_head + RECLOG_STREAM_SIZE - fifo_tail) % RECLOG_STREAM_SIZE) < LINE_BYTES)
+        return;
+
+    while (fifo_tail != fifo_head && n < LINE_BYTES)
+    {
+        line[n++] = fifo[fifo_tail];
+        fifo_tail = (uint16_t)((fifo_tail + 1U) % RECLOG_STREAM_SIZE);
+    }
+    if (n)
+        Print_Hex(line, n);
+}
+
+/* ===== 외부 API ===== */
+
+/**
+ * @brief 머리를 쓰고 기록 시작 - 다시 부르면 처음부터
+ */
+void RecLog_Start(RecLog_Mode_t m)
+{
+    uint8_t hdr[RECLOG_HDR_FIXED + 2 * PARAM_COUNT];
+    uint32_t primask = __get_PRIMASK();
+    uint8_t i = 0;
+
+    __disable_irq();
+    mode = m;
+    ram_len = 0;
+    dumping = 0;                        // 꺼내던 기록은 새 머리가 덮어씀
+    fifo_head = fifo_tail = 0;
+    lost = lost_reported = 0;
+    last_tick = flush_tick = HAL_GetTick();
+
+    hdr[i++] = RECLOG_MAGIC0;
+    hdr[i++] = RECLOG_MAGIC1;
+    hdr[i++] = RECLOG_VERSION;
+    hdr[i++] = PARAM_COUNT;
+    for (uint8_t k = 0; k < 4; k++) hdr[i++] = (uint8_t)(last_tick >> (8 * k));
+    hdr[i++] = (uint8_t)RobotState_Get();
+    hdr[i++] = (uint8_t)((start_flag ? 1U : 0U) | (manual_mode ? 2U : 0U));
+    for (uint8_t k = 0; k < PARAM_COUNT; k++)
+    {
+        hdr[i++] = (uint8_t)param_val[k];
+        hdr[i++] = (uint8_t)(param_val[k] >> 8);
+    }
+    if (m != RECLOG_OFF)
+        Store(hdr, i);
+    __set_PRIMASK(primask);
+}
+
+void RecLog_Stop(void)
+{
+    mode = RECLOG_OFF;
+}
+
+RecLog_Mode_t RecLog_Mode(void)
+{
+    return mode;
+}
+
+void RecLog_Dist(RecLog_Type_t type, uint16_t cm)
+{
+    uint8_t v[3];
+
+    Event(type, v, Put_Varint(v, cm));
+}
+
+void RecLog_Rx(uint8_t c)
+{
+    Event(RECLOG_RX, &c, 1);
+}
+
+void RecLog_Edge(void)
+{
+    Event(RECLOG_EDGE, 0, 0);
+}
+
+void RecLog_State(uint8_t state)
+{
+    Event(RECLOG_STATE, &state, 1);
+}
+
+void RecLog_RequestDump(void)
+{
+    dump_req = 1;
+}
+
+void RecLog_Poll(void)
+{
+    if (dump_req)
+    {
+        dump_req = 0;
+        dump_pos = 0;
+        dump_len = ram_len;             // 꺼내는 동안 붙는 사건은 다음 'l'에서
+        dumping = 1;
+    }
+
+    if (dumping)
+    {
+        Dump_Line();
+        return;                         // 한 번에 한 줄 - 스트림은 다음 Poll에서
+    }
+
+    if (mode != RECLOG_STREAM)
+        return;
+
+    if (HAL_GetTick() - flush_tick >= STREAM_FLUSH_MS)
+    {
+        flush_tick = HAL_GetTick();
+        Stream_Flush(1);
+    }
+    else
+    {
+        Stream_Flush(0);
+    }
+}
+
+uint32_t RecLog_Data(const uint8_t **buf)
+{
+    *buf = ram;
+    return ram_len;
+}
+
+uint16_t RecLog_Lost(void)
+{
+    return lost;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file robot_behavior.c
+ * @brief 자율 주행 상태 표 - main.c 루프의 switch를 상태별 함수로 나눔
+ *
+ * SCAN  : 주기마다 서보를 한 칸씩 옮기며 거리 측정, 한쪽 끝에 닿으면 → DECIDE
+ * DECIDE: 가장 가까운 거리가 dist_safe보다 멀면 → MOVE, 아니면 → ALERT
+ * MOVE  : 직진 → SCAN
+ * ALERT : 진입 때 곡선 회피 또는 제자리 회전 시작, 끝나면 → SCAN
+ * AUTO  : 위 넷의 상위 상태 - 밖에서 들어올 때 최소 거리 기록을 새로 시작
+ *
+ * 스캔 / 거리 / 회피 / 속도 값은 param.h (UART로 바꾸면 다음 틱부터 반영).
+ */
+
+#include "drivers/fmt.h"
+#include "robot_behavior.h"
+#include "robot_config.h"
+#include "param.h"
+#include "reclog.h"
+#include "drivers/motor.h"
+#include "drivers/heading.h"
+#include "drivers/servo.h"
+#include "drivers/ultrasonic.h"
+#include "drivers/buzzer.h"
+#include "drivers/radar.h"
+
+/* 스캔 범위 / 간격 / 주기는 파라미터 (기본값 = 튜닝 프로파일) */
+uint8_t scan_angle = SERVO_MIN_ANGLE;   // ui_fsm.c에서 읽음
+static int8_t scan_dir = 1;
+
+static uint16_t min_dist = 999;
+static uint8_t  min_angle = SERVO_CENTER_ANGLE;
+
+static uint8_t avoid_arc;       // 1 = 이번 회피는 곡선 (멈추지 않음)
+static uint8_t sweep_done;
+
+/* ===== 가드 ===== */
+
+static uint8_t Sweep_Done(void)
+{
+    return sweep_done;
+}
+
+static uint8_t Path_Clear(void)
+{
+    return min_dist > Param_Get(PARAM_DIST_SAFE);
+}
+
+/* 곡선은 모터 인터럽트가 끝내고 직진으로 돌아옴 - 바로 다음 스캔 */
+static uint8_t Avoid_Done(void)
+{
+    return avoid_arc || !Heading_Busy();
+}
+
+/* ===== 상태 동작 ===== */
+
+static void Auto_Entry(void)
+{
+    min_dist = 999;
+}
+
+/* 스캔 범위가 바뀌었을 수 있음 - 지금 각도를 새 범위 안으로 */
+static void Scan_Entry(void)
+{
+    uint8_t lo = (uint8_t)Param_Get(PARAM_SCAN_MIN);
+    uint8_t hi = (uint8_t)Param_Get(PARAM_SCAN_MAX);
+
+    if (scan_angle < lo) scan_angle = lo;
+    if (scan_angle > hi) scan_angle = hi;
+    sweep_done = 0;
+}
+
+static void Scan_Tick(void)
+{
+    int16_t lo = (int16_t)Param_Get(PARAM_SCAN_MIN);
+    int16_t hi = (int16_t)Param_Get(PARAM_SCAN_MAX);
+    int16_t next;
+    uint16_t dist;
+
+    Servo_SetAngle(scan_angle);
+
+    dist = Ultrasonic_GetDistance();
+    RecLog_Dist(RECLOG_DIST, dist);
+
+    Fmt_Printf("STATE:%s | angle=%3d | dist=%3d cm\r\n",
+               RobotState_Name(STATE_SCAN), scan_angle, dist);
+
+    Radar_AddSample(scan_angle, dist);
+
+    if (dist > 0 && dist < min_dist)
+    {
+        min_dist  = dist;
+        min_angle = scan_angle;
+    }
+
+    /* 부호 있는 값으로 계산 (scan_min = 0이면 uint8_t가 넘어감) */
+    next = (int16_t)(scan_angle + scan_dir * (int16_t)Param_Get(PARAM_SCAN_STEP));
+
+    if (next >= hi)
+    {
+        next = hi;
+        scan_dir = -1;
+        sweep_done = 1;
+    }
+    else if (next <= lo)
+    {
+        next = lo;
+        scan_dir = 1;
+        sweep_done = 1;
+    }
+    scan_angle = (uint8_t)next;
+}
+
+static void Decide_Tick(void)
+{
+    Fmt_Printf("STATE:%s | min_angle=%d | min_dist=%d cm\r\n",
+               RobotState_Name(STATE_DECIDE), min_angle, min_dist);
+}
+
+static void Move_Tick(void)
+{
+    int8_t speed = (int8_t)Param_Get(PARAM_CRUISE_SPEED);
+
+    Fmt_Printf("STATE:%s | FORWARD\r\n", RobotState_Name(STATE_MOVE));
+    Motor_SetSpeed(speed, speed);
+}
+
+static void Reverse_Entry(void)
+{
+    Motor_Backward();
+}
+
+static void Alert_Entry(void)
+{
+    /* 장애물 반대쪽으로 (+ = Motor_Left 방향) */
+    int8_t away = (min_angle < SERVO_CENTER_ANGLE) ? -1 : 1;
+
+    Buzzer_PlayAlert();
+
+    /* 아직 여유가 있으면 멈추지 않고 곡선으로 비켜가고, 가까우면 제자리 회전 */
+    avoid_arc = (min_dist > Param_Get(PARAM_DIST_WARNING));
+    if (avoid_arc)
+        Motor_CurveFor((int8_t)Param_Get(PARAM_CRUISE_SPEED), away * MOTOR_ARC_TURN,
+                       Param_Get(PARAM_AVOID_ARC_MS));
+    else
+        Heading_TurnBy(away * (int16_t)Param_Get(PARAM_AVOID_TURN_DEG));
+}
+
+static void Alert_Exit(void)
+{
+    if (avoid_arc)
+        Fmt_Printf("STATE:%s | ARC %ums\r\n", RobotState_Name(STATE_ALERT),
+                   Param_Get(PARAM_AVOID_ARC_MS));
+    else
+        Fmt_Printf("STATE:%s | turned=%d deg%s\r\n", RobotState_Name(STATE_ALERT),
+                   Heading_TurnedDeg(), (Heading_Status() == HEADING_TIMEOUT) ? " (TIMEOUT)" : "");
+
+    min_dist = 999;
+}
+
+/* ===== 상태 표 ===== */
+
+static const RobotTransition_t scan_trans[]   = { { Sweep_Done, STATE_DECIDE } };
+static const RobotTransition_t decide_trans[] = { { Path_Clear, STATE_MOVE }, { NULL, STATE_ALERT } };
+static const RobotTransition_t move_trans[]   = { { NULL, STATE_SCAN } };
+static const RobotTransition_t alert_trans[]  = { { Avoid_Done, STATE_SCAN } };
+
+#define TRANS(t)    (t), (uint8_t)(sizeof(t) / sizeof((t)[0]))
+
+static const RobotStateDesc_t behavior_states[STATE_COUNT] = {
+    /*                name       parent      entry          exit        tick            tick_ms */
+    [STATE_IDLE]    = { "IDLE",    STATE_NONE, NULL,          NULL,       NULL,           NULL, NULL, 0 },
+    [STATE_SCAN]    = { "SCAN",    STATE_AUTO, Scan_Entry,    NULL,       Scan_Tick,      &param_val[PARAM_SCAN_PERIOD_MS], TRANS(scan_trans) },
+    [STATE_DECIDE]  = { "DECIDE",  STATE_AUTO, NULL,          NULL,       Decide_Tick,    NULL, TRANS(decide_trans) },
+    [STATE_MOVE]    = { "MOVE",    STATE_AUTO, NULL,          NULL,       Move_Tick,      NULL, TRANS(move_trans) },
+    [STATE_REVERSE] = { "REVERSE", STATE_NONE, Reverse_Entry, NULL,       Motor_Backward, NULL, NULL, 0 },
+    [STATE_ALERT]   = { "ALERT",   STATE_AUTO, Alert_Entry,   Alert_Exit, NULL,           NULL, TRANS(alert_trans) },
+    [STATE_AUTO]    = { "AUTO",    STATE_NONE, Auto_Entry,    NULL,       NULL,           NULL, NULL, 0 },
+};
+
+void Behavior_Init(void)
+{
+    RobotState_Init(behavior_states);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file robot_command.c
+ * @brief UART 한 글자 주행 명령 (robot_command.h) - main.c Handle_Command에서 나눔
+ *
+ * 상태 전이는 요청만 (RobotState_Set) - 실제 전이는 메인 루프 RobotState_Run.
+ */
+
+#include "robot_command.h"
+#include "robot_config.h"
+#include "robot_state.h"
+#include "drivers/buzzer.h"
+#include "drivers/fmt.h"
+#include "drivers/heading.h"
+#include "drivers/motor.h"
+#include "drivers/servo.h"
+
+uint8_t start_flag = 0;
+uint8_t manual_mode = 0;
+uint8_t manual_command = 0;
+
+uint8_t RobotCommand_Handle(uint8_t cmd)
+{
+    switch (cmd)
+    {
+    case 't':
+    case 'T':
+        start_flag  = 1;
+        manual_mode = 0;
+        Buzzer_Stop();
+        Fmt_Printf("AUTO MODE START\r\n");
+        RobotState_Set(STATE_SCAN);
+        break;
+
+    case 'x':
+    case 'X':
+        start_flag  = 0;
+        manual_mode = 0;
+        Heading_Abort();
+        Motor_Stop();
+        Buzzer_Stop();
+        Fmt_Printf("STOP\r\n");
+        RobotState_Set(STATE_IDLE);
+        manual_command = 0;
+        break;
+
+    case 'w':
+    case 'W':
+        manual_mode = 1;
+        start_flag  = 0;
+        Buzzer_Stop();
+        Heading_Abort();
+        Motor_Forward();
+        Fmt_Printf("MANUAL: FORWARD\r\n");
+        RobotState_Set(STATE_MOVE);
+        manual_command = 1;
+        break;
+
+    case 's':
+    case 'S':
+        manual_mode = 1;
+        start_flag  = 0;
+        Heading_Abort();
+        Motor_Backward();
+        Buzzer_PlayMario();
+        RobotState_Set(STATE_REVERSE);
+        Fmt_Printf("MANUAL: BACKWARD\r\n");
+        manual_command = 2;
+        break;
+
+    case 'a':
+    case 'A':
+        manual_mode = 1;
+        start_flag  = 0;
+        Buzzer_Stop();
+        Heading_Abort();
+        Motor_Left();
+        Fmt_Printf("MANUAL: LEFT\r\n");
+        manual_command = 3;
+        break;
+
+    case 'd':
+    case 'D':
+        manual_mode = 1;
+        start_flag  = 0;
+        Buzzer_Stop();
+        Heading_Abort();
+        Motor_Right();
+        Fmt_Printf("MANUAL: RIGHT\r\n");
+        manual_command = 4;
+        break;
+
+    case 'r':
+    case 'R':
+        Servo_SetAngle(SERVO_CENTER_ANGLE);
+        Fmt_Printf("SERVO RESET (%d deg)\r\n", SERVO_CENTER_ANGLE);
+        manual_command = 5;
+        break;
+
+    default:
+        return 0;
+    }
+    return 1;
+}
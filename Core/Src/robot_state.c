@@ -1,16 +1,145 @@
+/**
+ * @file robot_state.c
+ * @brief 표 기반 상태 머신 엔진 (robot_state.h)
+ *
+ * 전이는 메인 루프(RobotState_Run) 안에서만 일어남 - UART ISR의 RobotState_Set은
+ * 요청만 남기고, 진입/퇴장 동작(모터, 회전 제어)은 메인 문맥에서 실행.
+ * 체류 시간은 Timebase_Us 차이로 상태별 64비트 누적 (짧게 지나가는 DECIDE도 us 단위로 셈) -
+ * 32비트 us 차이는 71.6분에 넘어가므로 RobotState_Run마다 조금씩 더함 (IDLE에 오래 있어도 맞게).
+ */
+
+#include "stm32f1xx_hal.h"
 #include "robot_state.h"
+#include "drivers/timebase.h"
+
+#define HIERARCHY_MAX   4       // 상위 상태 깊이 최대
 
 /* ★ 전역(파일 내부) 상태 변수 */
+static const RobotStateDesc_t *states;
 static RobotState_t currentState = STATE_IDLE;
+static volatile RobotState_t request = STATE_NONE;
+static RobotState_Listener_t listener;
+
+/* 상태별 타이머 */
+static uint32_t entered_us;             // 현재 상태 진입 시각
+static uint32_t accrued_us;             // time_us[currentState]에 여기까지 더함
+static uint32_t last_tick_us;
+static uint8_t  tick_due;               // 진입 직후 첫 틱
+
+/* 체류 통계 + 전이 기록 */
+static uint64_t time_us[STATE_COUNT];
+static uint16_t entries[STATE_COUNT];
+static RobotTrace_t trace[ROBOT_TRACE_LEN];
+static uint8_t trace_head;              // 다음에 쓸 자리
+static uint8_t trace_count;
+
+/* ===== 내부 함수 ===== */
+
+static RobotState_t Parent(RobotState_t s)
+{
+    return states[s].parent;
+}
+
+/**
+ * @brief a가 s 자신이거나 s의 상위 상태인지
+ */
+static uint8_t Contains(RobotState_t a, RobotState_t s)
+{
+    for (; s != STATE_NONE; s = Parent(s))
+        if (s == a) return 1;
+    return 0;
+}
+
+/* 현재 상태 체류 시간을 지금까지 더함 - 차이가 짧을 때 (메인 루프마다) */
+static uint32_t Accrue(void)
+{
+    uint32_t now = Timebase_Us();
+
+    time_us[currentState] += now - accrued_us;
+    accrued_us = now;
+    return now;
+}
+
+/**
+ * @brief s가 다른 상태의 상위 상태인지 - 상위 상태로는 직접 전이하지 않음 (robot_state.h)
+ */
+static uint8_t Is_Parent(RobotState_t s)
+{
+    for (uint8_t i = 0; i < STATE_COUNT; i++)
+        if (states[i].name && states[i].parent == s) return 1;     // 빈 칸(0으로 채워짐)은 빼고
+    return 0;
+}
+
+static void Trace_Push(uint32_t now, RobotState_t from, RobotState_t to)
+{
+    trace[trace_head].t_us = now;
+    trace[trace_head].from = (uint8_t)from;
+    trace[trace_head].to   = (uint8_t)to;
+    trace_head = (uint8_t)((trace_head + 1) % ROBOT_TRACE_LEN);
+    if (trace_count < ROBOT_TRACE_LEN) trace_count++;
+}
+
+/**
+ * @brief from → to: 공통 조상 아래만 퇴장 (안쪽부터) / 진입 (바깥부터)
+ */
+static void Transition(RobotState_t to)
+{
+    RobotState_t from = currentState;
+    RobotState_t path[HIERARCHY_MAX];
+    uint8_t depth = 0;
+    uint32_t now;
+
+    if (to == from || to >= STATE_COUNT)
+        return;
+
+    for (RobotState_t s = from; s != STATE_NONE && !Contains(s, to); s = Parent(s))
+        if (states[s].exit) states[s].exit();
+
+    for (RobotState_t s = to; s != STATE_NONE && !Contains(s, from) && depth < HIERARCHY_MAX; s = Parent(s))
+        path[depth++] = s;
+
+    now = Accrue();
+    entered_us = now;
+    tick_due = 1;
+    Trace_Push(now, from, to);
+
+    currentState = to;
+    if (listener)
+        listener(to);
+
+    while (depth)
+    {
+        RobotState_t s = path[--depth];
+
+        entries[s]++;
+        if (states[s].entry) states[s].entry();
+    }
+}
+
+/* ===== 외부 API ===== */
 
-void RobotState_Init(void)
+void RobotState_Init(const RobotStateDesc_t *table)
 {
+    states = table;
     currentState = STATE_IDLE;
+    request = STATE_NONE;
+    entered_us = accrued_us = Timebase_Us();
+    tick_due = 1;
+    trace_head = trace_count = 0;
+    for (uint8_t s = 0; s < STATE_COUNT; s++) { time_us[s] = 0; entries[s] = 0; }
+    entries[STATE_IDLE] = 1;
 }
 
+/* 요청만 기록 (UART ISR에서 불릴 수 있음) - 같은 루프 안 여러 요청은 마지막 것, 상위 상태는 무시 */
 void RobotState_Set(RobotState_t state)
 {
-    currentState = state;
+    if (state < STATE_COUNT && states && !Is_Parent(state))
+        request = state;
+}
+
+void RobotState_SetListener(RobotState_Listener_t cb)
+{
+    listener = cb;
 }
 
 /* ★ 이 함수가 없어서 에러 난 거임 */
@@ -18,3 +147,93 @@ RobotState_t RobotState_Get(void)
 {
     return currentState;
 }
+
+void RobotState_Run(uint8_t tick_enabled)
+{
+    const RobotStateDesc_t *d;
+    RobotState_t req;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    req = request;
+    request = STATE_NONE;
+    __set_PRIMASK(primask);
+
+    Accrue();
+    if (req != STATE_NONE)
+        Transition(req);
+
+    if (!tick_enabled)
+        return;
+
+    d = &states[currentState];
+    if (d->tick && (tick_due || !d->tick_ms ||
+                    Timebase_Elapsed(last_tick_us) >= (uint32_t)*d->tick_ms * 1000U))
+    {
+        tick_due = 0;
+        last_tick_us = Timebase_Us();
+        d->tick();
+    }
+
+    /* 틱이 요청을 남겼으면 가드보다 먼저 (다음 루프에서 처리) */
+    if (request != STATE_NONE)
+        return;
+
+    for (RobotState_t s = currentState; s != STATE_NONE; s = Parent(s))
+    {
+        for (uint8_t i = 0; i < states[s].n_trans; i++)
+        {
+            const RobotTransition_t *t = &states[s].trans[i];
+
+            if (!t->guard || t->guard())
+            {
+                Transition(t->to);
+                return;
+            }
+        }
+    }
+}
+
+const char *RobotState_Name(RobotState_t state)
+{
+    return (state < STATE_COUNT && states) ? states[state].name : "UNKNOWN";
+}
+
+uint32_t RobotState_ElapsedMs(void)
+{
+    return Timebase_Elapsed(entered_us) / 1000U;
+}
+
+/* 상위 상태는 아래 상태들의 합 */
+uint32_t RobotState_TimeInMs(RobotState_t state)
+{
+    uint64_t sum = 0;
+
+    if (state >= STATE_COUNT)
+        return 0;
+
+    for (uint8_t s = 0; s < STATE_COUNT; s++)
+    {
+        if (!Contains(state, (RobotState_t)s))
+            continue;
+        sum += time_us[s];
+        if (s == currentState)
+            sum += Timebase_Elapsed(accrued_us);
+    }
+    return (uint32_t)(sum / 1000U);
+}
+
+uint16_t RobotState_Entries(RobotState_t state)
+{
+    return (state < STATE_COUNT) ? entries[state] : 0;
+}
+
+uint8_t RobotState_Trace(RobotTrace_t *out, uint8_t max)
+{
+    uint8_t n = (trace_count < max) ? trace_count : max;
+    uint8_t start = (uint8_t)((trace_head + ROBOT_TRACE_LEN - n) % ROBOT_TRACE_LEN);
+
+    for (uint8_t i = 0; i < n; i++)
+        out[i] = trace[(start + i) % ROBOT_TRACE_LEN];
+    return n;
+}
@@ -29,6 +29,12 @@
  */
 static uint8_t *__sbrk_heap_end = NULL;
 
+/**
+ * Highest heap end ever returned and ENOMEM count (read by memmon.c)
+ */
+static uint8_t *__sbrk_heap_peak = NULL;
+static uint32_t __sbrk_fail_count = 0;
+
 /**
  * @brief _sbrk() allocates memory to the newlib heap and is used by malloc
  *        and others from the C library
@@ -68,12 +74,36 @@ void *_sbrk(ptrdiff_t incr)
   /* Protect heap from growing into the reserved MSP stack */
   if (__sbrk_heap_end + incr > max_heap)
   {
+    __sbrk_fail_count++;
     errno = ENOMEM;
     return (void *)-1;
   }
 
   prev_heap_end = __sbrk_heap_end;
   __sbrk_heap_end += incr;
+  if (__sbrk_heap_end > __sbrk_heap_peak)
+  {
+    __sbrk_heap_peak = __sbrk_heap_end;
+  }
 
   return (void *)prev_heap_end;
 }
+
+/**
+ * @brief Heap statistics for the RAM monitor (drivers/memmon.h)
+ * @return NULL until the first _sbrk() call
+ */
+uint8_t *Sysmem_HeapEnd(void)
+{
+  return __sbrk_heap_end;
+}
+
+uint8_t *Sysmem_HeapPeak(void)
+{
+  return __sbrk_heap_peak;
+}
+
+uint32_t Sysmem_HeapFails(void)
+{
+  return __sbrk_fail_count;
+}
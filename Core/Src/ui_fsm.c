@@ -1,9 +1,14 @@
 /* ui_fsm.c */
+#include "drivers/fmt.h"
 #include "ui_fsm.h"
 #include "drivers/ultrasonic.h"
 #include "robot_state.h"
+#include "reclog.h"
 #include "drivers/lcd_st7735.h"
 #include "drivers/eyes.h"   // 🔥 추가
+#include "drivers/radar.h"
+#include "drivers/lcd_text.h"
+#include "drivers/lcd_i2c.h"
 
 extern uint8_t scan_angle;
 extern uint8_t start_flag;
@@ -12,9 +17,89 @@ extern uint8_t manual_command;
 
 static RobotState_t prev_state = STATE_IDLE;  // 🔥 상태 기억
 
+static UI_View_t view = UI_VIEW_EYES;
+static volatile uint8_t view_toggle_req = 0;
+static uint8_t radar_leaving = 0;             // 레이더 → 눈 전환 중 (화면 지우는 중)
+
+/* ST7735 상태 표시줄 (눈 영역 위/아래 빈 줄, I2C LCD와 같은 문자열) */
+#define STATUS_LEN      16
+#define STATUS_X        ((LCD_WIDTH - STATUS_LEN * LCD_FONT_CELL_W) / 2)
+#define STATUS_TOP_Y    1
+#define STATUS_BOT_Y    (LCD_HEIGHT - LCD_FONT_CELL_H - 1)
+
+static LCD_TextField_t status_top;
+static LCD_TextField_t status_bot;
+
+/**
+ * @brief 화면 모드 전환 (UART 명령 ISR에서 요청만 받고 UI_Update에서 처리)
+ */
+void UI_ToggleView(void)
+{
+    view_toggle_req = 1;
+}
+
+uint8_t UI_EyesVisible(void)
+{
+    return (view == UI_VIEW_EYES) && !radar_leaving;
+}
+
+/**
+ * @brief 다른 코드가 ST7735에 직접 그렸을 때 - 지금 화면 전체를 다음 Update부터 다시 그림
+ *        (눈 / 상태 표시줄 그림자가 패널과 달라졌으므로)
+ */
+void UI_Invalidate(void)
+{
+    if (view == UI_VIEW_RADAR)
+    {
+        Radar_Enter();                  // 배경부터 다시, 점은 그대로
+        return;
+    }
+    Eyes_Invalidate();
+    LCD_TextField_Invalidate(&status_top);
+    LCD_TextField_Invalidate(&status_bot);
+}
+
+/**
+ * @brief ST7735 화면 모드 처리 (틱 예산 안에서 레이더 그리기)
+ */
+static void UI_UpdateView(void)
+{
+    if (view_toggle_req)
+    {
+        view_toggle_req = 0;
+
+        if (view == UI_VIEW_EYES)
+        {
+            view = UI_VIEW_RADAR;
+            radar_leaving = 0;
+            Radar_Enter();
+        }
+        else
+        {
+            view = UI_VIEW_EYES;
+            radar_leaving = 1;
+            Radar_Leave();
+        }
+    }
+
+    if (view == UI_VIEW_RADAR)
+    {
+        Radar_Update(RADAR_TICK_BUDGET);
+    }
+    else if (radar_leaving && Radar_Update(RADAR_TICK_BUDGET))
+    {
+        /* 화면을 다 지웠으면 눈과 상태 표시줄 전체 다시 그리기 */
+        radar_leaving = 0;
+        UI_Invalidate();
+    }
+}
+
 void UI_Init(void)
 {
     LCD_Clear(COLOR_BLACK);
+    Eyes_Invalidate();               // 화면을 지웠으므로 눈 영역 전체 다시 보내기
+    LCD_TextField_Init(&status_top, STATUS_X, STATUS_TOP_Y, STATUS_LEN, COLOR_WHITE, COLOR_BLACK);
+    LCD_TextField_Init(&status_bot, STATUS_X, STATUS_BOT_Y, STATUS_LEN, COLOR_CYAN, COLOR_BLACK);
     Eyes_SetExpression(EXPR_SLEEPY); // 초기 표정
     prev_state = RobotState_Get();
 }
@@ -26,6 +111,8 @@ void UI_Update(void)
     char line1[17];
     char line2[17];
 
+    RecLog_Dist(RECLOG_DIST_UI, distance);
+
     /* 🔥 상태 변경 시에만 얼굴 변경 */
     if (state != prev_state)
     {
@@ -57,42 +144,52 @@ void UI_Update(void)
         prev_state = state;
     }
 
+    UI_UpdateView();
+
     /* ===== LCD 출력 ===== */
     if (start_flag == 1)
     {
         switch (state)
         {
-            case STATE_IDLE:    snprintf(line1, sizeof(line1), "AUTO : IDLE   "); break;
-            case STATE_SCAN:    snprintf(line1, sizeof(line1), "AUTO : SCAN   "); break;
-            case STATE_DECIDE:  snprintf(line1, sizeof(line1), "AUTO : DECIDE "); break;
-            case STATE_MOVE:    snprintf(line1, sizeof(line1), "AUTO : MOVE   "); break;
-            case STATE_ALERT:   snprintf(line1, sizeof(line1), "AUTO : ALERT  "); break;
-            case STATE_REVERSE: snprintf(line1, sizeof(line1), "AUTO : REVERSE"); break;
-            default:            snprintf(line1, sizeof(line1), "AUTO : UNKNOWN"); break;
+            case STATE_IDLE:    Fmt_Snprintf(line1, sizeof(line1), "AUTO : IDLE   "); break;
+            case STATE_SCAN:    Fmt_Snprintf(line1, sizeof(line1), "AUTO : SCAN   "); break;
+            case STATE_DECIDE:  Fmt_Snprintf(line1, sizeof(line1), "AUTO : DECIDE "); break;
+            case STATE_MOVE:    Fmt_Snprintf(line1, sizeof(line1), "AUTO : MOVE   "); break;
+            case STATE_ALERT:   Fmt_Snprintf(line1, sizeof(line1), "AUTO : ALERT  "); break;
+            case STATE_REVERSE: Fmt_Snprintf(line1, sizeof(line1), "AUTO : REVERSE"); break;
+            default:            Fmt_Snprintf(line1, sizeof(line1), "AUTO : UNKNOWN"); break;
         }
     }
     else if (manual_mode == 1)
     {
         switch (manual_command)
         {
-            case 1: snprintf(line1, sizeof(line1), "Manual : MOVE "); break;
-            case 2: snprintf(line1, sizeof(line1), "Manual :REVERSE"); break;
-            case 3: snprintf(line1, sizeof(line1), "Manual : LEFT "); break;
-            case 4: snprintf(line1, sizeof(line1), "Manual : RIGHT"); break;
-            case 5: snprintf(line1, sizeof(line1), "Manual : RESET"); break;
-            default: snprintf(line1, sizeof(line1), "Manual : STOP "); break;
+            case 1: Fmt_Snprintf(line1, sizeof(line1), "Manual : MOVE "); break;
+            case 2: Fmt_Snprintf(line1, sizeof(line1), "Manual :REVERSE"); break;
+            case 3: Fmt_Snprintf(line1, sizeof(line1), "Manual : LEFT "); break;
+            case 4: Fmt_Snprintf(line1, sizeof(line1), "Manual : RIGHT"); break;
+            case 5: Fmt_Snprintf(line1, sizeof(line1), "Manual : RESET"); break;
+            default: Fmt_Snprintf(line1, sizeof(line1), "Manual : STOP "); break;
         }
     }
     else
     {
-        snprintf(line1, sizeof(line1), "STATE: IDLE   ");
+        Fmt_Snprintf(line1, sizeof(line1), "STATE: IDLE   ");
     }
 
-    snprintf(line2, sizeof(line2),
-             "D:%3dcm A:%3d%c", distance, scan_angle, 0xDF);
+    Fmt_Snprintf(line2, sizeof(line2),
+                 "D:%3dcm A:%3d%c", distance, scan_angle, 0xDF);
 
     LCD_XY(0, 0);
     LCD_PUTS(line1);
     LCD_XY(0, 1);
     LCD_PUTS(line2);
+    LCD_FLUSH();        // 바뀐 칸만 I2C 전송
+
+    /* ST7735에도 표시 - 바뀐 글자만 전송 */
+    if (UI_EyesVisible())
+    {
+        LCD_TextField_Set(&status_top, line1);
+        LCD_TextField_Set(&status_bot, line2);
+    }
 }
@@ -7,34 +7,76 @@
 C_SRCS += \
 ../Core/Src/drivers/anim.c \
 ../Core/Src/drivers/buzzer.c \
+../Core/Src/drivers/buzzer_songs.c \
+../Core/Src/drivers/encoder.c \
+../Core/Src/drivers/eye_sprites.c \
 ../Core/Src/drivers/eyes.c \
+../Core/Src/drivers/flash_ee.c \
+../Core/Src/drivers/fmt.c \
+../Core/Src/drivers/heading.c \
+../Core/Src/drivers/i2c_bus.c \
+../Core/Src/drivers/lcd_font.c \
 ../Core/Src/drivers/lcd_gfx.c \
+../Core/Src/drivers/lcd_i2c.c \
 ../Core/Src/drivers/lcd_st7735.c \
+../Core/Src/drivers/lcd_text.c \
+../Core/Src/drivers/led_fx.c \
+../Core/Src/drivers/memmon.c \
 ../Core/Src/drivers/motor.c \
+../Core/Src/drivers/radar.c \
 ../Core/Src/drivers/rgb_led.c \
 ../Core/Src/drivers/servo.c \
+../Core/Src/drivers/timebase.c \
 ../Core/Src/drivers/ultrasonic.c 
 
 OBJS += \
 ./Core/Src/drivers/anim.o \
 ./Core/Src/drivers/buzzer.o \
+./Core/Src/drivers/buzzer_songs.o \
+./Core/Src/drivers/encoder.o \
+./Core/Src/drivers/eye_sprites.o \
 ./Core/Src/drivers/eyes.o \
+./Core/Src/drivers/flash_ee.o \
+./Core/Src/drivers/fmt.o \
+./Core/Src/drivers/heading.o \
+./Core/Src/drivers/i2c_bus.o \
+./Core/Src/drivers/lcd_font.o \
 ./Core/Src/drivers/lcd_gfx.o \
+./Core/Src/drivers/lcd_i2c.o \
 ./Core/Src/drivers/lcd_st7735.o \
+./Core/Src/drivers/lcd_text.o \
+./Core/Src/drivers/led_fx.o \
+./Core/Src/drivers/memmon.o \
 ./Core/Src/drivers/motor.o \
+./Core/Src/drivers/radar.o \
 ./Core/Src/drivers/rgb_led.o \
 ./Core/Src/drivers/servo.o \
+./Core/Src/drivers/timebase.o \
 ./Core/Src/drivers/ultrasonic.o 
 
 C_DEPS += \
 ./Core/Src/drivers/anim.d \
 ./Core/Src/drivers/buzzer.d \
+./Core/Src/drivers/buzzer_songs.d \
+./Core/Src/drivers/encoder.d \
+./Core/Src/drivers/eye_sprites.d \
 ./Core/Src/drivers/eyes.d \
+./Core/Src/drivers/flash_ee.d \
+./Core/Src/drivers/fmt.d \
+./Core/Src/drivers/heading.d \
+./Core/Src/drivers/i2c_bus.d \
+./Core/Src/drivers/lcd_font.d \
 ./Core/Src/drivers/lcd_gfx.d \
+./Core/Src/drivers/lcd_i2c.d \
 ./Core/Src/drivers/lcd_st7735.d \
+./Core/Src/drivers/lcd_text.d \
+./Core/Src/drivers/led_fx.d \
+./Core/Src/drivers/memmon.d \
 ./Core/Src/drivers/motor.d \
+./Core/Src/drivers/radar.d \
 ./Core/Src/drivers/rgb_led.d \
 ./Core/Src/drivers/servo.d \
+./Core/Src/drivers/timebase.d \
 ./Core/Src/drivers/ultrasonic.d 
 
 
@@ -45,7 +87,7 @@ Core/Src/drivers/%.o Core/Src/drivers/%.su Core/Src/drivers/%.cyclo: ../Core/Src
 clean: clean-Core-2f-Src-2f-drivers
 
 clean-Core-2f-Src-2f-drivers:
-	-$(RM) ./Core/Src/drivers/anim.cyclo ./Core/Src/drivers/anim.d ./Core/Src/drivers/anim.o ./Core/Src/drivers/anim.su ./Core/Src/drivers/buzzer.cyclo ./Core/Src/drivers/buzzer.d ./Core/Src/drivers/buzzer.o ./Core/Src/drivers/buzzer.su ./Core/Src/drivers/eyes.cyclo ./Core/Src/drivers/eyes.d ./Core/Src/drivers/eyes.o ./Core/Src/drivers/eyes.su ./Core/Src/drivers/lcd_gfx.cyclo ./Core/Src/drivers/lcd_gfx.d ./Core/Src/drivers/lcd_gfx.o ./Core/Src/drivers/lcd_gfx.su ./Core/Src/drivers/lcd_st7735.cyclo ./Core/Src/drivers/lcd_st7735.d ./Core/Src/drivers/lcd_st7735.o ./Core/Src/drivers/lcd_st7735.su ./Core/Src/drivers/motor.cyclo ./Core/Src/drivers/motor.d ./Core/Src/drivers/motor.o ./Core/Src/drivers/motor.su ./Core/Src/drivers/rgb_led.cyclo ./Core/Src/drivers/rgb_led.d ./Core/Src/drivers/rgb_led.o ./Core/Src/drivers/rgb_led.su ./Core/Src/drivers/servo.cyclo ./Core/Src/drivers/servo.d ./Core/Src/drivers/servo.o ./Core/Src/drivers/servo.su ./Core/Src/drivers/ultrasonic.cyclo ./Core/Src/drivers/ultrasonic.d ./Core/Src/drivers/ultrasonic.o ./Core/Src/drivers/ultrasonic.su
+	-$(RM) ./Core/Src/drivers/anim.cyclo ./Core/Src/drivers/anim.d ./Core/Src/drivers/anim.o ./Core/Src/drivers/anim.su ./Core/Src/drivers/buzzer.cyclo ./Core/Src/drivers/buzzer.d ./Core/Src/drivers/buzzer.o ./Core/Src/drivers/buzzer.su ./Core/Src/drivers/buzzer_songs.cyclo ./Core/Src/drivers/buzzer_songs.d ./Core/Src/drivers/buzzer_songs.o ./Core/Src/drivers/buzzer_songs.su ./Core/Src/drivers/encoder.cyclo ./Core/Src/drivers/encoder.d ./Core/Src/drivers/encoder.o ./Core/Src/drivers/encoder.su ./Core/Src/drivers/eye_sprites.cyclo ./Core/Src/drivers/eye_sprites.d ./Core/Src/drivers/eye_sprites.o ./Core/Src/drivers/eye_sprites.su ./Core/Src/drivers/eyes.cyclo ./Core/Src/drivers/eyes.d ./Core/Src/drivers/eyes.o ./Core/Src/drivers/eyes.su ./Core/Src/drivers/flash_ee.cyclo ./Core/Src/drivers/flash_ee.d ./Core/Src/drivers/flash_ee.o ./Core/Src/drivers/flash_ee.su ./Core/Src/drivers/fmt.cyclo ./Core/Src/drivers/fmt.d ./Core/Src/drivers/fmt.o ./Core/Src/drivers/fmt.su ./Core/Src/drivers/heading.cyclo ./Core/Src/drivers/heading.d ./Core/Src/drivers/heading.o ./Core/Src/drivers/heading.su ./Core/Src/drivers/i2c_bus.cyclo ./Core/Src/drivers/i2c_bus.d ./Core/Src/drivers/i2c_bus.o ./Core/Src/drivers/i2c_bus.su ./Core/Src/drivers/lcd_font.cyclo ./Core/Src/drivers/lcd_font.d ./Core/Src/drivers/lcd_font.o ./Core/Src/drivers/lcd_font.su ./Core/Src/drivers/lcd_gfx.cyclo ./Core/Src/drivers/lcd_gfx.d ./Core/Src/drivers/lcd_gfx.o ./Core/Src/drivers/lcd_gfx.su ./Core/Src/drivers/lcd_i2c.cyclo ./Core/Src/drivers/lcd_i2c.d ./Core/Src/drivers/lcd_i2c.o ./Core/Src/drivers/lcd_i2c.su ./Core/Src/drivers/lcd_st7735.cyclo ./Core/Src/drivers/lcd_st7735.d ./Core/Src/drivers/lcd_st7735.o ./Core/Src/drivers/lcd_st7735.su ./Core/Src/drivers/lcd_text.cyclo ./Core/Src/drivers/lcd_text.d ./Core/Src/drivers/lcd_text.o ./Core/Src/drivers/lcd_text.su ./Core/Src/drivers/led_fx.cyclo ./Core/Src/drivers/led_fx.d ./Core/Src/drivers/led_fx.o ./Core/Src/drivers/led_fx.su ./Core/Src/drivers/memmon.cyclo ./Core/Src/drivers/memmon.d ./Core/Src/drivers/memmon.o ./Core/Src/drivers/memmon.su ./Core/Src/drivers/motor.cyclo ./Core/Src/drivers/motor.d ./Core/Src/drivers/motor.o ./Core/Src/drivers/motor.su ./Core/Src/drivers/radar.cyclo ./Core/Src/drivers/radar.d ./Core/Src/drivers/radar.o ./Core/Src/drivers/radar.su ./Core/Src/drivers/rgb_led.cyclo ./Core/Src/drivers/rgb_led.d ./Core/Src/drivers/rgb_led.o ./Core/Src/drivers/rgb_led.su ./Core/Src/drivers/servo.cyclo ./Core/Src/drivers/servo.d ./Core/Src/drivers/servo.o ./Core/Src/drivers/servo.su ./Core/Src/drivers/timebase.cyclo ./Core/Src/drivers/timebase.d ./Core/Src/drivers/timebase.o ./Core/Src/drivers/timebase.su ./Core/Src/drivers/ultrasonic.cyclo ./Core/Src/drivers/ultrasonic.d ./Core/Src/drivers/ultrasonic.o ./Core/Src/drivers/ultrasonic.su
 
 .PHONY: clean-Core-2f-Src-2f-drivers
 
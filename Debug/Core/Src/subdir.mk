@@ -6,6 +6,10 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../Core/Src/main.c \
+../Core/Src/param.c \
+../Core/Src/reclog.c \
+../Core/Src/robot_behavior.c \
+../Core/Src/robot_command.c \
 ../Core/Src/robot_state.c \
 ../Core/Src/stm32f1xx_hal_msp.c \
 ../Core/Src/stm32f1xx_it.c \
@@ -16,6 +20,10 @@ C_SRCS += \
 
 OBJS += \
 ./Core/Src/main.o \
+./Core/Src/param.o \
+./Core/Src/reclog.o \
+./Core/Src/robot_behavior.o \
+./Core/Src/robot_command.o \
 ./Core/Src/robot_state.o \
 ./Core/Src/stm32f1xx_hal_msp.o \
 ./Core/Src/stm32f1xx_it.o \
@@ -26,6 +34,10 @@ OBJS += \
 
 C_DEPS += \
 ./Core/Src/main.d \
+./Core/Src/param.d \
+./Core/Src/reclog.d \
+./Core/Src/robot_behavior.d \
+./Core/Src/robot_command.d \
 ./Core/Src/robot_state.d \
 ./Core/Src/stm32f1xx_hal_msp.d \
 ./Core/Src/stm32f1xx_it.d \
@@ -42,7 +54,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/robot_state.cyclo ./Core/Src/robot_state.d ./Core/Src/robot_state.o ./Core/Src/robot_state.su ./Core/Src/stm32f1xx_hal_msp.cyclo ./Core/Src/stm32f1xx_hal_msp.d ./Core/Src/stm32f1xx_hal_msp.o ./Core/Src/stm32f1xx_hal_msp.su ./Core/Src/stm32f1xx_it.cyclo ./Core/Src/stm32f1xx_it.d ./Core/Src/stm32f1xx_it.o ./Core/Src/stm32f1xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f1xx.cyclo ./Core/Src/system_stm32f1xx.d ./Core/Src/system_stm32f1xx.o ./Core/Src/system_stm32f1xx.su ./Core/Src/ui_fsm.cyclo ./Core/Src/ui_fsm.d ./Core/Src/ui_fsm.o ./Core/Src/ui_fsm.su
+	-$(RM) ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/param.cyclo ./Core/Src/param.d ./Core/Src/param.o ./Core/Src/param.su ./Core/Src/reclog.cyclo ./Core/Src/reclog.d ./Core/Src/reclog.o ./Core/Src/reclog.su ./Core/Src/robot_behavior.cyclo ./Core/Src/robot_behavior.d ./Core/Src/robot_behavior.o ./Core/Src/robot_behavior.su ./Core/Src/robot_command.cyclo ./Core/Src/robot_command.d ./Core/Src/robot_command.o ./Core/Src/robot_command.su ./Core/Src/robot_state.cyclo ./Core/Src/robot_state.d ./Core/Src/robot_state.o ./Core/Src/robot_state.su ./Core/Src/stm32f1xx_hal_msp.cyclo ./Core/Src/stm32f1xx_hal_msp.d ./Core/Src/stm32f1xx_hal_msp.o ./Core/Src/stm32f1xx_hal_msp.su ./Core/Src/stm32f1xx_it.cyclo ./Core/Src/stm32f1xx_it.d ./Core/Src/stm32f1xx_it.o ./Core/Src/stm32f1xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f1xx.cyclo ./Core/Src/system_stm32f1xx.d ./Core/Src/system_stm32f1xx.o ./Core/Src/system_stm32f1xx.su ./Core/Src/ui_fsm.cyclo ./Core/Src/ui_fsm.d ./Core/Src/ui_fsm.o ./Core/Src/ui_fsm.su
 
 .PHONY: clean-Core-2f-Src
 
@@ -0,0 +1,339 @@
+/**
+ * @file drivesim.c
+ * @brief 구동부 시뮬레이션 - 엔코더 폐루프 회전(heading.c) vs 예전 시간 회전 (호스트)
+ *
+ * 펌웨어 motor.c / encoder.c / heading.c를 그대로 링크하고
+ * 바퀴 속도를 1차 지연 모델로 흉내냄:
+ *   듀티가 정지 마찰(deadband)을 넘으면 목표 속도 = (듀티 - deadband) 비례, 시정수 tau로 따라감
+ *   회전각 = (왼쪽 - 오른쪽 바퀴 속도) / 실제 유효 트랙 적분
+ * 왼쪽 바퀴 이동이 엔코더 에지 간격을 넘을 때마다 Encoder_OnEdge (EXTI ISR) 호출.
+ * 모터 ISR(Motor_OnPeriod)은 1ms마다, 적분은 20us 간격.
+ *
+ * 차체 조건(배터리, 좌우 편차, 바닥, 엔코더 채터링)을 바꿔가며
+ *   - 예전 방식: Motor_Left/Right 120ms 후 정지 → 실제 회전각
+ *   - 폐루프: Heading_TurnBy(각도) → 엔코더 추정각, 실제 회전각, 걸린 시간
+ * 을 표로 출력. 폐루프가 허용 오차(엔코더 기준)를 넘거나 시간 초과면 종료 코드 1.
+ * 좌우가 같은 차체(nominal / low-batt / chatter)는 실제 회전각도 YAW_TOL_DEG 안이어야 함 -
+ * weak-right / carpet은 엔코더가 왼쪽 하나라 펌웨어가 볼 수 없는 오차라 표시만 (heading.h).
+ * 이어서 직진 중 장애물 회피 두 방식 비교 (nominal 차체):
+ *   - 감속 정지 → 제자리 45도 → 다시 직진 속도
+ *   - Motor_CurveFor 곡선 (멈추지 않음)
+ * 45도 방향 전환까지 걸린 시간과 그동안 앞으로 간 거리.
+ *
+ * 사용법: drivesim [-v]     (-v: 회전마다 10ms 간격 궤적)
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "drivers/encoder.h"
+#include "drivers/heading.h"
+#include "drivers/motor.h"
+#include "hal_sim.h"
+
+#define DT_US           20
+#define SETTLE_US       500000      // 멈춘 뒤 관성까지 기다리는 시간
+#define PASS_TOL_DEG    5           // heading.c HEADING_TOL_DEG와 같게
+#define YAW_TOL_DEG     5           // 실제 회전각 - 엔코더 허용 오차와 같게 (에지 하나 약 3.9도)
+
+typedef struct {
+    const char *name;
+    double v_full;          // 듀티 100% 바퀴 속도 (mm/s, 제자리 회전 부하)
+    double deadband;        // 이 듀티(%) 이하로는 출발 못 함
+    double tau_ms;          // 속도 응답 시정수
+    double right_gain;      // 오른쪽 바퀴 힘 (1.0 = 왼쪽과 같음)
+    double track_mm;        // 실제 유효 트랙 (설정값 TRACK_EFFECTIVE_MM과 다를 수 있음)
+    int    chatter;         // 1 = 에지마다 40us 뒤 글리치 한 쌍
+    int    check_yaw;       // 1 = 실제 회전각도 YAW_TOL_DEG 검사 (좌우 대칭 차체만)
+} Plant_t;
+
+static const Plant_t plants[] = {
+    { "nominal",    400, 20, 60, 1.00, TRACK_EFFECTIVE_MM,        0, 1 },
+    { "low-batt",   280, 20, 60, 1.00, TRACK_EFFECTIVE_MM,        0, 1 },
+    { "weak-right", 400, 20, 60, 0.85, TRACK_EFFECTIVE_MM,        0, 0 },
+    { "carpet",     360, 35, 90, 1.00, TRACK_EFFECTIVE_MM * 1.10, 0, 0 },
+    { "chatter",    400, 20, 60, 1.00, TRACK_EFFECTIVE_MM,        1, 1 },
+};
+#define PLANT_COUNT     (int)(sizeof(plants) / sizeof(plants[0]))
+
+static const int16_t turns[] = { 15, 45, 90, 180, -45, -90 };
+#define TURN_COUNT      (int)(sizeof(turns) / sizeof(turns[0]))
+
+static TIM_HandleTypeDef htim_sim;
+
+/* ===== 차체 모델 ===== */
+
+static const Plant_t *pl;
+static double v_wheel[MOTOR_SIDE_COUNT];    // mm/s
+static double left_um;                      // 왼쪽 바퀴 누적 이동 (절대값, 에지 생성용)
+static double yaw_deg;                      // + = Motor_Left 방향
+static double fwd_mm;                       // 출발 방향 기준 앞으로 간 거리
+static uint32_t glitch_at[2];
+static int verbose;
+
+static void Plant_Reset(const Plant_t *p)
+{
+    pl = p;
+    v_wheel[0] = v_wheel[1] = 0;
+    left_um = 0;
+    yaw_deg = 0;
+    fwd_mm = 0;
+    glitch_at[0] = glitch_at[1] = 0;
+}
+
+static double Wheel_Target(double duty, double gain)
+{
+    double mag = fabs(duty);
+
+    if (mag <= pl->deadband) return 0;
+    return copysign((mag - pl->deadband) / (100.0 - pl->deadband) * pl->v_full * gain, duty);
+}
+
+static void Wheel_Step(int side, double gain)
+{
+    double duty = Motor_GetSpeed(side);
+    double target = Wheel_Target(duty, gain);
+    double *v = &v_wheel[side];
+
+    if (*v == 0 && target == 0) return;                 // 정지 마찰
+    *v += (target - *v) * (DT_US / 1000.0) / pl->tau_ms;
+    if (target == 0 && fabs(*v) < 5) *v = 0;            // 관성 끝
+}
+
+/**
+ * @brief 20us 진행 - 모터 ISR, 바퀴, 엔코더 에지, 회전각
+ */
+static void Sim_Step(void)
+{
+    uint64_t now = Sim_NowUs();
+    double before = left_um;
+
+    if (now % 1000 == 0) Motor_OnPeriod();
+
+    Wheel_Step(MOTOR_SIDE_LEFT, 1.0);
+    Wheel_Step(MOTOR_SIDE_RIGHT, pl->right_gain);
+
+    left_um += fabs(v_wheel[MOTOR_SIDE_LEFT]) * DT_US / 1000.0;
+    yaw_deg += (v_wheel[MOTOR_SIDE_LEFT] - v_wheel[MOTOR_SIDE_RIGHT]) / pl->track_mm
+               * (DT_US / 1e6) * (180.0 / M_PI);
+    fwd_mm  += (v_wheel[MOTOR_SIDE_LEFT] + v_wheel[MOTOR_SIDE_RIGHT]) / 2
+               * cos(yaw_deg * M_PI / 180.0) * (DT_US / 1e6);
+
+    Sim_Advance(DT_US);
+
+    if ((long)(left_um / ENCODER_UM_PER_EDGE) != (long)(before / ENCODER_UM_PER_EDGE))
+    {
+        Encoder_OnEdge();
+        if (pl->chatter)
+        {
+            glitch_at[0] = (uint32_t)Sim_NowUs() + 40;
+            glitch_at[1] = (uint32_t)Sim_NowUs() + 80;
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (glitch_at[i] && (uint32_t)Sim_NowUs() >= glitch_at[i])
+        {
+            glitch_at[i] = 0;
+            Encoder_OnEdge();
+        }
+    }
+}
+
+static void Run_Us(uint32_t us)
+{
+    for (uint32_t t = 0; t < us; t += DT_US) Sim_Step();
+}
+
+static void Fw_Reset(void)
+{
+    Sim_Reset();
+    Motor_Init(&htim_sim);
+    Encoder_Init();
+    Heading_Init();
+}
+
+/* ===== 시나리오 ===== */
+
+/**
+ * @brief 예전 회피 회전: Motor_Left 120ms → Motor_Stop
+ */
+static double Turn_OpenLoop(void)
+{
+    Fw_Reset();
+    Motor_Left();
+    Run_Us(120000);
+    Motor_Stop();
+    Run_Us(SETTLE_US);
+    return yaw_deg;
+}
+
+typedef struct {
+    double  yaw;            // 실제
+    int16_t est;            // 엔코더 추정
+    uint32_t ms;
+    HeadingStatus_t status;
+} TurnResult_t;
+
+static TurnResult_t Turn_Closed(int16_t deg)
+{
+    TurnResult_t r;
+    uint32_t t0, next_log = 0;
+
+    Fw_Reset();
+    t0 = (uint32_t)Sim_NowUs();
+    Heading_TurnBy(deg);
+
+    while (Heading_Busy())
+    {
+        Heading_Update();
+        Sim_Step();
+
+        if (verbose && Sim_NowUs() >= next_log)
+        {
+            next_log = (uint32_t)Sim_NowUs() + 10000;
+            printf("    t=%4lu ms  duty L=%4d R=%4d  v=%4.0f/%4.0f mm/s (enc %4d)  est=%4d yaw=%6.1f\n",
+                   (unsigned long)((Sim_NowUs() - t0) / 1000), Motor_GetSpeed(MOTOR_SIDE_LEFT),
+                   Motor_GetSpeed(MOTOR_SIDE_RIGHT), v_wheel[0], v_wheel[1], Encoder_SpeedMmS(),
+                   Heading_TurnedDeg(), yaw_deg);
+        }
+    }
+
+    r.ms     = (uint32_t)(Sim_NowUs() - t0) / 1000;
+    r.status = Heading_Status();
+    Run_Us(SETTLE_US);
+    r.yaw = yaw_deg;
+    r.est = Heading_TurnedDeg();
+    return r;
+}
+
+/* ===== 직진 중 회피 ===== */
+
+/**
+ * @brief 직진 속도에 도달한 상태에서 시작
+ */
+static void Cruise_Start(void)
+{
+    Fw_Reset();
+    Motor_Forward();
+    Run_Us(600000);
+    yaw_deg = 0;
+    fwd_mm = 0;
+}
+
+/**
+ * @brief |회전각| >= deg 가 될 때까지 (최대 limit_ms), 걸린 ms
+ */
+static uint32_t Run_Until_Yaw(double deg, uint32_t limit_ms)
+{
+    uint32_t t0 = (uint32_t)Sim_NowUs();
+
+    while (fabs(yaw_deg) < deg && Sim_NowUs() - t0 < limit_ms * 1000ULL)
+    {
+        Heading_Update();
+        Sim_Step();
+    }
+    return (uint32_t)(Sim_NowUs() - t0) / 1000;
+}
+
+static void Avoid_Compare(void)
+{
+    uint32_t t_spin, t_arc;
+    double d_spin, d_arc, y_spin, y_arc;
+
+    Plant_Reset(&plants[0]);
+
+    /* 예전 흐름: 정지 → 제자리 회전 → 직진 속도 회복 */
+    Cruise_Start();
+    Motor_Stop();
+    Heading_TurnBy(AVOID_TURN_DEG);
+    while (Heading_Busy() || !Motor_IsSettled())
+    {
+        Heading_Update();
+        Sim_Step();
+    }
+    Motor_Forward();
+    while (!Motor_IsSettled()) Sim_Step();
+    t_spin = (uint32_t)(Sim_NowUs() / 1000) - 600;
+    d_spin = fwd_mm;
+    y_spin = yaw_deg;
+
+    /* 곡선: 45도가 될 때까지 (최대 3초) */
+    Cruise_Start();
+    Motor_CurveFor(MOTOR_BASE_SPEED, MOTOR_ARC_TURN, 3000);
+    t_arc = Run_Until_Yaw(AVOID_TURN_DEG, 3000);
+    Motor_Forward();
+    d_arc = fwd_mm;
+    y_arc = yaw_deg;
+
+    printf("\n직진 중 %d도 회피 (nominal):\n", AVOID_TURN_DEG);
+    printf("  정지 + 제자리 회전 + 재출발  %4lu ms  회전 %5.1f도  전진 %4.0f mm\n",
+           (unsigned long)t_spin, y_spin, d_spin);
+    printf("  곡선 (MOTOR_ARC_TURN %d)       %4lu ms  회전 %5.1f도  전진 %4.0f mm\n",
+           MOTOR_ARC_TURN, (unsigned long)t_arc, y_arc, d_arc);
+    printf("  곡선 AVOID_ARC_MS %d → 약 %.0f도\n", AVOID_ARC_MS, y_arc * AVOID_ARC_MS / (t_arc ? t_arc : 1));
+}
+
+int main(int argc, char **argv)
+{
+    int failures = 0;
+    double worst_est = 0, worst_yaw = 0, worst_sym = 0;
+
+    verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+
+    printf("엔코더 %d에지/회전, 에지당 %lu um (회전각 약 %.1f도), 유효 트랙 %d mm\n\n",
+           ENCODER_EDGES_PER_REV, (unsigned long)ENCODER_UM_PER_EDGE,
+           ENCODER_UM_PER_EDGE / (M_PI * TRACK_EFFECTIVE_MM / 360.0) / 1000.0, TRACK_EFFECTIVE_MM);
+
+    printf("%-10s  %9s |", "차체", "120ms 회전");
+    for (int t = 0; t < TURN_COUNT; t++) printf(" %13d도", turns[t]);
+    printf("\n%-10s  %9s |", "", "실제");
+    for (int t = 0; t < TURN_COUNT; t++) printf("  %s", "추정/실제/ms");
+    printf("\n");
+
+    for (int p = 0; p < PLANT_COUNT; p++)
+    {
+        Plant_Reset(&plants[p]);
+        printf("%-10s  %8.1f도 |", plants[p].name, Turn_OpenLoop());
+
+        for (int t = 0; t < TURN_COUNT; t++)
+        {
+            TurnResult_t r;
+            double e_est, e_yaw;
+
+            if (verbose) printf("\n  %s %d도\n", plants[p].name, turns[t]);
+            Plant_Reset(&plants[p]);
+            r = Turn_Closed(turns[t]);
+
+            e_est = fabs((double)(r.est - turns[t]));
+            e_yaw = fabs(r.yaw - turns[t]);
+            if (e_est > worst_est) worst_est = e_est;
+            if (e_yaw > worst_yaw) worst_yaw = e_yaw;
+            if (plants[p].check_yaw && e_yaw > worst_sym) worst_sym = e_yaw;
+
+            printf(" %4d/%4.0f/%4lu%s", r.est, r.yaw, (unsigned long)r.ms,
+                   (r.status != HEADING_DONE) ? "T" : (e_est > PASS_TOL_DEG) ? "!" :
+                   (plants[p].check_yaw && e_yaw > YAW_TOL_DEG) ? "Y" : " ");
+
+            if (r.status != HEADING_DONE || e_est > PASS_TOL_DEG) failures++;
+            else if (plants[p].check_yaw && e_yaw > YAW_TOL_DEG) failures++;
+        }
+        printf("\n");
+    }
+
+    printf("\n폐루프 최대 오차: 엔코더 추정 %.0f도 (허용 %d), 실제 - 좌우 대칭 차체 %.1f도 (허용 %d), 전체 %.1f도\n",
+           worst_est, PASS_TOL_DEG, worst_sym, YAW_TOL_DEG, worst_yaw);
+    printf("  (weak-right / carpet 실제 오차 = 엔코더가 왼쪽에만 있어서 생기는 좌우 편차 + 트랙 보정 오차, 검사 안 함)\n");
+
+    Avoid_Compare();
+
+    if (failures)
+    {
+        printf("실패 %d건 (T = 시간 초과, ! = 엔코더 허용 오차 초과, Y = 실제 회전각 허용 오차 초과)\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,260 @@
+/**
+ * @file eyebench.c
+ * @brief 눈 표정 그리기 비교 벤치마크 (도형 vs 스프라이트)
+ *
+ * 같은 eyes.c를 EYES_KEEP_PROCEDURAL로 빌드해서 두 경로를 모두 실행:
+ *  1. 두 결과가 픽셀 단위로 같은지 검증 (다르면 종료 코드 1)
+ *  2. 표정마다 윈도우 수 / SPI 호출 / 바이트 / 추정 시간 비교
+ *  3. 스프라이트 테이블 플래시 사용량 출력
+ *  4. 트윈 전환(모든 표정 쌍)과 깜빡임의 전송량을 하드 컷과 비교하고
+ *     전환이 끝난 화면이 도형 결과와 같은지 검증
+ *  5. 틱 예산별로 호출당 전송량이 예산을 넘지 않는지와 전환에 걸리는 틱 수 확인
+ *
+ * 도형 코드의 플래시 크기는 ARM 컴파일러가 있어야 하므로
+ * `make -C Tools flash-compare`로 따로 측정.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "drivers/eyes.h"
+#include "drivers/eye_sprites.h"
+#include "lcd_sim.h"
+
+static uint16_t ref_fb[LCD_HEIGHT][LCD_WIDTH];
+static uint16_t proc_fb[EXPR_COUNT][LCD_HEIGHT][LCD_WIDTH];
+
+static const char *expr_names[EXPR_COUNT] = {
+    "NEUTRAL", "BLINK", "HAPPY", "ANGRY",
+    "SLEEPY", "SAD", "LOOK_LEFT", "LOOK_RIGHT"
+};
+
+/**
+ * @brief 트윈이 끝날 때까지 Eyes_Service 반복
+ * @return 호출(틱) 수 (*worst = 한 틱 최대 추정 시간, *max_bytes = 한 틱 최대 바이트)
+ */
+static int run_ticks(const LcdSimCost_t *cost, uint16_t budget, double *worst, unsigned *max_bytes)
+{
+    int frames = 0;
+
+    *worst = 0;
+    *max_bytes = 0;
+    do {
+        LcdSimStats_t before = LcdSim_Stats(), after, d;
+        double t;
+
+        Eyes_Service(budget);
+        after = LcdSim_Stats();
+        d.windows    = after.windows    - before.windows;
+        d.spi_calls  = after.spi_calls  - before.spi_calls;
+        d.spi_bytes  = after.spi_bytes  - before.spi_bytes;
+        d.fill_bytes = after.fill_bytes - before.fill_bytes;
+        d.pixels     = after.pixels     - before.pixels;
+        t = LcdSim_EstimateUs(&d, cost);
+        if (t > *worst) *worst = t;
+        if (d.spi_bytes > *max_bytes) *max_bytes = d.spi_bytes;
+        frames++;
+    } while (Eyes_IsAnimating() && frames < 1000);
+
+    return frames;
+}
+
+/* 예산 없이 한 틱에 한 프레임 */
+static int run_tween(const LcdSimCost_t *cost, double *worst)
+{
+    unsigned max_bytes;
+    return run_ticks(cost, 0xFFFF, worst, &max_bytes);
+}
+
+/**
+ * @brief 예산별 모든 표정 쌍 전환: 예산 준수 + 최종 화면 검증
+ */
+static int bench_budget(const LcdSimCost_t *cost)
+{
+    static const uint16_t budgets[] = { 64, 256, 1024, EYES_TICK_BUDGET };
+    int fail = 0;
+
+    printf("\nbudgeted transitions (bytes per Eyes_Service call):\n");
+    printf("  %6s | %9s %9s %9s\n", "budget", "max/tick", "avg ticks", "max ticks");
+
+    for (unsigned i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++)
+    {
+        unsigned worst_bytes = 0, sum_ticks = 0;
+        int max_ticks = 0, pairs = 0;
+
+        for (int a = 0; a < EXPR_COUNT; a++)
+        {
+            for (int b = 0; b < EXPR_COUNT; b++)
+            {
+                unsigned max_bytes;
+                double worst;
+                int ticks;
+
+                if (a == b) continue;
+
+                LcdSim_Reset();
+                Eyes_Draw((Expression_t)a);
+                Eyes_SetExpression((Expression_t)b);
+                ticks = run_ticks(cost, budgets[i], &worst, &max_bytes);
+
+                if (max_bytes > worst_bytes) worst_bytes = max_bytes;
+                if (ticks > max_ticks) max_ticks = ticks;
+                sum_ticks += ticks;
+                pairs++;
+
+                if (memcmp(proc_fb[b], lcd_sim_fb, sizeof(ref_fb)) != 0)
+                {
+                    printf("  budget %u: %s -> %s MISMATCH\n",
+                           budgets[i], expr_names[a], expr_names[b]);
+                    fail = 1;
+                }
+            }
+        }
+
+        printf("  %6u | %9u %9.1f %9d%s\n", budgets[i], worst_bytes,
+               (double)sum_ticks / pairs, max_ticks,
+               worst_bytes > budgets[i] ? "  OVER BUDGET" : "");
+        if (worst_bytes > budgets[i]) fail = 1;
+    }
+
+    return fail;
+}
+
+static int bench_tween(const LcdSimCost_t *cost)
+{
+    double sum_tween = 0, sum_cut = 0, worst_frame = 0;
+    unsigned tween_bytes = 0, cut_bytes = 0;
+    int pairs = 0, max_frames = 0, fail = 0;
+
+    printf("\ntween transitions (all %d pairs):\n", EXPR_COUNT * (EXPR_COUNT - 1));
+
+    for (int a = 0; a < EXPR_COUNT; a++)
+    {
+        for (int b = 0; b < EXPR_COUNT; b++)
+        {
+            LcdSimStats_t st;
+            double worst;
+            int frames;
+
+            if (a == b) continue;
+
+            /* 하드 컷: 목표 스프라이트 한 번 */
+            LcdSim_Reset();
+            Eyes_Draw((Expression_t)b);
+            st = LcdSim_Stats();
+            sum_cut   += LcdSim_EstimateUs(&st, cost);
+            cut_bytes += st.spi_bytes;
+
+            /* 트윈: 시작 표정에서 전환 */
+            Eyes_Draw((Expression_t)a);
+            LcdSim_ResetStats();
+            Eyes_SetExpression((Expression_t)b);
+            frames = run_tween(cost, &worst);
+            st = LcdSim_Stats();
+            sum_tween   += LcdSim_EstimateUs(&st, cost);
+            tween_bytes += st.spi_bytes;
+            if (worst > worst_frame) worst_frame = worst;
+            if (frames > max_frames) max_frames = frames;
+            pairs++;
+
+            if (memcmp(proc_fb[b], lcd_sim_fb, sizeof(ref_fb)) != 0)
+            {
+                printf("  %s -> %s: MISMATCH after tween\n", expr_names[a], expr_names[b]);
+                fail = 1;
+            }
+        }
+    }
+
+    printf("  hard cut  : avg %6u bytes, %7.0f us\n",
+           cut_bytes / pairs, sum_cut / pairs);
+    printf("  tween     : avg %6u bytes, %7.0f us total over <= %d frames"
+           " (worst frame %.0f us)\n",
+           tween_bytes / pairs, sum_tween / pairs, max_frames, worst_frame);
+
+    /* 깜빡임: 트윈 vs BLINK + 원래 표정 두 번 그리기 */
+    {
+        LcdSimStats_t st;
+        double worst, t_cut;
+        int frames;
+
+        LcdSim_Reset();
+        Eyes_Draw(EXPR_BLINK);
+        Eyes_Draw(EXPR_NEUTRAL);
+        st = LcdSim_Stats();
+        t_cut = LcdSim_EstimateUs(&st, cost);
+        printf("  blink cut : %6u bytes, %7.0f us (two redraws)\n", st.spi_bytes, t_cut);
+
+        LcdSim_ResetStats();
+        Eyes_Blink();
+        frames = run_tween(cost, &worst);
+        st = LcdSim_Stats();
+        printf("  blink lid : %6u bytes, %7.0f us over %d frames (worst frame %.0f us)\n",
+               st.spi_bytes, LcdSim_EstimateUs(&st, cost), frames, worst);
+
+        if (memcmp(proc_fb[EXPR_NEUTRAL], lcd_sim_fb, sizeof(ref_fb)) != 0)
+        {
+            printf("  blink: MISMATCH after reopening\n");
+            fail = 1;
+        }
+    }
+
+    return fail;
+}
+
+int main(void)
+{
+    LcdSimCost_t cost = LcdSim_DefaultCost();
+    double sum_proc = 0, sum_spr = 0;
+    int fail = 0;
+
+    printf("cost model: %.2f us/byte, %.2f us/HAL call, %.2f us/fill byte\n\n",
+           cost.byte_us, cost.call_us, cost.fill_us);
+    printf("%-11s | %6s %6s %7s %8s | %6s %6s %7s %8s | %5s\n",
+           "expr", "win", "calls", "bytes", "us",
+           "win", "calls", "bytes", "us", "x");
+    printf("%-11s | %-30s | %-30s |\n", "", "procedural", "sprite");
+
+    for (int e = 0; e < EXPR_COUNT; e++)
+    {
+        LcdSimStats_t sp, ss;
+        double tp, ts;
+
+        LcdSim_Reset();
+        Eyes_DrawProcedural((Expression_t)e);
+        sp = LcdSim_Stats();
+        memcpy(ref_fb, lcd_sim_fb, sizeof(ref_fb));
+        memcpy(proc_fb[e], lcd_sim_fb, sizeof(ref_fb));
+
+        LcdSim_Reset();
+        Eyes_Draw((Expression_t)e);
+        ss = LcdSim_Stats();
+
+        if (memcmp(ref_fb, lcd_sim_fb, sizeof(ref_fb)) != 0)
+        {
+            printf("%-11s | MISMATCH - eye_sprites.c가 오래됨 (make -C Tools sprites)\n",
+                   expr_names[e]);
+            fail = 1;
+            continue;
+        }
+
+        tp = LcdSim_EstimateUs(&sp, &cost);
+        ts = LcdSim_EstimateUs(&ss, &cost);
+        sum_proc += tp;
+        sum_spr  += ts;
+
+        printf("%-11s | %6u %6u %7u %8.0f | %6u %6u %7u %8.0f | %5.2f\n",
+               expr_names[e],
+               sp.windows, sp.spi_calls, sp.spi_bytes, tp,
+               ss.windows, ss.spi_calls, ss.spi_bytes, ts,
+               tp / ts);
+    }
+
+    printf("\naverage draw: procedural %.0f us, sprite %.0f us\n",
+           sum_proc / EXPR_COUNT, sum_spr / EXPR_COUNT);
+    printf("sprite flash: %u bytes (span data + descriptors)\n", eye_sprites_size);
+
+    fail |= bench_tween(&cost);
+    fail |= bench_budget(&cost);
+
+    return fail;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file eyegen.c
+ * @brief 눈 표정 스프라이트 생성기 (호스트)
+ *
+ * eyes.c의 도형 그리기(Eyes_DrawProcedural)를 패널 모델에 렌더링한 뒤
+ * 눈 박스마다 행별 span(x0, len)으로 인코딩해 eye_sprites.c를 출력함.
+ * 같은 모양(좌우 대칭 표정 등)은 데이터 배열 하나를 공유.
+ *
+ * 사용법: eyegen [-o Core/Src/drivers/eye_sprites.c]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drivers/eyes.h"
+#include "drivers/eye_sprites.h"
+#include "lcd_sim.h"
+
+#define BG_COLOR    0x0000
+#define MAX_DATA    (EYE_SPRITE_H * (1 + 2 * EYE_SPRITE_W / 2))
+
+/* ARM 빌드 기준 EyeSprite_t 크기 (포인터 4 + y0/h 2 + 패딩 2) */
+#define ARM_DESC_SIZE   8
+
+typedef struct {
+    uint8_t  data[MAX_DATA];
+    uint32_t len;
+    uint8_t  y0, h;
+    int      owner;     // 같은 데이터를 처음 만든 스프라이트 인덱스
+} Sprite_t;
+
+static const char *expr_names[EXPR_COUNT] = {
+    "neutral", "blink", "happy", "angry",
+    "sleepy", "sad", "look_left", "look_right"
+};
+
+static Sprite_t sprites[EXPR_COUNT * 2];
+
+/**
+ * @brief 프레임버퍼의 박스 하나를 span 데이터로 인코딩
+ */
+static void encode_box(Sprite_t *spr, int bx)
+{
+    int first = -1, last = -1;
+
+    for (int y = 0; y < EYE_SPRITE_H; y++)
+    {
+        for (int x = 0; x < EYE_SPRITE_W; x++)
+        {
+            if (lcd_sim_fb[EYE_SPRITE_Y + y][bx + x] != BG_COLOR)
+            {
+                if (first < 0) first = y;
+                last = y;
+                break;
+            }
+        }
+    }
+
+    spr->len = 0;
+    if (first < 0)
+    {
+        spr->y0 = 0;
+        spr->h  = 0;
+        return;
+    }
+
+    spr->y0 = (uint8_t)first;
+    spr->h  = (uint8_t)(last - first + 1);
+
+    for (int y = first; y <= last; y++)
+    {
+        const uint16_t *row = &lcd_sim_fb[EYE_SPRITE_Y + y][bx];
+        uint32_t count_pos = spr->len++;
+        uint8_t  n = 0;
+        int x = 0;
+
+        while (x < EYE_SPRITE_W)
+        {
+            if (row[x] == BG_COLOR) { x++; continue; }
+
+            uint16_t color = row[x];
+            int sx = x;
+            while (x < EYE_SPRITE_W && row[x] == color) x++;
+
+            spr->data[spr->len++] = (uint8_t)sx;
+            spr->data[spr->len++] = (uint8_t)(x - sx);
+            n++;
+        }
+        spr->data[count_pos] = n;
+    }
+}
+
+/**
+ * @brief 박스 바깥에 그려진 픽셀이 있으면 실패 (eyes.c와 박스 정의 불일치)
+ */
+static int check_outside(void)
+{
+    for (int y = 0; y < LCD_HEIGHT; y++)
+    {
+        for (int x = 0; x < LCD_WIDTH; x++)
+        {
+            int in_y = (y >= EYE_SPRITE_Y && y < EYE_SPRITE_Y + EYE_SPRITE_H);
+            int in_l = (x >= EYE_SPRITE_LX && x < EYE_SPRITE_LX + EYE_SPRITE_W);
+            int in_r = (x >= EYE_SPRITE_RX && x < EYE_SPRITE_RX + EYE_SPRITE_W);
+
+            if (!(in_y && (in_l || in_r)) && lcd_sim_fb[y][x] != BG_COLOR)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief 표정 색이 한 가지인지 확인 (스프라이트는 눈 색 단색만 지원)
+ */
+static uint16_t eye_color = 0;
+
+static int check_colors(void)
+{
+    for (int y = 0; y < LCD_HEIGHT; y++)
+    {
+        for (int x = 0; x < LCD_WIDTH; x++)
+        {
+            uint16_t c = lcd_sim_fb[y][x];
+            if (c == BG_COLOR) continue;
+            if (eye_color == 0) eye_color = c;
+            if (c != eye_color) return -1;
+        }
+    }
+    return 0;
+}
+
+static void print_name(FILE *out, int i)
+{
+    fprintf(out, "spr_%s_%c", expr_names[i / 2], (i % 2) ? 'r' : 'l');
+}
+
+int main(int argc, char **argv)
+{
+    FILE *out = stdout;
+    uint32_t total = 0;
+
+    if (argc == 3 && strcmp(argv[1], "-o") == 0)
+    {
+        out = fopen(argv[2], "w");
+        if (!out) { perror(argv[2]); return 1; }
+    }
+
+    for (int e = 0; e < EXPR_COUNT; e++)
+    {
+        LcdSim_Reset();
+        Eyes_DrawProcedural((Expression_t)e);
+
+        if (check_outside() < 0 || check_colors() < 0)
+        {
+            fprintf(stderr, "eyegen: %s: 박스 밖 픽셀 또는 2색 이상\n", expr_names[e]);
+            return 1;
+        }
+
+        encode_box(&sprites[e * 2],     EYE_SPRITE_LX);
+        encode_box(&sprites[e * 2 + 1], EYE_SPRITE_RX);
+    }
+
+    /* 중복 제거 */
+    for (int i = 0; i < EXPR_COUNT * 2; i++)
+    {
+        sprites[i].owner = i;
+        for (int j = 0; j < i; j++)
+        {
+            if (sprites[j].owner == j &&
+                sprites[j].y0 == sprites[i].y0 && sprites[j].h == sprites[i].h &&
+                sprites[j].len == sprites[i].len &&
+                memcmp(sprites[j].data, sprites[i].data, sprites[i].len) == 0)
+            {
+                sprites[i].owner = j;
+                break;
+            }
+        }
+    }
+
+    fprintf(out,
+        "/**\n"
+        " * @file eye_sprites.c\n"
+        " * @brief 눈 표정 RLE span 스프라이트 데이터\n"
+        " *\n"
+        " * 자동 생성 파일 - 직접 수정하지 말 것 (make -C Tools sprites)\n"
+        " */\n\n"
+        "#include \"drivers/eye_sprites.h\"\n\n");
+
+    for (int i = 0; i < EXPR_COUNT * 2; i++)
+    {
+        const Sprite_t *s = &sprites[i];
+        if (s->owner != i) continue;
+
+        fprintf(out, "static const uint8_t ");
+        print_name(out, i);
+        fprintf(out, "[%u] = {", s->len ? s->len : 1);
+
+        const uint8_t *p = s->data;
+        for (int row = 0; row < s->h; row++)
+        {
+            uint8_t n = *p++;
+            fprintf(out, "\n    %u,", n);
+            for (int k = 0; k < n; k++, p += 2)
+                fprintf(out, " %2u, %2u,", p[0], p[1]);
+        }
+        if (s->len == 0) fprintf(out, " 0");
+        fprintf(out, "\n};\n\n");
+
+        total += s->len;
+    }
+
+    fprintf(out, "const EyeSprite_t eye_sprites[EXPR_COUNT][2] = {\n");
+    for (int e = 0; e < EXPR_COUNT; e++)
+    {
+        fprintf(out, "    [%d] = {  /* %s */\n", e, expr_names[e]);
+        for (int k = 0; k < 2; k++)
+        {
+            const Sprite_t *s = &sprites[e * 2 + k];
+            fprintf(out, "        { ");
+            print_name(out, s->owner);
+            fprintf(out, ", %2u, %2u },\n", s->y0, s->h);
+        }
+        fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n\n");
+
+    total += EXPR_COUNT * 2 * ARM_DESC_SIZE;
+    fprintf(out, "const uint32_t eye_sprites_size = %u;\n", total);
+
+    if (out != stdout) fclose(out);
+    fprintf(stderr, "eyegen: %d expressions, %u bytes\n", EXPR_COUNT, total);
+    return 0;
+}
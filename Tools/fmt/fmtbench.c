@@ -0,0 +1,179 @@
+/**
+ * @file fmtbench.c
+ * @brief fmt.c (Fmt_Snprintf) vs C 라이브러리 snprintf - 결과 비교 + 한 줄당 시간 (호스트)
+ *
+ * 1. 같은 결과인지: 펌웨어가 실제로 쓰는 서식 줄 + 경계값 (음수, 0, 최대값, 폭, '-', '0', 잘림)
+ *    하나라도 다르면 종료 코드 1.
+ * 2. 속도: 펌웨어 출력 줄 몇 가지를 ROUNDS번씩 REPEATS 묶음 (fmt / libc 번갈아) - 가장 빠른 묶음의
+ *    ns/줄, x86이면 TSC 사이클/줄. 묶음 사이 편차(가장 느린 / 가장 빠른)도 표시 - 클수록 PC가 바빠서 흔들림.
+ *
+ * 비교 대상은 호스트 C 라이브러리(보통 glibc)이지 펌웨어가 쓰던 newlib-nano가 아님 - 여기엔
+ * arm-none-eabi 툴체인 / 사이클 세는 시뮬레이터가 없음. glibc printf는 newlib-nano보다 훨씬 다듬어져 있어
+ * 줄에 따라 fmt.c와 비슷하거나 더 빠름 (잰 PC: 긴 줄 0.94~1.18배, 짧은 lcd 줄만 1.27~1.61배).
+ * Cortex-M3 실제 숫자는 보드에서 'p'처럼 DWT로 재야 함.
+ *
+ * 사용법: fmtbench [rounds]
+ */
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC    1
+#endif
+
+#include "drivers/fmt.h"
+
+#define ROUNDS      200000
+#define REPEATS     7
+
+static int fails;
+
+/* ===== 1. 결과 비교 ===== */
+
+#define SAME(size, ...) do { \
+        char a[96], b[96]; \
+        int na = Fmt_Snprintf(a, (size), __VA_ARGS__); \
+        int nb = snprintf(b, (size), __VA_ARGS__); \
+        if (na != nb || strcmp(a, b) != 0) { \
+            fails++; \
+            printf("DIFF %-40s fmt=\"%s\"(%d) libc=\"%s\"(%d)\n", #__VA_ARGS__, a, na, b, nb); \
+        } \
+    } while (0)
+
+static void Compare(void)
+{
+    /* 펌웨어 줄 (main.c, robot_behavior.c, param.c, ui_fsm.c) */
+    SAME(96, "STATE:%s | angle=%3d | dist=%3d cm\r\n", "SCAN", 30, 7);
+    SAME(96, "STATE:%s | min_angle=%d | min_dist=%d cm\r\n", "DECIDE", 150, 999);
+    SAME(96, "STATE:%s | turned=%d deg%s\r\n", "ALERT", -45, " (TIMEOUT)");
+    SAME(96, "FSM %8lu.%03lu ms %s -> %s\r\n", 123456UL, 7UL, "SCAN", "DECIDE");
+    SAME(96, "FSM %-7s %7lu ms %3lu%% x%u\r\n", "AUTO", 98765UL, 42UL, 3U);
+    SAME(96, "I2C device found at address 0x%02X\r\n", 0x3C);
+    SAME(96, "PARAM %s=%u (%u..%u, default %u)\r\n", "scan_step", 10U, 1U, 45U, 10U);
+    SAME(17, "D:%3dcm A:%3d%c", 123, 90, 0xDF);
+    SAME(17, "AUTO : DECIDE ");
+
+    /* 경계 */
+    SAME(96, "%d %d %d", 0, INT_MAX, INT_MIN);
+    SAME(96, "%ld %lu", LONG_MIN, ULONG_MAX);
+    SAME(96, "%u %x %X %08x", UINT_MAX, 0xBEEFU, 0xBEEFU, 0x1234U);
+    SAME(96, "[%5d] [%-5d] [%05d] [%-5u]", -42, -42, -42, 42U);
+    SAME(96, "[%3s] [%-6s] [%1s] [%c]", "abcdef", "ab", "", 'x');
+    SAME(96, "100%% %s", "done");
+    SAME(5, "%s", "truncated");
+    SAME(1, "%d", 12345);
+}
+
+/* ===== 2. 속도 ===== */
+
+#define LINE(fn, ...) \
+    static int fn##_fmt(char *b, size_t n, int i)  { return Fmt_Snprintf(b, n, __VA_ARGS__); } \
+    static int fn##_libc(char *b, size_t n, int i) { return snprintf(b, n, __VA_ARGS__); }
+
+LINE(scan,  "STATE:%s | angle=%3d | dist=%3d cm\r\n", "SCAN", i & 127, (i * 7) & 511)
+LINE(trace, "FSM %8lu.%03lu ms %s -> %s\r\n", (unsigned long)i * 40UL, (unsigned long)(i % 1000), "SCAN", "DECIDE")
+LINE(i2c,   "I2C 0x%02X ok=%lu nack=%lu berr=%lu tout=%lu retry=%lu drop=%lu lat=%lu/%lu/%lu us\r\n",
+            0x27, (unsigned long)i, 3UL, 0UL, 1UL, 4UL, 0UL, 512UL, 498UL, 1700UL)
+LINE(lcd,   "D:%3dcm A:%3d%c", i % 400, i % 181, 0xDF)
+
+typedef struct {
+    const char *name;
+    int (*fmt)(char *, size_t, int);
+    int (*libc)(char *, size_t, int);
+} Case_t;
+
+static const Case_t cases[] = {
+    { "scan line",  scan_fmt,  scan_libc },
+    { "fsm trace",  trace_fmt, trace_libc },
+    { "i2c stats",  i2c_fmt,   i2c_libc },
+    { "lcd line",   lcd_fmt,   lcd_libc },
+};
+
+static volatile int sink;
+
+static double Now_Ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t Cycles(void)
+{
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+typedef struct {
+    double ns, cyc;             // 가장 빠른 묶음
+    double worst_ns;
+} Timing_t;
+
+/* 한 묶음 - 가장 빠른 것만 남김 */
+static void Time(int (*fn)(char *, size_t, int), int rounds, Timing_t *t)
+{
+    char buf[128];
+    double t0, ns, cyc;
+    uint64_t c0;
+
+    t0 = Now_Ns();
+    c0 = Cycles();
+    for (int i = 0; i < rounds; i++)
+        sink += fn(buf, sizeof(buf), i);
+    cyc = (double)(Cycles() - c0) / rounds;
+    ns  = (Now_Ns() - t0) / rounds;
+
+    if (t->ns == 0 || ns < t->ns) { t->ns = ns; t->cyc = cyc; }
+    if (ns > t->worst_ns) t->worst_ns = ns;
+}
+
+static void Bench(int rounds)
+{
+    double lo = 1e9, hi = 0;
+
+    printf("libc = host C library, not newlib-nano (see header)\n");
+    printf("%-10s %10s %10s %10s %10s %7s %7s\n", "line", "fmt ns", "libc ns", "fmt cyc", "libc cyc", "ratio",
+           "spread");
+    for (size_t k = 0; k < sizeof(cases) / sizeof(cases[0]); k++)
+    {
+        Timing_t f = { 0 }, l = { 0 };
+        char buf[128];
+        double ratio, spread;
+
+        for (int i = 0; i < rounds / 10; i++)   // 예열
+            sink += cases[k].fmt(buf, sizeof(buf), i) + cases[k].libc(buf, sizeof(buf), i);
+        for (int r = 0; r < REPEATS; r++)
+        {
+            Time(cases[k].fmt, rounds, &f);
+            Time(cases[k].libc, rounds, &l);
+        }
+
+        ratio  = l.ns / f.ns;
+        spread = (f.worst_ns / f.ns > l.worst_ns / l.ns) ? f.worst_ns / f.ns : l.worst_ns / l.ns;
+        if (ratio < lo) lo = ratio;
+        if (ratio > hi) hi = ratio;
+        printf("%-10s %10.1f %10.1f %10.0f %10.0f %6.2fx %6.2f\n",
+               cases[k].name, f.ns, l.ns, f.cyc, l.cyc, ratio, spread);
+    }
+    printf("fmt vs libc: %.2f-%.2fx (>1 = fmt faster)\n", lo, hi);
+}
+
+int main(int argc, char **argv)
+{
+    int rounds = (argc > 1) ? atoi(argv[1]) : ROUNDS;
+
+    Compare();
+    printf("compare: %s\n", fails ? "FAIL" : "OK (fmt == libc)");
+    Bench(rounds > 0 ? rounds : ROUNDS);
+    return fails ? 1 : 0;
+}
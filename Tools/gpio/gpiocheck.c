@@ -0,0 +1,308 @@
+/**
+ * @file gpiocheck.c
+ * @brief 모터 / RGB BSRR 마스크 테이블 검증 (호스트)
+ *
+ * 예전 핀별 HAL_GPIO_WritePin 코드(아래 ref_*)와 테이블 방식(motor.c, rgb_led.c)을
+ * 같은 초기 포트 상태에서 실행해 ODR이 비트 단위로 같은지 비교.
+ * 모든 (왼쪽 방향, 오른쪽 방향) 조합 x 무작위 초기 상태 64개.
+ * 램프로 방향이 바뀌는 동안 H브리지 한 채널의 F/B 입력이 동시에 켜지는지도 확인.
+ * RGB는 소프트웨어 PWM이라 CC3 비교 시각을 따라가며 채널별 ON 시간도 비교.
+ *
+ * 사용법: gpiocheck
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "main.h"
+#include "robot_config.h"
+#include "drivers/motor.h"
+#include "drivers/rgb_led.h"
+#include "hal_sim.h"
+
+#define STATES      64
+#define RAMP_LIMIT  1000    // 주기 (ms)
+
+static TIM_HandleTypeDef htim_sim;
+static int failures;
+
+/* ===== 예전 핀별 코드 (기준) ===== */
+
+static void ref_pair(GPIO_TypeDef *fp, uint16_t f, GPIO_TypeDef *bp, uint16_t b, MotorDir_t dir)
+{
+    HAL_GPIO_WritePin(fp, f, dir == MOTOR_FORWARD ? GPIO_PIN_SET : GPIO_PIN_RESET);
+    HAL_GPIO_WritePin(bp, b, dir == MOTOR_BACKWARD ? GPIO_PIN_SET : GPIO_PIN_RESET);
+}
+
+static void ref_side(MotorSide_t side, MotorDir_t dir)
+{
+    if (side == MOTOR_SIDE_LEFT)
+    {
+        ref_pair(MOTOR_LFF_PORT, MOTOR_LFF_PIN, MOTOR_LFB_PORT, MOTOR_LFB_PIN, dir);
+        ref_pair(MOTOR_LBF_PORT, MOTOR_LBF_PIN, MOTOR_LBB_PORT, MOTOR_LBB_PIN, dir);
+    }
+    else
+    {
+        ref_pair(MOTOR_RFF_PORT, MOTOR_RFF_PIN, MOTOR_RFB_PORT, MOTOR_RFB_PIN, dir);
+        ref_pair(MOTOR_RBF_PORT, MOTOR_RBF_PIN, MOTOR_RBB_PORT, MOTOR_RBB_PIN, dir);
+    }
+}
+
+static void ref_rgb(int color)
+{
+    GPIO_PinState g = GPIO_PIN_RESET, r = GPIO_PIN_RESET;
+
+    if (color == RGB_COLOR_GREEN || color == RGB_COLOR_ORANGE) g = GPIO_PIN_SET;
+    if (color == RGB_COLOR_RED || color == RGB_COLOR_ORANGE)   r = GPIO_PIN_SET;
+
+    HAL_GPIO_WritePin(GPIOC, GREEN_Pin, g);
+    HAL_GPIO_WritePin(GPIOC, RED_Pin, r);
+    HAL_GPIO_WritePin(GPIOC, BLUE_Pin, GPIO_PIN_RESET);
+}
+
+/* ===== 포트 상태 ===== */
+
+typedef struct { uint32_t odr[4]; } Ports_t;
+
+static void ports_load(const Ports_t *p)
+{
+    for (int i = 0; i < 4; i++) { sim_gpio[i].ODR = p->odr[i]; sim_gpio[i].BSRR = 0; }
+}
+
+static void ports_save(Ports_t *p)
+{
+    Sim_GpioLatch();
+    for (int i = 0; i < 4; i++) p->odr[i] = sim_gpio[i].ODR;
+}
+
+static void ports_random(Ports_t *p)
+{
+    for (int i = 0; i < 4; i++) p->odr[i] = (uint32_t)rand() & 0xFFFFU;
+}
+
+static void expect_same(const char *what, const Ports_t *want, const Ports_t *got)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        if (want->odr[i] != got->odr[i])
+        {
+            printf("FAIL %s: GPIO%c ODR %04X (기준) != %04X (테이블)\n",
+                   what, 'A' + i, (unsigned)want->odr[i], (unsigned)got->odr[i]);
+            failures++;
+            return;
+        }
+    }
+}
+
+/* ===== H브리지 F/B 동시 ON 검사 ===== */
+
+static int pin_high(GPIO_TypeDef *port, uint16_t pin)
+{
+    return (port->ODR & pin) != 0;
+}
+
+static int shoot_through(void)
+{
+    Sim_GpioLatch();
+    return (pin_high(MOTOR_LFF_PORT, MOTOR_LFF_PIN) && pin_high(MOTOR_LFB_PORT, MOTOR_LFB_PIN)) ||
+           (pin_high(MOTOR_LBF_PORT, MOTOR_LBF_PIN) && pin_high(MOTOR_LBB_PORT, MOTOR_LBB_PIN)) ||
+           (pin_high(MOTOR_RFF_PORT, MOTOR_RFF_PIN) && pin_high(MOTOR_RFB_PORT, MOTOR_RFB_PIN)) ||
+           (pin_high(MOTOR_RBF_PORT, MOTOR_RBF_PIN) && pin_high(MOTOR_RBB_PORT, MOTOR_RBB_PIN));
+}
+
+/**
+ * @brief 목표 속도까지 PWM 주기를 돌림 (매 주기 시작과 듀티 끝에서 F/B 동시 ON 검사)
+ * @return 걸린 주기 수
+ */
+static int ramp_to(int8_t left, int8_t right)
+{
+    int n = 0;
+
+    Motor_SetSpeed(left, right);
+    while (!Motor_IsSettled() && n < RAMP_LIMIT)
+    {
+        Motor_OnPeriod();
+        if (shoot_through()) { printf("FAIL 램프 %d주기째 F/B 동시 ON\n", n); failures++; }
+        Motor_OnCompare(MOTOR_SIDE_LEFT);
+        Motor_OnCompare(MOTOR_SIDE_RIGHT);
+        if (shoot_through()) { printf("FAIL 램프 %d주기째 (OFF 구간) F/B 동시 ON\n", n); failures++; }
+        n++;
+    }
+    Motor_OnPeriod();
+    return n;
+}
+
+static int8_t dir_speed(MotorDir_t d)
+{
+    return (d == MOTOR_FORWARD) ? MOTOR_SPEED_MAX : (d == MOTOR_BACKWARD) ? -MOTOR_SPEED_MAX : 0;
+}
+
+static const char *dir_name[3] = { "STOP", "FWD", "BWD" };
+
+static void check_motor(void)
+{
+    int combos = 0;
+
+    Sim_Reset();
+    Motor_Init(&htim_sim);
+
+    for (int dl = 0; dl < 3; dl++)
+    {
+        for (int dr = 0; dr < 3; dr++)
+        {
+            char what[64];
+
+            snprintf(what, sizeof(what), "motor L=%s R=%s", dir_name[dl], dir_name[dr]);
+            ramp_to(dir_speed(dl), dir_speed(dr));
+
+            for (int k = 0; k < STATES; k++)
+            {
+                Ports_t init, want, got;
+
+                ports_random(&init);
+
+                /* 주기 시작 (듀티 100%라 비교 인터럽트 없음) */
+                ports_load(&init);
+                ref_side(MOTOR_SIDE_LEFT, dl);
+                ref_side(MOTOR_SIDE_RIGHT, dr);
+                ports_save(&want);
+
+                ports_load(&init);
+                Motor_OnPeriod();
+                ports_save(&got);
+                expect_same(what, &want, &got);
+
+                /* 듀티 끝 (한쪽씩 코스팅) */
+                for (int side = 0; side < MOTOR_SIDE_COUNT; side++)
+                {
+                    ports_load(&init);
+                    ref_side(side, MOTOR_STOP);
+                    ports_save(&want);
+
+                    ports_load(&init);
+                    Motor_OnCompare(side);
+                    ports_save(&got);
+                    expect_same(side ? "motor R 듀티 끝" : "motor L 듀티 끝", &want, &got);
+                }
+            }
+            combos++;
+        }
+    }
+
+    /* 전진 최고 → 후진 최고 반전 */
+    ramp_to(MOTOR_SPEED_MAX, -MOTOR_SPEED_MAX);
+    int n_rev = ramp_to(-MOTOR_SPEED_MAX, MOTOR_SPEED_MAX);
+
+    printf("motor  방향 조합 %d x 초기 상태 %d, 반전 램프 %d ms - 포트당 BSRR 1회 (기존 핀당 1회, 8회)\n",
+           combos, STATES, n_rev);
+}
+
+/**
+ * @brief 한 PWM 주기를 CC3 비교 시각대로 진행하며 채널별 ON 시간 (us) 측정
+ * @return CC3 인터럽트 수
+ */
+static int rgb_period(uint16_t on_us[3])
+{
+    static const uint16_t pins[3] = { RED_Pin, GREEN_Pin, BLUE_Pin };
+    int n = 0;
+
+    htim_sim.cnt = 0;
+    RGB_OnPeriod();
+    Sim_GpioLatch();
+    for (int ch = 0; ch < 3; ch++) on_us[ch] = (GPIOC->ODR & pins[ch]) ? 1000 : 0;
+
+    while (__HAL_TIM_GET_COMPARE(&htim_sim, TIM_CHANNEL_3) < 1000 && n < 8)
+    {
+        uint16_t t = (uint16_t)__HAL_TIM_GET_COMPARE(&htim_sim, TIM_CHANNEL_3);
+
+        htim_sim.cnt = t;
+        RGB_OnCompare();
+        Sim_GpioLatch();
+        for (int ch = 0; ch < 3; ch++)
+            if (on_us[ch] == 1000 && !(GPIOC->ODR & pins[ch])) on_us[ch] = t;
+        n++;
+    }
+    return n;
+}
+
+static uint16_t ref_duty(uint8_t level)
+{
+    uint32_t d = ((uint32_t)level * level + 32) / 65;
+
+    return (d > 1000) ? 1000 : (uint16_t)d;
+}
+
+static void check_rgb(void)
+{
+    static const int colors[] = { RGB_COLOR_GREEN, RGB_COLOR_RED, RGB_COLOR_ORANGE, 3, -1 };
+    static const uint8_t levels[] = { 0, 1, 8, 64, 128, 200, 254, 255 };
+    int max_cc = 0;
+
+    RGB_Init(&htim_sim);
+
+    /* 기본 색 (0% / 100%만) - 주기 시작에 BSRR 한 번으로 예전 코드와 같은 ODR */
+    for (unsigned c = 0; c < sizeof(colors) / sizeof(colors[0]); c++)
+    {
+        for (int k = 0; k < STATES; k++)
+        {
+            Ports_t init, want, got;
+            char what[32];
+
+            snprintf(what, sizeof(what), "RGB_Set(%d)", colors[c]);
+            ports_random(&init);
+
+            ports_load(&init);
+            ref_rgb(colors[c]);
+            ports_save(&want);
+
+            RGB_Set(colors[c]);
+            ports_load(&init);
+            RGB_OnPeriod();
+            ports_save(&got);
+            expect_same(what, &want, &got);
+        }
+    }
+
+    /* 단계 조합별 ON 시간 = 감마 듀티 */
+    for (unsigned r = 0; r < sizeof(levels); r++)
+        for (unsigned g = 0; g < sizeof(levels); g++)
+            for (unsigned b = 0; b < sizeof(levels); b++)
+            {
+                uint8_t lv[3] = { levels[r], levels[g], levels[b] };
+                uint16_t on_us[3];
+                int n;
+
+                RGB_SetColor(RGB(lv[0], lv[1], lv[2]));
+                n = rgb_period(on_us);
+                if (n > max_cc) max_cc = n;
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    if (on_us[ch] != ref_duty(lv[ch]))
+                    {
+                        printf("FAIL rgb (%u,%u,%u) 채널 %d ON %u us != %u us\n",
+                               lv[0], lv[1], lv[2], ch, on_us[ch], ref_duty(lv[ch]));
+                        failures++;
+                    }
+                }
+            }
+
+    printf("rgb    색 5개 x 초기 상태 %d - BSRR 1회, 단계 조합 %u개 듀티 일치 (주기당 CC3 최대 %d번)\n",
+           STATES, (unsigned)(sizeof(levels) * sizeof(levels) * sizeof(levels)), max_cc);
+}
+
+int main(void)
+{
+    srand(1);
+
+    check_motor();
+    check_rgb();
+
+    if (failures)
+    {
+        printf("불일치 %d건\n", failures);
+        return 1;
+    }
+    printf("OK - 테이블 결과가 핀별 코드와 비트 단위로 같음\n");
+    return 0;
+}
@@ -0,0 +1,77 @@
+# ramfunc_report.awk - GNU ld 맵 파일에서 SRAM 코드(.ramfunc) 비용 보고
+#
+#   awk -f ramfunc_report.awk 01_IAMR_Prj.map
+#
+# .ramfunc 안의 오브젝트별 크기, 그 아래 전역 함수별 크기 (다음 심볼 / 오브젝트 끝까지 -
+# static 함수는 맵에 이름이 없어서 앞 함수에 합쳐짐), 링커 veneer 수,
+# RAM 전체 (.data / .ramfunc / .bss / 힙+스택 예약) 요약.
+
+function hex(s,    i, c, v) {
+    s = tolower(s); sub(/^0x/, "", s); v = 0
+    for (i = 1; i <= length(s); i++) {
+        c = index("0123456789abcdef", substr(s, i, 1))
+        if (!c) break
+        v = v * 16 + c - 1
+    }
+    return v
+}
+
+function base(path) { sub(/.*[\/\\]/, "", path); return path }
+
+# 모아둔 심볼을 크기와 함께 출력 줄로
+function flush_syms(end,    i) {
+    for (i = 1; i <= nsym; i++)
+        out[++nout] = sprintf("      %-28s %6d", sym[i], ((i < nsym) ? symaddr[i + 1] : end) - symaddr[i])
+    nsym = 0
+}
+
+function sect(name, addr, size) { sect_addr[name] = hex(addr); sect_size[name] = hex(size) }
+
+# 출력 섹션 머리: ".data  0x20000000  0x1c load address ..." (이름이 길면 숫자는 다음 줄)
+/^\.[A-Za-z_]/ {
+    if (inram) { flush_syms(obj_end); inram = 0 }
+    pending = ""
+    if (NF >= 3 && $2 ~ /^0x/) sect($1, $2, $3)
+    else pending = $1
+    inram = ($1 == ".ramfunc")
+    next
+}
+
+pending != "" {
+    if ($1 ~ /^0x/ && NF >= 2) sect(pending, $1, $2)
+    pending = ""
+    next
+}
+
+!inram { next }
+
+# 입력 섹션: " .ramfunc  0x20000000  0xd8 ./Core/Src/drivers/lcd_gfx.o"
+$1 ~ /^\.ramfunc/ && $2 ~ /^0x/ && NF >= 4 {
+    flush_syms(obj_end)
+    obj_end = hex($2) + hex($3)
+    if (hex($3) > 0) out[++nout] = sprintf("  %-32s %6d", base($4), hex($3))
+    next
+}
+
+$1 ~ /^0x/ && NF == 2 && $2 ~ /_veneer$/ { veneers++; next }
+
+$1 ~ /^0x/ && NF == 2 && $2 !~ /[=.(]/ {
+    sym[++nsym] = $2; symaddr[nsym] = hex($1)
+    next
+}
+
+END {
+    if (inram) flush_syms(obj_end)
+    if (!(".ramfunc" in sect_size)) {
+        print "no .ramfunc section in map (old linker script?)"
+        exit 1
+    }
+    printf(".ramfunc  %d bytes at 0x%08X\n", sect_size[".ramfunc"], sect_addr[".ramfunc"])
+    for (i = 1; i <= nout; i++) print out[i]
+    if (veneers) printf("  %d veneer(s) - flash <-> SRAM long branches\n", veneers)
+
+    ram = sect_size[".data"] + sect_size[".ramfunc"] + sect_size[".bss"] + sect_size["._user_heap_stack"]
+    printf("RAM  .data %d + .ramfunc %d + .bss %d + heap/stack reserve %d = %d of 20480 (%d%%)\n",
+           sect_size[".data"], sect_size[".ramfunc"], sect_size[".bss"], sect_size["._user_heap_stack"],
+           ram, ram * 100 / 20480)
+}
@@ -0,0 +1,486 @@
+/**
+ * @file melodyc.c
+ * @brief 멜로디 컴파일러 (호스트) - RTTTL / 표준 MIDI → 부저 곡 테이블
+ *
+ * 입력 파일 하나가 곡 하나 (BuzzerSong_t). 음 하나는 uint16_t 묶음
+ * ([15:12] 길이 등급, [11:0] 주파수) - 형식은 drivers/buzzer.h.
+ *
+ * - RTTTL: "이름:d=4,o=5,b=120:8e6,8d#6,4a.,p,..."
+ * - MIDI:  형식 0/1, 모든 트랙의 음을 합쳐 가장 높은 음만 (부저는 단음),
+ *          드럼 채널(10) 제외, 템포 변경 반영
+ * 길이는 가장 가까운 등급으로 양자화하고 오차를 다음 음으로 넘겨 박자가 밀리지 않게 함.
+ *
+ * 사용법: melodyc -o buzzer_songs.c -H buzzer_songs.h [-g gap_ms] 파일.rtttl|파일.mid ...
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "drivers/buzzer.h"
+
+#define MAX_NOTES       1024
+#define MAX_SONGS       32
+#define MAX_EVENTS      8192
+#define NAME_LEN        32
+#define DEFAULT_GAP_MS  15
+
+/* 예전 BuzzerNote_t {on_ms, off_ms} 한 음 = 4바이트 */
+#define OLD_NOTE_SIZE   4
+
+typedef struct {
+    char     name[NAME_LEN];
+    uint16_t notes[MAX_NOTES];
+    int      count;
+    uint16_t whole_ms;
+    int      clamped;           // 12비트 넘어 옥타브 내린 음 수
+    double   err_ms;            // 양자화 누적 오차 (끝에서)
+} Song_t;
+
+static Song_t songs[MAX_SONGS];
+static int song_count;
+
+static const uint16_t dur_units[16] = BUZZER_DUR_UNITS;
+
+/* ===== 공통 ===== */
+
+static uint16_t midi_to_hz(int key)
+{
+    double hz = 440.0 * pow(2.0, (key - 69) / 12.0);
+
+    return (uint16_t)(hz + 0.5);
+}
+
+static void song_name(Song_t *s, const char *src)
+{
+    int n = 0;
+
+    for (; *src && n < NAME_LEN - 1; src++)
+    {
+        char c = (char)tolower((unsigned char)*src);
+        if (isalnum((unsigned char)c)) s->name[n++] = c;
+        else if (n > 0 && s->name[n - 1] != '_') s->name[n++] = '_';
+    }
+    while (n > 0 && s->name[n - 1] == '_') n--;
+    s->name[n] = '\0';
+    if (n == 0) strcpy(s->name, "song");
+}
+
+static int emit(Song_t *s, int cls, uint16_t hz)
+{
+    if (s->count >= MAX_NOTES)
+    {
+        fprintf(stderr, "melodyc: %s: 음이 %d개를 넘음\n", s->name, MAX_NOTES);
+        return -1;
+    }
+
+    while (hz > BUZZER_FREQ_MAX) { hz /= 2; s->clamped++; }
+    s->notes[s->count++] = BUZZER_PACK(cls, hz);
+    return 0;
+}
+
+static double class_ms(const Song_t *s, int cls)
+{
+    /* 펌웨어와 같은 정수 나눗셈 */
+    return (uint32_t)s->whole_ms * dur_units[cls] / BUZZER_DUR_WHOLE;
+}
+
+/**
+ * @brief 길이(ms)를 가장 가까운 등급으로 내보냄 (누적 오차는 다음 음으로)
+ * @note  가장 긴 등급보다 길면 그만큼 나눠서 여러 음으로
+ */
+static int emit_ms(Song_t *s, double ms, uint16_t hz)
+{
+    double want = ms + s->err_ms;
+    int best = 0;
+
+    if (want < class_ms(s, 0) / 2)
+    {
+        s->err_ms = want;       // 너무 짧음 - 다음 음에 붙임
+        return 0;
+    }
+
+    while (want > class_ms(s, 15) * 1.25)
+    {
+        if (emit(s, 15, hz) < 0) return -1;
+        want -= class_ms(s, 15);
+    }
+
+    for (int c = 1; c < 16; c++)
+        if (fabs(want - class_ms(s, c)) < fabs(want - class_ms(s, best))) best = c;
+
+    if (emit(s, best, hz) < 0) return -1;
+    s->err_ms = want - class_ms(s, best);
+    return 0;
+}
+
+/* ===== RTTTL ===== */
+
+static int parse_rtttl(Song_t *s, char *text)
+{
+    static const int semis[7] = { 9, 11, 0, 2, 4, 5, 7 };   // a b c d e f g
+    char *name = text, *defs, *body, *p;
+    int def_d = 4, def_o = 6, bpm = 63;
+
+    defs = strchr(name, ':');
+    if (!defs) return -1;
+    *defs++ = '\0';
+    body = strchr(defs, ':');
+    if (!body) return -1;
+    *body++ = '\0';
+
+    song_name(s, name);
+
+    for (p = strtok(defs, ","); p; p = strtok(NULL, ","))
+    {
+        while (isspace((unsigned char)*p)) p++;
+        if (p[0] && p[1] == '=')
+        {
+            int v = atoi(p + 2);
+            if (p[0] == 'd') def_d = v;
+            else if (p[0] == 'o') def_o = v;
+            else if (p[0] == 'b') bpm = v;
+        }
+    }
+    if (bpm <= 0 || def_d <= 0) return -1;
+
+    s->whole_ms = (uint16_t)(4 * 60000 / bpm);
+
+    for (p = body; *p; )
+    {
+        int dur = 0, oct = def_o, key = -1, dotted = 0;
+        uint16_t hz = 0;
+
+        while (*p && (isspace((unsigned char)*p) || *p == ',')) p++;
+        if (!*p) break;
+
+        while (isdigit((unsigned char)*p)) dur = dur * 10 + (*p++ - '0');
+        if (dur == 0) dur = def_d;
+
+        char n = (char)tolower((unsigned char)*p++);
+        if (n >= 'a' && n <= 'g') key = semis[n - 'a'];
+        else if (n == 'h') key = 11;            // 독일식 H = B
+        else if (n != 'p')
+        {
+            fprintf(stderr, "melodyc: %s: 알 수 없는 음 '%c'\n", s->name, n);
+            return -1;
+        }
+
+        if (*p == '#') { key++; p++; }
+        if (*p == '.') { dotted = 1; p++; }
+        if (isdigit((unsigned char)*p)) oct = *p++ - '0';
+        if (*p == '.') { dotted = 1; p++; }
+
+        if (key >= 0) hz = midi_to_hz(12 * (oct + 1) + key);
+
+        double ms = s->whole_ms / (double)dur * (dotted ? 1.5 : 1.0);
+        if (emit_ms(s, ms, hz) < 0) return -1;
+    }
+    return 0;
+}
+
+/* ===== MIDI ===== */
+
+typedef struct {
+    uint32_t tick;
+    uint8_t  type;      // 0 = 음 끄기, 1 = 음 켜기, 2 = 템포
+    uint8_t  key;
+    uint32_t tempo;     // us / 4분음표
+} MidiEvent_t;
+
+static MidiEvent_t events[MAX_EVENTS];
+static int event_count;
+
+static uint32_t be32(const uint8_t *p) { return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3]; }
+static uint16_t be16(const uint8_t *p) { return (uint16_t)(p[0] << 8 | p[1]); }
+
+static uint32_t read_vlq(const uint8_t **p, const uint8_t *end)
+{
+    uint32_t v = 0;
+
+    while (*p < end)
+    {
+        uint8_t b = *(*p)++;
+        v = (v << 7) | (b & 0x7F);
+        if (!(b & 0x80)) break;
+    }
+    return v;
+}
+
+static int add_event(uint32_t tick, uint8_t type, uint8_t key, uint32_t tempo)
+{
+    if (event_count >= MAX_EVENTS) return -1;
+    events[event_count++] = (MidiEvent_t){ tick, type, key, tempo };
+    return 0;
+}
+
+static int parse_track(const uint8_t *p, const uint8_t *end)
+{
+    uint32_t tick = 0;
+    uint8_t status = 0;
+
+    while (p < end)
+    {
+        tick += read_vlq(&p, end);
+        if (p >= end) break;
+
+        if (*p & 0x80) status = *p++;           // 아니면 running status
+        if (status == 0xFF)
+        {
+            uint8_t meta = *p++;
+            uint32_t len = read_vlq(&p, end);
+
+            if (meta == 0x51 && len == 3 && p + 3 <= end)
+                add_event(tick, 2, 0, (uint32_t)p[0] << 16 | p[1] << 8 | p[2]);
+            if (meta == 0x2F) break;
+            p += len;
+            status = 0;
+        }
+        else if (status == 0xF0 || status == 0xF7)
+        {
+            p += read_vlq(&p, end);
+            status = 0;
+        }
+        else
+        {
+            uint8_t kind = status & 0xF0, ch = status & 0x0F;
+            uint8_t d1 = *p++;
+            uint8_t d2 = (kind == 0xC0 || kind == 0xD0) ? 0 : *p++;
+
+            if (ch == 9) continue;              // 드럼
+            if (kind == 0x90 && d2 > 0) { if (add_event(tick, 1, d1, 0) < 0) return -1; }
+            else if (kind == 0x80 || kind == 0x90) { if (add_event(tick, 0, d1, 0) < 0) return -1; }
+        }
+    }
+    return 0;
+}
+
+static int event_cmp(const void *a, const void *b)
+{
+    const MidiEvent_t *x = a, *y = b;
+
+    if (x->tick != y->tick) return (x->tick < y->tick) ? -1 : 1;
+    return (int)x->type - (int)y->type;         // 같은 틱: 끄기 → 켜기 → 템포
+}
+
+static int parse_midi(Song_t *s, const uint8_t *buf, long size, const char *path)
+{
+    const uint8_t *p = buf, *end = buf + size;
+    uint16_t ntracks, division;
+    uint8_t held[128] = {0};
+    uint32_t tempo = 500000, last_tick = 0;
+    double ms_per_tick, pending_ms = 0;
+    int sounding = -1;
+
+    if (size < 14 || memcmp(p, "MThd", 4) != 0) return -1;
+    ntracks  = be16(p + 10);
+    division = be16(p + 12);
+    if (division & 0x8000) { fprintf(stderr, "melodyc: SMPTE 시간 단위는 지원 안 함\n"); return -1; }
+    p += 8 + be32(p + 4);
+
+    event_count = 0;
+    for (int t = 0; t < ntracks && p + 8 <= end; t++)
+    {
+        uint32_t len = be32(p + 4);
+        if (memcmp(p, "MTrk", 4) == 0 && p + 8 + len <= end)
+            if (parse_track(p + 8, p + 8 + len) < 0) return -1;
+        p += 8 + len;
+    }
+    qsort(events, event_count, sizeof(events[0]), event_cmp);
+
+    /* 이름 = 파일 이름, 온음표 = 첫 템포 기준 */
+    const char *base = strrchr(path, '/');
+    base = base ? base + 1 : path;
+    char stem[NAME_LEN];
+    snprintf(stem, sizeof(stem), "%s", base);
+    if (strchr(stem, '.')) *strchr(stem, '.') = '\0';
+    song_name(s, stem);
+
+    for (int i = 0; i < event_count; i++)
+        if (events[i].type == 2 && events[i].tick == 0) tempo = events[i].tempo;
+    s->whole_ms = (uint16_t)(4 * tempo / 1000);
+    ms_per_tick = tempo / 1000.0 / division;
+
+    /* 가장 높은 음만 따라가면서 구간마다 내보냄 */
+    for (int i = 0; i <= event_count; i++)
+    {
+        uint32_t tick = (i < event_count) ? events[i].tick : last_tick;
+
+        pending_ms += (tick - last_tick) * ms_per_tick;
+        last_tick = tick;
+
+        /* 같은 틱의 이벤트를 다 처리한 뒤 바뀌었으면 구간 마감 */
+        if (i < event_count)
+        {
+            const MidiEvent_t *e = &events[i];
+            if (e->type == 2) ms_per_tick = e->tempo / 1000.0 / division;
+            else if (e->type == 1) held[e->key]++;
+            else if (held[e->key]) held[e->key]--;
+
+            if (i + 1 < event_count && events[i + 1].tick == tick) continue;
+        }
+
+        int top = -1;
+        for (int k = 127; k >= 0; k--) if (held[k]) { top = k; break; }
+
+        if (top != sounding || i == event_count)
+        {
+            if (pending_ms > 0 && !(sounding < 0 && s->count == 0))    // 앞쪽 무음은 버림
+                if (emit_ms(s, pending_ms, sounding < 0 ? 0 : midi_to_hz(sounding)) < 0) return -1;
+            pending_ms = 0;
+            sounding = top;
+        }
+    }
+    return 0;
+}
+
+/* ===== 출력 ===== */
+
+static void write_c(FILE *out, const char *hname, int gap_ms)
+{
+    fprintf(out,
+        "/**\n"
+        " * @file buzzer_songs.c\n"
+        " * @brief 부저 곡 데이터 (2바이트 묶음 음 테이블)\n"
+        " *\n"
+        " * 자동 생성 파일 - 직접 수정하지 말 것 (make -C Tools melodies)\n"
+        " * 원본: Tools/melody/songs/\n"
+        " */\n\n"
+        "#include \"drivers/%s\"\n", hname);
+
+    for (int i = 0; i < song_count; i++)
+    {
+        const Song_t *s = &songs[i];
+
+        fprintf(out, "\nstatic const uint16_t %s_notes[%d] = {", s->name, s->count);
+        for (int n = 0; n < s->count; n++)
+            fprintf(out, "%s0x%04X,", (n % 8) ? " " : "\n    ", s->notes[n]);
+        fprintf(out, "\n};\n\n");
+        fprintf(out, "const BuzzerSong_t song_%s = { %s_notes, %d, %u, %d };\n",
+                s->name, s->name, s->count, s->whole_ms, gap_ms);
+    }
+}
+
+static void write_h(FILE *out, const char *hname)
+{
+    char guard[64];
+    int n = 0;
+
+    for (const char *p = hname; *p && n < (int)sizeof(guard) - 1; p++)
+        guard[n++] = isalnum((unsigned char)*p) ? (char)toupper((unsigned char)*p) : '_';
+    guard[n] = '\0';
+
+    fprintf(out,
+        "/**\n"
+        " * @file %s\n"
+        " * @brief 부저 곡 목록\n"
+        " *\n"
+        " * 자동 생성 파일 - 직접 수정하지 말 것 (make -C Tools melodies)\n"
+        " */\n\n"
+        "#ifndef __%s\n"
+        "#define __%s\n\n"
+        "#include \"drivers/buzzer.h\"\n\n", hname, guard, guard);
+
+    for (int i = 0; i < song_count; i++)
+        fprintf(out, "extern const BuzzerSong_t song_%s;\n", songs[i].name);
+
+    fprintf(out, "\n#endif /* __%s */\n", guard);
+}
+
+static char *read_file(const char *path, long *size)
+{
+    FILE *f = fopen(path, "rb");
+    char *buf;
+
+    if (!f) { perror(path); return NULL; }
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(*size + 1);
+    if (buf && fread(buf, 1, *size, f) != (size_t)*size) { free(buf); buf = NULL; }
+    if (buf) buf[*size] = '\0';
+    fclose(f);
+    return buf;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "사용법: melodyc -o songs.c -H songs.h [-g gap_ms] 파일.rtttl|파일.mid ...\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *c_path = NULL, *h_path = NULL;
+    int gap_ms = DEFAULT_GAP_MS;
+    int i, total_notes = 0;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++)
+    {
+        if (i + 1 >= argc) { usage(); return 1; }
+        if (strcmp(argv[i], "-o") == 0)      c_path = argv[++i];
+        else if (strcmp(argv[i], "-H") == 0) h_path = argv[++i];
+        else if (strcmp(argv[i], "-g") == 0) gap_ms = atoi(argv[++i]);
+        else { usage(); return 1; }
+    }
+    if (!c_path || !h_path || i >= argc) { usage(); return 1; }
+
+    for (; i < argc; i++)
+    {
+        Song_t *s;
+        long size;
+        char *buf;
+        int rc;
+
+        if (song_count >= MAX_SONGS) { fprintf(stderr, "melodyc: 곡이 너무 많음\n"); return 1; }
+        s = &songs[song_count];
+
+        buf = read_file(argv[i], &size);
+        if (!buf) return 1;
+
+        if (size >= 4 && memcmp(buf, "MThd", 4) == 0)
+            rc = parse_midi(s, (const uint8_t *)buf, size, argv[i]);
+        else
+            rc = parse_rtttl(s, buf);
+        free(buf);
+
+        if (rc < 0 || s->count == 0)
+        {
+            fprintf(stderr, "melodyc: %s: 해석 실패\n", argv[i]);
+            return 1;
+        }
+
+        for (int k = 0; k < song_count; k++)
+        {
+            if (strcmp(songs[k].name, s->name) == 0)
+            {
+                fprintf(stderr, "melodyc: %s: 곡 이름 '%s' 중복\n", argv[i], s->name);
+                return 1;
+            }
+        }
+
+        fprintf(stderr, "%-12s %4d음  %5d B (묶음)  %5d B (on/off 형식)  온음표 %u ms%s\n",
+                s->name, s->count, s->count * 2, s->count * OLD_NOTE_SIZE, s->whole_ms,
+                s->clamped ? "  *옥타브 내림" : "");
+        total_notes += s->count;
+        song_count++;
+    }
+
+    /* 디스크립터: 포인터 4 + count/whole_ms/gap_ms 6 + 패딩 2 (ARM) */
+    fprintf(stderr, "합계         %4d음  %5d B + 디스크립터 %d B\n",
+            total_notes, total_notes * 2, song_count * 12);
+
+    FILE *fc = fopen(c_path, "w");
+    FILE *fh = fopen(h_path, "w");
+    if (!fc || !fh) { perror("melodyc"); return 1; }
+
+    const char *hname = strrchr(h_path, '/');
+    hname = hname ? hname + 1 : h_path;
+
+    write_c(fc, hname, gap_ms);
+    write_h(fh, hname);
+    fclose(fc);
+    fclose(fh);
+    return 0;
+}
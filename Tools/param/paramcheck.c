@@ -0,0 +1,203 @@
+/**
+ * @file paramcheck.c
+ * @brief 파라미터 저장 검사 - param.c + flash_ee.c를 시뮬레이션 플래시(sim/flash_sim.c) 위에서 (호스트)
+ *
+ *   1. UART 명령 줄: :set 범위 / 관계 / 숫자 검사, 끊긴 줄 버림, :save는 IDLE에서만, 재부팅 뒤 값 유지
+ *   2. 닳기: 저장을 수천 번 반복 - 페이지 두 장이 번갈아 지워지는지, 레코드 수가 넘치지 않는지
+ *   3. 전원 끊김: 페이지 옮기기가 걸린 쓰기를 동작 하나마다 끊어보고 재부팅
+ *      → 모든 태그가 예전 값 또는 새 값 (다른 태그는 그대로)
+ *
+ * 실패가 하나라도 있으면 종료 코드 1.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "param.h"
+#include "robot_state.h"
+#include "drivers/flash_ee.h"
+#include "hal_sim.h"
+
+#define WEAR_SAVES      5000
+#define CUT_TAGS        9           // 전원 끊김 검사에 쓰는 태그 수 (파라미터 개수와 같게)
+
+static int fails;
+
+#define CHECK(cond, ...) do { if (!(cond)) { fails++; printf("FAIL: " __VA_ARGS__); printf("\n"); } } while (0)
+
+/* SCAN 하나만 있는 상태 표 - :save가 IDLE 밖에서 거절되는지 보려고 */
+static const RobotStateDesc_t test_states[STATE_COUNT] = {
+    [STATE_IDLE] = { "IDLE", STATE_NONE, NULL, NULL, NULL, NULL, NULL, 0 },
+    [STATE_SCAN] = { "SCAN", STATE_NONE, NULL, NULL, NULL, NULL, NULL, 0 },
+};
+
+/* 한 줄 보내고 (끝에 CR) 메인 루프 처리 */
+static void Uart(const char *line)
+{
+    printf("> %s\n", line);
+    while (*line)
+        Param_RxChar((uint8_t)*line++);
+    Param_RxChar('\r');
+    Param_Poll();
+}
+
+static void Reboot(void)
+{
+    Sim_FlashPowerCut(-1);
+    Param_Init();
+}
+
+/* ===== 1. 명령 줄 ===== */
+
+static void Test_Commands(void)
+{
+    uint16_t safe, step, arc;
+    char buf[48];
+
+    printf("=== commands\n");
+    Sim_FlashReset();
+    Reboot();
+    safe = Param_Get(PARAM_DIST_SAFE);
+    step = Param_Get(PARAM_SCAN_STEP);
+
+    CHECK(!Param_RxChar('t'), "한 글자 명령을 가로챔");
+
+    Uart(":set scan_step 15");
+    CHECK(Param_Get(PARAM_SCAN_STEP) == 15, "scan_step=%u", Param_Get(PARAM_SCAN_STEP));
+
+    Uart(":set scan_step 99");
+    CHECK(Param_Get(PARAM_SCAN_STEP) == 15, "범위 밖 값이 들어감");
+
+    snprintf(buf, sizeof(buf), ":set dist_warning %u", safe);
+    Uart(buf);
+    CHECK(Param_Get(PARAM_DIST_WARNING) < safe, "dist_warning >= dist_safe");
+
+    Uart(":set nothing 1");
+    Uart(":get scan_step");
+
+    /* uint16_t로 줄이기 전에 범위 검사 (65636 = 100 + 65536), 숫자가 아니면 거절 */
+    arc = Param_Get(PARAM_AVOID_ARC_MS);
+    Uart(":set avoid_arc_ms 65636");
+    CHECK(Param_Get(PARAM_AVOID_ARC_MS) == arc, "65636이 %u로 들어감", Param_Get(PARAM_AVOID_ARC_MS));
+    Uart(":set scan_step abc");
+    Uart(":set scan_step 20x");
+    Uart(":set scan_step -20");
+    CHECK(Param_Get(PARAM_SCAN_STEP) == 15, "숫자가 아닌 값이 들어감 (scan_step=%u)", Param_Get(PARAM_SCAN_STEP));
+
+    /* 떠돌던 ':' - 끊긴 뒤 'x'는 다시 한 글자 명령 (ISR에서 바로, 또는 Param_Poll이 먼저 버림) */
+    CHECK(Param_RxChar(':'), "':' 안 받음");
+    Param_RxChar('s');
+    Sim_Advance(2500000);
+    CHECK(!Param_RxChar('x'), "끊긴 줄이 'x'를 가로챔");
+    Param_RxChar(':');
+    Sim_Advance(2500000);
+    Param_Poll();
+    CHECK(!Param_RxChar('x'), "Param_Poll이 끊긴 줄을 안 버림");
+    Uart(":get scan_step");
+
+    RobotState_Init(test_states);
+    RobotState_Set(STATE_SCAN);
+    RobotState_Run(0);
+    Uart(":save");
+    Reboot();
+    CHECK(Param_Get(PARAM_SCAN_STEP) == step, "SCAN에서 저장됨");
+
+    Param_Set(PARAM_SCAN_STEP, 15);
+    RobotState_Set(STATE_IDLE);
+    RobotState_Run(0);
+    Uart(":save");
+    Reboot();
+    CHECK(Param_Get(PARAM_SCAN_STEP) == 15, "재부팅 뒤 scan_step=%u", Param_Get(PARAM_SCAN_STEP));
+
+    Uart(":defaults");
+    CHECK(Param_Get(PARAM_SCAN_STEP) == step, ":defaults");
+    Uart(":list");
+}
+
+/* ===== 2. 닳기 ===== */
+
+static void Test_Wear(void)
+{
+    uint32_t e0, e1;
+    int before = fails;
+
+    printf("=== wear (%d saves, 2 params changing)\n", WEAR_SAVES);
+    Sim_FlashReset();
+    Reboot();
+
+    for (int i = 0; i < WEAR_SAVES; i++)
+    {
+        CHECK(Param_Set(PARAM_SCAN_PERIOD_MS, (uint16_t)(40 + i % 100)) == PARAM_OK, "set");
+        CHECK(Param_Set(PARAM_CRUISE_SPEED, (uint16_t)(50 + i % 50)) == PARAM_OK, "set");
+        CHECK(Param_Save() == PARAM_OK, "save %d", i);
+        CHECK(FlashEE_Used() <= FLASH_EE_RECORDS, "records %u", FlashEE_Used());
+        if (fails != before) return;
+    }
+    Reboot();
+    CHECK(Param_Get(PARAM_SCAN_PERIOD_MS) == 40 + (WEAR_SAVES - 1) % 100, "마지막 값");
+
+    e0 = Sim_FlashErases(FLASH_EE_BASE);
+    e1 = Sim_FlashErases(FLASH_EE_BASE + FLASH_EE_PAGE_SIZE);
+    printf("  record writes %d, page erases %u + %u (1 erase / %u writes)\n",
+           2 * WEAR_SAVES, e0, e1, (unsigned)(2 * WEAR_SAVES / (e0 + e1 ? e0 + e1 : 1)));
+    CHECK(e0 + e1 > 0 && (e0 > e1 ? e0 - e1 : e1 - e0) <= 1, "페이지 지우기가 한쪽에 몰림");
+}
+
+/* ===== 3. 전원 끊김 ===== */
+
+static void Test_PowerCut(void)
+{
+    uint8_t snap[SIM_FLASH_SIZE];
+    uint16_t old[CUT_TAGS + 1];
+    int cuts = 0;
+
+    printf("=== power cut during page transfer\n");
+    Sim_FlashReset();
+    FlashEE_Init();
+
+    /* 페이지가 꽉 찰 때까지 채움 - 다음 쓰기가 옮기기를 부름 */
+    for (uint16_t v = 0; FlashEE_Used() < FLASH_EE_RECORDS; v++)
+        FlashEE_Write((uint16_t)(1 + v % CUT_TAGS), v);
+    for (uint16_t t = 1; t <= CUT_TAGS; t++)
+        FlashEE_Read(t, &old[t]);
+    memcpy(snap, Sim_FlashData(), sizeof(snap));
+
+    for (int32_t k = 0; ; k++)
+    {
+        FlashEE_Result_t r;
+
+        memcpy(Sim_FlashData(), snap, sizeof(snap));
+        FlashEE_Init();
+        Sim_FlashPowerCut(k);
+        r = FlashEE_Write(3, 0xBEEF);
+        Sim_FlashPowerCut(-1);
+
+        CHECK(FlashEE_Init() == FLASH_EE_OK, "cut %d: Init", k);
+        for (uint16_t t = 1; t <= CUT_TAGS; t++)
+        {
+            uint16_t v = 0;
+
+            CHECK(FlashEE_Read(t, &v) == FLASH_EE_OK, "cut %d: tag %u 없음", k, t);
+            if (t == 3)
+                CHECK(v == old[t] || v == 0xBEEF, "cut %d: tag 3 = 0x%04X", k, v);
+            else
+                CHECK(v == old[t], "cut %d: tag %u = %u (예전 %u)", k, t, v, old[t]);
+            if (r == FLASH_EE_OK && t == 3)
+                CHECK(v == 0xBEEF, "쓰기 성공인데 값이 없음");
+        }
+        if (r == FLASH_EE_OK) break;
+        cuts++;
+    }
+    printf("  %d cut points, all recovered\n", cuts);
+}
+
+int main(void)
+{
+    Sim_Reset();
+    Test_Commands();
+    Test_Wear();
+    Test_PowerCut();
+
+    printf("%s\n", fails ? "FAIL" : "OK");
+    return fails ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file radarbench.c
+ * @brief 레이더 화면 틱 예산 벤치마크
+ *
+ * main.c 스캔 주기(샘플 40ms)와 UI 틱(50ms)을 가상 시간으로 돌리면서:
+ *  1. 배경 그리기에 걸리는 틱 수
+ *  2. 스캔 중 틱당 최대 전송량 / 추정 시간 (예산 이하인지)
+ *  3. 매 틱 끝에 밀린 그리기가 없는지 (샘플 속도를 따라가는지)
+ * 를 확인. -o 파일을 주면 마지막 화면을 PPM으로 저장.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "drivers/radar.h"
+#include "robot_config.h"
+#include "lcd_sim.h"
+
+#define SAMPLE_MS   40      // main.c STATE_SCAN 간격
+#define TICK_MS     50      // main.c UI 틱
+#define SWEEPS      6
+
+static void write_ppm(const char *path)
+{
+    FILE *f = fopen(path, "wb");
+
+    if (!f) { perror(path); return; }
+    fprintf(f, "P6\n%d %d\n255\n", LCD_WIDTH, LCD_HEIGHT);
+    for (int y = 0; y < LCD_HEIGHT; y++)
+    {
+        for (int x = 0; x < LCD_WIDTH; x++)
+        {
+            uint16_t c = lcd_sim_fb[y][x];
+            uint8_t rgb[3] = {
+                (uint8_t)(((c >> 11) & 0x1F) << 3),
+                (uint8_t)(((c >> 5) & 0x3F) << 2),
+                (uint8_t)((c & 0x1F) << 3),
+            };
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    fclose(f);
+}
+
+/* 가짜 장애물: 왼쪽 벽 + 정면 기둥 */
+static uint16_t fake_dist(uint8_t angle, int sweep)
+{
+    if (angle >= 80 && angle <= 100) return 35 + sweep;
+    if (angle < 60) return 60;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    LcdSimCost_t cost = LcdSim_DefaultCost();
+    unsigned max_bytes = 0, bg_ticks = 0, ticks = 0, backlog = 0;
+    double max_us = 0;
+    uint8_t angle = SERVO_MIN_ANGLE;
+    int8_t dir = 1;
+    int sweep = 0, fail = 0;
+    unsigned next_sample = 0, next_tick = 0;
+
+    LcdSim_Reset();
+    Radar_Enter();
+
+    /* 배경 */
+    do {
+        bg_ticks++;
+    } while (!Radar_Update(RADAR_TICK_BUDGET) && bg_ticks < 1000);
+
+    /* 스캔: 가상 ms 단위 */
+    for (unsigned now = 0; sweep < SWEEPS; now++)
+    {
+        if (now == next_sample)
+        {
+            next_sample += SAMPLE_MS;
+            Radar_AddSample(angle, fake_dist(angle, sweep));
+
+            angle += dir * SERVO_STEP_ANGLE;
+            if (angle >= SERVO_MAX_ANGLE) { angle = SERVO_MAX_ANGLE; dir = -1; sweep++; }
+            else if (angle <= SERVO_MIN_ANGLE) { angle = SERVO_MIN_ANGLE; dir = 1; sweep++; }
+        }
+
+        if (now == next_tick)
+        {
+            LcdSimStats_t st;
+            double us;
+
+            next_tick += TICK_MS;
+            LcdSim_ResetStats();
+            if (!Radar_Update(RADAR_TICK_BUDGET)) backlog++;
+            st = LcdSim_Stats();
+            us = LcdSim_EstimateUs(&st, &cost);
+
+            if (st.spi_bytes > max_bytes) max_bytes = st.spi_bytes;
+            if (us > max_us) max_us = us;
+            ticks++;
+        }
+    }
+
+    printf("budget          : %u bytes/tick\n", RADAR_TICK_BUDGET);
+    printf("background      : %u ticks (%u ms)\n", bg_ticks, bg_ticks * TICK_MS);
+    printf("scan            : %d sweeps, %u ticks\n", SWEEPS, ticks);
+    printf("worst scan tick : %u bytes, %.0f us\n", max_bytes, max_us);
+    printf("ticks with backlog: %u\n", backlog);
+
+    if (max_bytes > RADAR_TICK_BUDGET || backlog)
+    {
+        printf("FAIL: radar does not keep up within the tick budget\n");
+        fail = 1;
+    }
+
+    if (argc == 3 && strcmp(argv[1], "-o") == 0)
+        write_ppm(argv[2]);
+
+    return fail;
+}
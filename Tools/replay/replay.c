@@ -0,0 +1,453 @@
+/**
+ * @file replay.c
+ * @brief 주행 기록(reclog) 다시 돌리기 - 펌웨어 상태 머신에 기록한 입력을 그대로 넣고 상태 전이를 비교 (호스트)
+ *
+ * 링크하는 펌웨어는 그대로: robot_behavior.c, robot_state.c, robot_command.c, param.c,
+ * motor.c / encoder.c / heading.c, servo.c, buzzer.c, radar.c (ultrasonic.c만 빼고 아래 대체).
+ *
+ * 입력 넣기 (기록한 HAL tick 기준, 가상 시계 - 실제 시간을 기다리지 않음):
+ *   RX     해당 ms에 main.c 수신 콜백처럼 Param_RxChar → RobotCommand_Handle
+ *   EDGE   해당 ms에 Encoder_OnEdge (EXTI 콜백)
+ *   DIST   Ultrasonic_GetDistance 대신 - 기록한 다음 값을 돌려주고, 기록 시각이 더 뒤면 시계를 거기까지
+ *   DIST_UI 화면용이라 값은 로직에 안 넣음 - 측정을 시작했을 시각 (기록 시각 - 거리로 계산한 측정 시간)이
+ *          되면 기록 시각까지 메인 루프를 멈춤 (main.c UI_Update의 블로킹 측정)
+ *   기록 시각은 ms 내림이라 "거기까지"는 그 ms의 가운데 (+0.5ms) - 측정 시작 추정이 ±0.5ms 안
+ *   STATE  넣지 않고 비교용 - 다시 돌린 상태 전이 순서가 기록과 같은지, 시각 차이는 얼마인지
+ * 시작 상태 / 파라미터 / start_flag는 기록 머리에서.
+ * 1ms마다 Motor_OnPeriod (TIM3), 메인 루프 한 바퀴 = Heading_Update + 화면용 측정 + Param_Poll
+ * + RobotState_Run + LOOP_US. 펌웨어 UART 출력은 world.c처럼 115200 블로킹 TX 시간만큼 시계를 흘림.
+ *
+ * 기록 파일: 이진 ('RL'로 시작, worldsim -r) 또는 UART 캡처 텍스트 ("REC <hex>" 줄만 골라 읽음 -
+ * 'l' 꺼내기 / 'o' 스트림 어느 쪽이든). 같은 기록이면 언제 돌려도 같은 결과.
+ * 상태 전이가 기록과 다르면 종료 코드 1.
+ *
+ * 사용법: replay [-d] [-v] 기록파일
+ *   -d  사건 목록 (tick, 종류, 값)
+ *   -v  펌웨어 UART 출력
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "reclog.h"
+#include "robot_behavior.h"
+#include "robot_command.h"
+#include "robot_state.h"
+#include "param.h"
+#include "drivers/buzzer.h"
+#include "drivers/encoder.h"
+#include "drivers/heading.h"
+#include "drivers/motor.h"
+#include "drivers/servo.h"
+#include "drivers/ultrasonic.h"
+#include "hal_sim.h"
+
+#define LOOP_US         200         // world.c와 같게
+#define UART_BYTE_US    87          // world.c와 같게 (115200 블로킹 TX)
+#define PING_FIXED_US   460         // TRIG 10us + 버스트 (TRIG 하강 → ECHO 상승)
+#define PING_NONE_US    30460       // 0 cm = ECHO 없음, 펌웨어 타임아웃 30ms
+#define TAIL_MS         100         // 마지막 사건 뒤 더 돌리는 시간
+#define LOG_MAX         (4U << 20)
+
+typedef struct {
+    uint32_t tick;
+    uint8_t  type;
+    uint16_t val;
+} Ev_t;
+
+typedef struct {
+    uint32_t tick;
+    uint8_t  state;
+} StateAt_t;
+
+static const char *type_name[] = { "DIST", "DIST_UI", "RX", "EDGE", "STATE", "LOST" };
+
+/* 기록 */
+static struct {
+    uint32_t start_tick;
+    uint8_t  state, flags;
+    uint16_t param[PARAM_COUNT];
+    uint8_t  n_param;
+} hdr;
+
+static Ev_t *ev;
+static uint32_t ev_n;
+static uint32_t lost_total;
+
+/* 다시 돌리기 */
+static uint32_t isr_i;              // 다음 RX / EDGE
+static uint32_t dist_i;             // 다음 DIST
+static uint32_t ui_i;               // 다음 DIST_UI
+static uint32_t last_ms;            // Motor_OnPeriod까지 한 ms
+static StateAt_t *got;
+static uint32_t got_n;
+static uint32_t dist_late_max;      // 펌웨어가 기록보다 늦게 잰 최대 ms
+static uint8_t  ran_out;
+
+static TIM_HandleTypeDef htim2_sim, htim3_sim, htim4_sim;
+
+/* ===== 읽기 ===== */
+
+static int Hex(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/**
+ * @brief 파일 → 이진 기록 (텍스트면 "REC <hex>" 줄만 이어 붙임)
+ */
+static uint8_t *Load(const char *path, uint32_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *raw, *out;
+    size_t n;
+
+    if (!f) { perror(path); return NULL; }
+    raw = malloc(LOG_MAX);
+    n = fread(raw, 1, LOG_MAX, f);
+    fclose(f);
+
+    if (n >= 2 && raw[0] == RECLOG_MAGIC0 && raw[1] == RECLOG_MAGIC1)
+    {
+        *len = (uint32_t)n;
+        return raw;
+    }
+
+    out = malloc(n / 2 + 1);
+    *len = 0;
+    for (size_t i = 0; i + 4 <= n; )
+    {
+        size_t eol = i;
+
+        while (eol < n && raw[eol] != '\n') eol++;
+        if (!memcmp(&raw[i], "REC ", 4))
+        {
+            for (size_t k = i + 4; k + 1 < eol && Hex(raw[k]) >= 0 && Hex(raw[k + 1]) >= 0; k += 2)
+                out[(*len)++] = (uint8_t)(Hex(raw[k]) << 4 | Hex(raw[k + 1]));
+        }
+        i = eol + 1;
+    }
+    free(raw);
+    return out;
+}
+
+static uint32_t Get_Varint(const uint8_t *p, uint32_t len, uint32_t *i)
+{
+    uint32_t v = 0;
+
+    for (uint8_t shift = 0; *i < len && shift < 35; shift += 7)
+    {
+        uint8_t b = p[(*i)++];
+
+        v |= (uint32_t)(b & 0x7FU) << shift;
+        if (!(b & 0x80U)) break;
+    }
+    return v;
+}
+
+static int Decode(const uint8_t *p, uint32_t len)
+{
+    uint32_t i = RECLOG_HDR_FIXED, tick;
+
+    if (len < RECLOG_HDR_FIXED || p[0] != RECLOG_MAGIC0 || p[1] != RECLOG_MAGIC1)
+    {
+        fprintf(stderr, "not a reclog (no 'RL' header)\n");
+        return 0;
+    }
+    if (p[2] != RECLOG_VERSION)
+    {
+        fprintf(stderr, "reclog version %u, replay knows %u\n", p[2], RECLOG_VERSION);
+        return 0;
+    }
+
+    hdr.n_param    = p[3];
+    hdr.start_tick = p[4] | p[5] << 8 | p[6] << 16 | (uint32_t)p[7] << 24;
+    hdr.state      = p[8];
+    hdr.flags      = p[9];
+    for (uint8_t k = 0; k < hdr.n_param && i + 1 < len; k++, i += 2)
+        if (k < PARAM_COUNT) hdr.param[k] = (uint16_t)(p[i] | p[i + 1] << 8);
+    if (hdr.n_param != PARAM_COUNT)
+        fprintf(stderr, "warning: log has %u params, firmware %u - layout changed?\n", hdr.n_param, PARAM_COUNT);
+
+    ev = calloc(len, sizeof(Ev_t));
+    tick = hdr.start_tick;
+    while (i < len)
+    {
+        uint8_t b = p[i++];
+        uint32_t dt = b & 0x1FU;
+        Ev_t *e = &ev[ev_n];
+
+        if (dt == 31U) dt = Get_Varint(p, len, &i);
+        tick += dt;
+        e->tick = tick;
+        e->type = b >> 5;
+
+        switch (e->type)
+        {
+        case RECLOG_DIST:
+        case RECLOG_DIST_UI: e->val = (uint16_t)Get_Varint(p, len, &i); break;
+        case RECLOG_RX:
+        case RECLOG_STATE:   e->val = (i < len) ? p[i++] : 0; break;
+        case RECLOG_LOST:    e->val = (uint16_t)Get_Varint(p, len, &i); lost_total += e->val; break;
+        case RECLOG_EDGE:    break;
+        default:
+            fprintf(stderr, "bad event type %u at byte %u\n", e->type, i - 1);
+            return 0;
+        }
+        ev_n++;
+    }
+    return 1;
+}
+
+/* ===== 펌웨어 대체 ===== */
+
+/* 사건이 일어난 가상 시각 - 기록 ms의 가운데 */
+static uint64_t Ev_Us(const Ev_t *e)
+{
+    return (uint64_t)e->tick * 1000U + 500U;
+}
+
+/* 측정 끝까지 1ms씩 - 그 사이 엔코더 에지가 제 ms에 들어가게 (한 번에 넘기면 한 시각에 몰려 속도가 틀어짐) */
+static void Advance_To(uint64_t us)
+{
+    while (Sim_NowUs() + 1000U < us)
+        Sim_Advance(1000U);
+    if (us > Sim_NowUs())
+        Sim_Advance(us - Sim_NowUs());
+}
+
+/* 기록한 다음 SCAN 거리 - 기록 시각이 더 뒤면 그때까지 시계를 돌림 (실제 측정 + 루프 지연) */
+uint16_t Ultrasonic_GetDistance(void)
+{
+    uint32_t now;
+
+    while (dist_i < ev_n && ev[dist_i].type != RECLOG_DIST) dist_i++;
+    if (dist_i >= ev_n)
+    {
+        ran_out = 1;
+        return 0;
+    }
+
+    now = HAL_GetTick();
+    if (ev[dist_i].tick > now)
+        Advance_To(Ev_Us(&ev[dist_i]));
+    else if (now - ev[dist_i].tick > dist_late_max)
+        dist_late_max = now - ev[dist_i].tick;
+
+    return ev[dist_i++].val;
+}
+
+void Ultrasonic_Init(void)
+{
+}
+
+/* main.c UI_Update 처음의 화면용 측정 - 시작했을 시각이 되면 기록한 DIST_UI 시각까지 메인 루프가 멈춤 */
+static void Ui_Ping(void)
+{
+    uint64_t end_us, ping_us;
+
+    while (ui_i < ev_n && ev[ui_i].type != RECLOG_DIST_UI) ui_i++;
+    if (ui_i >= ev_n)
+        return;
+
+    /* 왕복 시간은 펌웨어 변환(us x 17 / 1000 = cm)의 역 - 그 cm 구간 가운데 */
+    end_us  = Ev_Us(&ev[ui_i]);
+    ping_us = ev[ui_i].val ? PING_FIXED_US + (ev[ui_i].val * 1000U + 500U) / 17U : PING_NONE_US;
+    if (Sim_NowUs() + ping_us < end_us)
+        return;
+
+    Advance_To(end_us);
+    ui_i++;
+}
+
+/* 1ms마다 TIM3 + 그 ms까지의 ISR 사건 */
+static void Replay_Hook(uint64_t now_us)
+{
+    uint32_t now = (uint32_t)(now_us / 1000U);
+
+    while (last_ms < now)
+    {
+        last_ms++;
+        Motor_OnPeriod();
+
+        for (; isr_i < ev_n && ev[isr_i].tick <= last_ms; isr_i++)
+        {
+            if (ev[isr_i].type == RECLOG_RX)
+            {
+                if (!Param_RxChar((uint8_t)ev[isr_i].val))
+                    RobotCommand_Handle((uint8_t)ev[isr_i].val);
+            }
+            else if (ev[isr_i].type == RECLOG_EDGE)
+            {
+                Encoder_OnEdge();
+            }
+        }
+    }
+}
+
+static void On_StateChange(RobotState_t s)
+{
+    got[got_n].tick  = HAL_GetTick();
+    got[got_n].state = (uint8_t)s;
+    got_n++;
+}
+
+/* ===== 다시 돌리기 ===== */
+
+static void Run(void)
+{
+    uint32_t end_ms = ev_n ? ev[ev_n - 1].tick + TAIL_MS : hdr.start_tick;
+
+    got = calloc(ev_n + 16, sizeof(StateAt_t));
+
+    Sim_Reset();
+    Sim_Advance((uint64_t)hdr.start_tick * 1000U);
+    last_ms = hdr.start_tick;
+    Sim_FlashReset();
+
+    /* main.c 초기화 순서 (world.c와 같게) */
+    Param_Init();
+    Motor_Init(&htim3_sim);
+    Encoder_Init();
+    Heading_Init();
+    Servo_Init(&htim2_sim, TIM_CHANNEL_1);
+    Buzzer_Init(&htim4_sim);
+    Behavior_Init();
+
+    /* 기록 시작 때 상태 - 관계 검사 때문에 몇 바퀴 */
+    for (int pass = 0; pass < PARAM_COUNT; pass++)
+        for (uint8_t k = 0; k < PARAM_COUNT && k < hdr.n_param; k++)
+            Param_Set((ParamId_t)k, hdr.param[k]);
+    start_flag  = hdr.flags & 1U;
+    manual_mode = (hdr.flags >> 1) & 1U;
+    if (hdr.state != STATE_IDLE)
+    {
+        RobotState_Set((RobotState_t)hdr.state);   // 진입 동작부터 다시 (기록이 IDLE 밖에서 시작)
+        RobotState_Run(0);
+    }
+
+    RobotState_SetListener(On_StateChange);
+    Sim_SetHook(Replay_Hook);
+    Sim_UartTxCost(UART_BYTE_US);
+
+    while (HAL_GetTick() < end_ms && !ran_out)
+    {
+        Heading_Update();
+        Ui_Ping();
+        Param_Poll();
+        RobotState_Run(start_flag);
+        Sim_Advance(LOOP_US);
+    }
+    Sim_SetHook(NULL);
+    Sim_UartTxCost(0);
+}
+
+/**
+ * @brief 기록 STATE vs 다시 돌린 전이 - 순서가 어긋난 첫 자리, 시각 차이
+ */
+static int Compare(void)
+{
+    uint32_t n = 0, skew_max = 0, i;
+    double skew_sum = 0;
+
+    for (i = 0; i < ev_n; i++)
+    {
+        uint32_t d;
+
+        if (ev[i].type != RECLOG_STATE) continue;
+        if (n >= got_n)
+        {
+            printf("DIVERGE #%u: log t=%u %s, replay ended (%u transitions)\n", n, ev[i].tick,
+                   RobotState_Name(ev[i].val), got_n);
+            return 0;
+        }
+        if (got[n].state != ev[i].val)
+        {
+            printf("DIVERGE #%u: log t=%u %s, replay t=%u %s\n", n, ev[i].tick, RobotState_Name(ev[i].val),
+                   got[n].tick, RobotState_Name(got[n].state));
+            return 0;
+        }
+        d = (got[n].tick > ev[i].tick) ? got[n].tick - ev[i].tick : ev[i].tick - got[n].tick;
+        if (d > skew_max) skew_max = d;
+        skew_sum += d;
+        n++;
+    }
+
+    printf("state transitions: %u match", n);
+    if (got_n > n) printf(" (+%u after the log ends)", got_n - n);
+    printf(", tick skew avg %.2f max %u ms, late DIST max %u ms\n", n ? skew_sum / n : 0.0, skew_max,
+           dist_late_max);
+    return 1;
+}
+
+static void Print_Events(void)
+{
+    for (uint32_t i = 0; i < ev_n; i++)
+    {
+        printf("%10u %-7s", ev[i].tick, type_name[ev[i].type]);
+        if (ev[i].type == RECLOG_STATE)   printf(" %s", RobotState_Name(ev[i].val));
+        else if (ev[i].type == RECLOG_RX) printf(" '%c'", (ev[i].val >= 0x20 && ev[i].val < 0x7F) ? ev[i].val : '?');
+        else if (ev[i].type != RECLOG_EDGE) printf(" %u", ev[i].val);
+        printf("\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    int list = 0, verbose = 0, ok;
+    uint32_t len, count[RECLOG_LOST + 1] = { 0 };
+    uint8_t *log;
+    clock_t t0;
+    double wall, span;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if      (!strcmp(argv[i], "-d")) list = 1;
+        else if (!strcmp(argv[i], "-v")) verbose = 1;
+        else if (argv[i][0] != '-' && !path) path = argv[i];
+        else path = NULL, i = argc;
+    }
+    if (!path)
+    {
+        fprintf(stderr, "usage: replay [-d] [-v] log (binary or UART capture with REC lines)\n");
+        return 2;
+    }
+
+    log = Load(path, &len);
+    if (!log || !Decode(log, len))
+        return 2;
+
+    /* 상태 이름은 Behavior_Init(표 등록) 뒤에 */
+    Sim_UartEcho((uint8_t)verbose);
+    t0 = clock();
+    Run();
+    wall = (double)(clock() - t0) / CLOCKS_PER_SEC;
+    Sim_UartEcho(1);
+
+    for (uint32_t i = 0; i < ev_n; i++) count[ev[i].type]++;
+    span = ev_n ? (ev[ev_n - 1].tick - hdr.start_tick) / 1000.0 : 0;
+    printf("log %u bytes, %.1f s from tick %u, start %s%s: dist %u (+%u ui), rx %u, edge %u, state %u\n",
+           len, span, hdr.start_tick, RobotState_Name(hdr.state), (hdr.flags & 1U) ? " auto" : "",
+           count[RECLOG_DIST], count[RECLOG_DIST_UI], count[RECLOG_RX], count[RECLOG_EDGE],
+           count[RECLOG_STATE]);
+    if (lost_total)
+        printf("warning: %u events lost while recording - replay may diverge after the gap\n", lost_total);
+    if (list)
+        Print_Events();
+
+    printf("replayed %.1f s in %.3f s (x%.0f)%s\n", span, wall, wall > 0 ? span / wall : 0,
+           ran_out ? ", until the recorded distances ran out" : "");
+    for (uint8_t s = 0; s < STATE_COUNT; s++)
+        if (RobotState_Entries(s))
+            printf("  %-7s %8u ms  x%u\n", RobotState_Name(s), RobotState_TimeInMs(s), RobotState_Entries(s));
+
+    ok = Compare();
+    printf("%s\n", ok ? "OK" : "FAIL");
+    return ok ? 0 : 1;
+}
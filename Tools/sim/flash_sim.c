@@ -0,0 +1,128 @@
+/**
+ * @file flash_sim.c
+ * @brief 호스트 빌드용 내장 플래시 - 펌웨어 주소(SIM_FLASH_BASE)에 RAM을 그대로 매핑
+ *
+ * flash_ee.c는 주소를 uint32_t로 다루고 포인터로 바로 읽으므로, 같은 주소에 mmap해서
+ * 펌웨어 코드를 고치지 않고 돌림. 규칙은 F1 플래시와 같게:
+ *   - 잠금 해제 전 프로그램 / 지우기는 실패
+ *   - 하프워드 단위, 0xFFFF가 아닌 자리에는 0x0000만 쓸 수 있음 (그 밖은 PGERR)
+ *   - 지우기는 1KB 페이지 단위
+ * Sim_FlashPowerCut(n): n번째 동작 뒤부터 모두 실패 - 전원이 나간 것처럼 (그 뒤 Init로 재부팅).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "stm32f1xx_hal.h"
+#include "hal_sim.h"
+
+#define PAGE_SIZE_SIM   0x400UL
+#define PAGES           (SIM_FLASH_SIZE / PAGE_SIZE_SIM)
+#define MAP_BASE        (SIM_FLASH_BASE & ~0xFFFUL)
+#define MAP_SIZE        (((SIM_FLASH_BASE + SIM_FLASH_SIZE - MAP_BASE) + 0xFFFUL) & ~0xFFFUL)
+
+static uint8_t *mem;
+static uint8_t  unlocked;
+static int32_t  ops_left = -1;
+static uint32_t page_erases[PAGES];
+
+static uint8_t In_Flash(uint32_t addr, uint32_t len)
+{
+    return addr >= SIM_FLASH_BASE && addr + len <= SIM_FLASH_BASE + SIM_FLASH_SIZE;
+}
+
+/* 전원이 남아 있으면 1 (하나 씀) */
+static uint8_t Power(void)
+{
+    if (ops_left == 0) return 0;
+    if (ops_left > 0) ops_left--;
+    return 1;
+}
+
+void Sim_FlashReset(void)
+{
+    if (!mem)
+    {
+        void *p = mmap((void *)MAP_BASE, MAP_SIZE, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (p != (void *)MAP_BASE)
+        {
+            fprintf(stderr, "flash_sim: 0x%08lX에 매핑할 수 없음\n", MAP_BASE);
+            exit(2);
+        }
+        mem = (uint8_t *)(uintptr_t)SIM_FLASH_BASE;
+    }
+    memset(mem, 0xFF, SIM_FLASH_SIZE);
+    memset(page_erases, 0, sizeof(page_erases));
+    unlocked = 0;
+    ops_left = -1;
+}
+
+uint8_t *Sim_FlashData(void)
+{
+    return mem;
+}
+
+void Sim_FlashPowerCut(int32_t ops)
+{
+    ops_left = ops;
+}
+
+uint32_t Sim_FlashErases(uint32_t page_addr)
+{
+    return In_Flash(page_addr, 1) ? page_erases[(page_addr - SIM_FLASH_BASE) / PAGE_SIZE_SIM] : 0;
+}
+
+/* ===== HAL ===== */
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+    unlocked = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Lock(void)
+{
+    unlocked = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data)
+{
+    uint16_t *hw = (uint16_t *)(uintptr_t)Address;
+
+    if (!mem || !unlocked || TypeProgram != FLASH_TYPEPROGRAM_HALFWORD ||
+        (Address & 1U) || !In_Flash(Address, 2))
+        return HAL_ERROR;
+    if (*hw != 0xFFFFU && (uint16_t)Data != 0x0000U)
+        return HAL_ERROR;
+    if (!Power())
+        return HAL_ERROR;
+
+    *hw = (uint16_t)Data;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError)
+{
+    *PageError = 0xFFFFFFFFU;
+    if (!mem || !unlocked || pEraseInit->TypeErase != FLASH_TYPEERASE_PAGES)
+        return HAL_ERROR;
+
+    for (uint32_t i = 0; i < pEraseInit->NbPages; i++)
+    {
+        uint32_t page = pEraseInit->PageAddress + i * PAGE_SIZE_SIM;
+
+        if ((page % PAGE_SIZE_SIM) || !In_Flash(page, PAGE_SIZE_SIM) || !Power())
+        {
+            *PageError = page;
+            return HAL_ERROR;
+        }
+        memset((void *)(uintptr_t)page, 0xFF, PAGE_SIZE_SIM);
+        page_erases[(page - SIM_FLASH_BASE) / PAGE_SIZE_SIM]++;
+    }
+    return HAL_OK;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file stm32f1xx_hal.h
+ * @brief 호스트 빌드용 HAL 대체 헤더 (Tools 전용)
+ *
+ * 펌웨어 소스를 PC에서 그대로 컴파일하기 위해 실제 HAL 대신 include 경로
+ * 맨 앞에 놓이는 최소 정의. 펌웨어가 쓰는 타입/매크로/함수만 흉내냄.
+ * 구현은 sim/hal_sim.c.
+ */
+
+#ifndef __STM32F1xx_HAL_H
+#define __STM32F1xx_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* ===== 공통 타입 ===== */
+typedef enum {
+    HAL_OK      = 0x00U,
+    HAL_ERROR   = 0x01U,
+    HAL_BUSY    = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+#define HAL_MAX_DELAY   0xFFFFFFFFU
+
+/* ===== GPIO ===== */
+typedef struct {
+    volatile uint32_t CRL;
+    volatile uint32_t CRH;
+    volatile uint32_t IDR;
+    volatile uint32_t ODR;
+    volatile uint32_t BSRR;
+    volatile uint32_t BRR;
+    volatile uint32_t LCKR;
+} GPIO_TypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+extern GPIO_TypeDef sim_gpio[4];
+#define GPIOA   (&sim_gpio[0])
+#define GPIOB   (&sim_gpio[1])
+#define GPIOC   (&sim_gpio[2])
+#define GPIOD   (&sim_gpio[3])
+
+#define GPIO_PIN_0      ((uint16_t)0x0001)
+#define GPIO_PIN_1      ((uint16_t)0x0002)
+#define GPIO_PIN_2      ((uint16_t)0x0004)
+#define GPIO_PIN_3      ((uint16_t)0x0008)
+#define GPIO_PIN_4      ((uint16_t)0x0010)
+#define GPIO_PIN_5      ((uint16_t)0x0020)
+#define GPIO_PIN_6      ((uint16_t)0x0040)
+#define GPIO_PIN_7      ((uint16_t)0x0080)
+#define GPIO_PIN_8      ((uint16_t)0x0100)
+#define GPIO_PIN_9      ((uint16_t)0x0200)
+#define GPIO_PIN_10     ((uint16_t)0x0400)
+#define GPIO_PIN_11     ((uint16_t)0x0800)
+#define GPIO_PIN_12     ((uint16_t)0x1000)
+#define GPIO_PIN_13     ((uint16_t)0x2000)
+#define GPIO_PIN_14     ((uint16_t)0x4000)
+#define GPIO_PIN_15     ((uint16_t)0x8000)
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin);
+
+/* ===== TIM (레지스터 대신 핸들에 값만 보관) ===== */
+typedef struct {
+    void *Instance;
+    uint32_t ccr[4];
+    uint32_t arr;
+    uint32_t cnt;
+    uint8_t  running;
+} TIM_HandleTypeDef;
+
+#define TIM_CHANNEL_1   0x00000000U
+#define TIM_CHANNEL_2   0x00000004U
+#define TIM_CHANNEL_3   0x00000008U
+#define TIM_CHANNEL_4   0x0000000CU
+
+#define TIM_FLAG_UPDATE 0x0001U
+#define TIM_FLAG_CC1    0x0002U
+#define TIM_FLAG_CC2    0x0004U
+#define TIM_FLAG_CC3    0x0008U
+#define TIM_IT_UPDATE   TIM_FLAG_UPDATE
+#define TIM_IT_CC1      TIM_FLAG_CC1
+#define TIM_IT_CC2      TIM_FLAG_CC2
+#define TIM_IT_CC3      TIM_FLAG_CC3
+
+#define __HAL_TIM_SET_COMPARE(h, ch, v)     ((h)->ccr[(ch) >> 2] = (v))
+#define __HAL_TIM_GET_COMPARE(h, ch)        ((h)->ccr[(ch) >> 2])
+#define __HAL_TIM_SET_AUTORELOAD(h, v)      ((h)->arr = (v))
+#define __HAL_TIM_SET_COUNTER(h, v)         ((h)->cnt = (v))
+#define __HAL_TIM_GET_COUNTER(h)            ((h)->cnt)
+#define __HAL_TIM_CLEAR_FLAG(h, f)          ((void)(h))
+#define __HAL_TIM_ENABLE_IT(h, f)           ((void)(h))
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
+
+/* ===== FLASH (sim/flash_sim.c - 실제 주소에 RAM 매핑, NOR 규칙) ===== */
+#define FLASH_TYPEPROGRAM_HALFWORD  0x01U
+#define FLASH_TYPEERASE_PAGES       0x00U
+
+typedef struct {
+    uint32_t TypeErase;
+    uint32_t Banks;
+    uint32_t PageAddress;
+    uint32_t NbPages;
+} FLASH_EraseInitTypeDef;
+
+HAL_StatusTypeDef HAL_FLASH_Unlock(void);
+HAL_StatusTypeDef HAL_FLASH_Lock(void);
+HAL_StatusTypeDef HAL_FLASH_Program(uint32_t TypeProgram, uint32_t Address, uint64_t Data);
+HAL_StatusTypeDef HAL_FLASHEx_Erase(FLASH_EraseInitTypeDef *pEraseInit, uint32_t *PageError);
+
+/* ===== 인터럽트 (호스트는 단일 스레드 - ISR은 도구가 직접 호출) ===== */
+static inline uint32_t __get_PRIMASK(void)          { return 0; }
+static inline void     __set_PRIMASK(uint32_t m)    { (void)m; }
+static inline void     __disable_irq(void)          { }
+
+/* ===== 시간 ===== */
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+#endif /* __STM32F1xx_HAL_H */
@@ -0,0 +1,152 @@
+/**
+ * @file hal_sim.c
+ * @brief 호스트 빌드용 HAL 대체 구현
+ *
+ * 시간은 실제 시계가 아닌 가상 시계(sim_now_us)로 진행.
+ * 도구 쪽에서 Sim_Advance()로 시간을 흘려보냄.
+ */
+
+#include <stdio.h>
+
+#include "stm32f1xx_hal.h"
+#include "hal_sim.h"
+
+GPIO_TypeDef sim_gpio[4];
+
+static uint64_t sim_now_us = 0;
+static Sim_Hook_t hook;
+static uint8_t in_hook;
+static uint8_t uart_echo = 1;
+static Sim_UartSink_t uart_sink;
+static uint32_t uart_byte_us;
+
+/* ===== 가상 시계 ===== */
+
+void Sim_Reset(void)
+{
+    sim_now_us = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        GPIO_TypeDef zero = {0};
+        sim_gpio[i] = zero;
+    }
+}
+
+void Sim_Advance(uint64_t us)
+{
+    sim_now_us += us;
+    if (hook && !in_hook)
+    {
+        in_hook = 1;
+        hook(sim_now_us);
+        in_hook = 0;
+    }
+}
+
+void Sim_SetHook(Sim_Hook_t fn)
+{
+    hook = fn;
+}
+
+uint8_t Sim_InHook(void)
+{
+    return in_hook;
+}
+
+void Sim_UartEcho(uint8_t on)
+{
+    uart_echo = on;
+}
+
+void Sim_UartSink(Sim_UartSink_t fn)
+{
+    uart_sink = fn;
+}
+
+void Sim_UartTxCost(uint32_t us)
+{
+    uart_byte_us = us;
+}
+
+uint64_t Sim_NowUs(void)
+{
+    return sim_now_us;
+}
+
+/**
+ * @brief 펌웨어가 BSRR에 직접 쓴 값을 ODR에 반영 (실제 칩은 쓰는 순간 반영)
+ * @note  다음 BSRR 쓰기 전에 호출해야 함 - 같은 포트에 두 번 쓰면 앞의 값은 사라짐
+ */
+void Sim_GpioLatch(void)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        uint32_t bsrr = sim_gpio[i].BSRR;
+
+        sim_gpio[i].ODR = (sim_gpio[i].ODR & ~(bsrr >> 16)) | (bsrr & 0xFFFFU);
+        sim_gpio[i].BSRR = 0;
+    }
+}
+
+/* ===== HAL ===== */
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)(sim_now_us / 1000);
+}
+
+void HAL_Delay(uint32_t Delay)
+{
+    Sim_Advance((uint64_t)Delay * 1000);
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+    htim->running = 1;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+    htim->running = 0;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel)
+{
+    (void)Channel;
+    htim->running = 1;
+    return HAL_OK;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState != GPIO_PIN_RESET)
+        GPIOx->ODR |= GPIO_Pin;
+    else
+        GPIOx->ODR &= ~(uint32_t)GPIO_Pin;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    return (GPIOx->IDR & GPIO_Pin) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+    GPIOx->ODR ^= GPIO_Pin;
+}
+
+/* fmt.c 출력 (펌웨어는 main.c에서 UART로 - '\n' 앞에 '\r' 하나 더, 블로킹) */
+int __io_putchar(int ch)
+{
+    if (uart_byte_us)
+        Sim_Advance((uint64_t)uart_byte_us * (ch == '\n' ? 2U : 1U));
+
+    if (uart_sink)
+    {
+        uart_sink((uint8_t)ch);
+        return ch;
+    }
+    return uart_echo ? putchar(ch) : ch;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file hal_sim.h
+ * @brief 호스트 시뮬레이션 제어 API (가상 시계)
+ */
+
+#ifndef __HAL_SIM_H
+#define __HAL_SIM_H
+
+#include <stdint.h>
+
+void     Sim_Reset(void);
+void     Sim_Advance(uint64_t us);
+uint64_t Sim_NowUs(void);
+void     Sim_GpioLatch(void);       // BSRR에 쓴 값을 ODR에 반영
+
+/* 시간이 흐를 때마다 부르는 함수 (외부 세계 모델) - 안에서 다시 Sim_Advance해도 다시 불리지 않음 */
+typedef void (*Sim_Hook_t)(uint64_t now_us);
+void     Sim_SetHook(Sim_Hook_t fn);
+uint8_t  Sim_InHook(void);
+void     Sim_UartEcho(uint8_t on);  // __io_putchar 출력 (기본 켜짐)
+typedef void (*Sim_UartSink_t)(uint8_t c);
+void     Sim_UartSink(Sim_UartSink_t fn);   // __io_putchar 바이트를 stdout 대신 (NULL = stdout)
+void     Sim_UartTxCost(uint32_t us);       // __io_putchar 한 바이트마다 us만큼 시간이 흐름 (블로킹 TX, 기본 0)
+
+/* timebase_sim.c - Timebase_Us 한 번 읽을 때마다 us만큼 시간이 흐름 (바쁜 대기 루프가 끝나도록, 기본 0) */
+void     Sim_TimebaseReadCost(uint32_t us);
+
+/* 플래시 (sim/flash_sim.c) - SIM_FLASH_BASE부터 SIM_FLASH_SIZE만 있음 */
+#define SIM_FLASH_BASE      0x0801F800UL
+#define SIM_FLASH_SIZE      0x800UL
+
+void     Sim_FlashReset(void);                  // 전부 0xFF, 카운터 0
+uint8_t *Sim_FlashData(void);                   // 스냅샷 / 복원용
+void     Sim_FlashPowerCut(int32_t ops);        // ops번 프로그램/지우기 뒤 전원 끊김 (-1 = 끄기)
+uint32_t Sim_FlashErases(uint32_t page_addr);   // 페이지별 지우기 횟수
+
+#endif /* __HAL_SIM_H */
@@ -0,0 +1,152 @@
+/**
+ * @file lcd_sim.c
+ * @brief ST7735 패널 모델 - lcd_st7735.c와 같은 API, 같은 전송 패턴
+ *
+ * 통계는 lcd_st7735.c의 트랜잭션 구조를 그대로 따름:
+ *  - SetWindow: 명령 3회 + 4바이트 데이터 2회 = 5 호출 / 11 바이트
+ *  - WriteColorFast: tx_buf(128B) 채우기 1회 + 64픽셀 단위 전송
+ *  - Stream: 픽셀마다 2바이트 채우기, 128B 찰 때마다 전송
+ */
+
+#include <string.h>
+#include "lcd_sim.h"
+
+#define TX_BUF_SIZE 128
+
+uint16_t lcd_sim_fb[LCD_HEIGHT][LCD_WIDTH];
+
+static LcdSimStats_t stats;
+
+/* 현재 윈도우와 쓰기 위치 */
+static uint16_t win_x0, win_y0, win_x1, win_y1;
+static uint16_t cur_x, cur_y;
+static uint32_t stream_len;
+
+static void spi(uint32_t bytes)
+{
+    stats.spi_calls++;
+    stats.spi_bytes += bytes;
+}
+
+static void put_pixels(uint16_t color, uint32_t count)
+{
+    stats.pixels += count;
+
+    while (count--)
+    {
+        if (cur_x < LCD_WIDTH && cur_y < LCD_HEIGHT)
+            lcd_sim_fb[cur_y][cur_x] = color;
+
+        if (++cur_x > win_x1)
+        {
+            cur_x = win_x0;
+            if (++cur_y > win_y1)
+                cur_y = win_y0;
+        }
+    }
+}
+
+/* ===== lcd_st7735.h API ===== */
+
+void LCD_Init(void)
+{
+    LcdSim_Reset();
+}
+
+void LCD_SetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+    stats.windows++;
+    spi(1); spi(4);     // CASET
+    spi(1); spi(4);     // RASET
+    spi(1);             // RAMWR
+
+    win_x0 = x0; win_y0 = y0;
+    win_x1 = x1; win_y1 = y1;
+    cur_x = x0;  cur_y = y0;
+}
+
+void LCD_WriteColorFast(uint16_t color, uint32_t count)
+{
+    uint32_t pixels_per_buf = TX_BUF_SIZE / 2;
+
+    stats.fill_bytes += TX_BUF_SIZE;
+    stats.spi_calls  += count / pixels_per_buf + ((count % pixels_per_buf) ? 1 : 0);
+    stats.spi_bytes  += count * 2;
+
+    put_pixels(color, count);
+}
+
+void LCD_WriteBuffer(uint16_t *buf, uint32_t count)
+{
+    stats.fill_bytes += count * 2;
+    stats.spi_calls  += (count + TX_BUF_SIZE / 2 - 1) / (TX_BUF_SIZE / 2);
+    stats.spi_bytes  += count * 2;
+
+    while (count--)
+        put_pixels(*buf++, 1);
+}
+
+void LCD_StreamBegin(void)
+{
+    stream_len = 0;
+}
+
+void LCD_StreamColor(uint16_t color, uint32_t count)
+{
+    stats.fill_bytes += count * 2;
+    stream_len += count * 2;
+
+    while (stream_len >= TX_BUF_SIZE)
+    {
+        spi(TX_BUF_SIZE);
+        stream_len -= TX_BUF_SIZE;
+    }
+
+    put_pixels(color, count);
+}
+
+void LCD_StreamEnd(void)
+{
+    if (stream_len > 0)
+        spi(stream_len);
+    stream_len = 0;
+}
+
+void LCD_Clear(uint16_t color)
+{
+    LCD_SetWindow(0, 0, LCD_WIDTH - 1, LCD_HEIGHT - 1);
+    LCD_WriteColorFast(color, (uint32_t)LCD_WIDTH * LCD_HEIGHT);
+}
+
+/* ===== 시뮬레이션 API ===== */
+
+void LcdSim_ResetStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+void LcdSim_Reset(void)
+{
+    memset(lcd_sim_fb, 0, sizeof(lcd_sim_fb));
+    LcdSim_ResetStats();
+    stream_len = 0;
+}
+
+LcdSimStats_t LcdSim_Stats(void)
+{
+    return stats;
+}
+
+LcdSimCost_t LcdSim_DefaultCost(void)
+{
+    /* 64MHz, -O0 HAL 기준 대략값. 보드에서 측정되면 갱신할 것 */
+    LcdSimCost_t c = { 1.0, 4.0, 0.10 };
+    return c;
+}
+
+double LcdSim_EstimateUs(const LcdSimStats_t *st, const LcdSimCost_t *cost)
+{
+    return st->spi_bytes  * cost->byte_us +
+           st->spi_calls  * cost->call_us +
+           st->fill_bytes * cost->fill_us;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file lcd_sim.h
+ * @brief ST7735 패널 모델 (호스트용 lcd_st7735.c 대체)
+ *
+ * lcd_st7735.h API를 프레임버퍼에 그리고, 실제 드라이버가 만들었을
+ * SPI 트랜잭션 수/바이트 수를 같은 방식으로 집계함.
+ */
+
+#ifndef __LCD_SIM_H
+#define __LCD_SIM_H
+
+#include <stdint.h>
+#include "drivers/lcd_st7735.h"
+
+typedef struct {
+    uint32_t windows;       // LCD_SetWindow 호출 수
+    uint32_t spi_calls;     // HAL_SPI_Transmit 호출 수
+    uint32_t spi_bytes;     // SPI 전송 바이트 (명령 + 데이터)
+    uint32_t fill_bytes;    // CPU가 tx_buf에 채운 바이트
+    uint32_t pixels;        // 패널에 쓴 픽셀 수
+} LcdSimStats_t;
+
+/* 소요 시간 추정 파라미터 (µs) */
+typedef struct {
+    double byte_us;         // SPI 1바이트 (SPI2 = 32MHz / 4 = 8Mbit/s → 1µs)
+    double call_us;         // HAL_SPI_Transmit 1회 고정 오버헤드
+    double fill_us;         // tx_buf 1바이트 채우기
+} LcdSimCost_t;
+
+extern uint16_t lcd_sim_fb[LCD_HEIGHT][LCD_WIDTH];
+
+void          LcdSim_Reset(void);           // 프레임버퍼 검정 + 통계 초기화
+void          LcdSim_ResetStats(void);
+LcdSimStats_t LcdSim_Stats(void);
+double        LcdSim_EstimateUs(const LcdSimStats_t *st, const LcdSimCost_t *cost);
+LcdSimCost_t  LcdSim_DefaultCost(void);
+
+#endif /* __LCD_SIM_H */
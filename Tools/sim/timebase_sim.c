@@ -0,0 +1,53 @@
+/**
+ * @file timebase_sim.c
+ * @brief 호스트 빌드용 Timebase - 가상 시계(Sim_NowUs)를 그대로 돌려줌
+ *
+ * timebase.c는 TIM1 카운터 + 오버플로 인터럽트가 필요해서 호스트에서는 이 파일로 대체.
+ */
+
+#include "drivers/timebase.h"
+#include "hal_sim.h"
+
+void Timebase_Init(TIM_HandleTypeDef *htim)
+{
+    (void)htim;
+}
+
+void Timebase_OnOverflow(void)
+{
+}
+
+static uint32_t read_cost_us;
+
+void Sim_TimebaseReadCost(uint32_t us)
+{
+    read_cost_us = us;
+}
+
+/* 세계 모델(Sim_Hook) 안에서 부르는 ISR은 시간을 흘리지 않음 */
+uint32_t Timebase_Us(void)
+{
+    if (read_cost_us && !Sim_InHook())
+        Sim_Advance(read_cost_us);
+    return (uint32_t)Sim_NowUs();
+}
+
+uint32_t Timebase_Elapsed(uint32_t since_us)
+{
+    return Timebase_Us() - since_us;
+}
+
+void Timebase_DelayUs(uint32_t us)
+{
+    Sim_Advance(us + 1);
+}
+
+uint32_t Timebase_Deadline(uint32_t after_us)
+{
+    return Timebase_Us() + after_us;
+}
+
+uint8_t Timebase_Expired(uint32_t deadline_us)
+{
+    return (int32_t)(Timebase_Us() - deadline_us) >= 0;
+}
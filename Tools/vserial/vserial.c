@@ -0,0 +1,386 @@
+/**
+ * @file vserial.c
+ * @brief 가상 STM32 시리얼 장치 - world.c 방 안 펌웨어를 실시간으로 돌리고 USART2를 pty로 (호스트, Linux)
+ *
+ * 1team-Server가 블루투스 COM 포트 대신 그대로 연결:
+ *   build/vserial -b 9600 -l /tmp/ttyIAMR
+ *   node server.js --port /tmp/ttyIAMR --baud 9600
+ * 로봇 없이 한 PC에서 명령 → 텔레메트리 지연, 줄 속도, 링크 사용률을 잼.
+ *
+ * 링크 모델 (8N1 = 바이트당 10비트, -b 0 = 속도 제한 없음):
+ *   TX  main.c __io_putchar = HAL_UART_Transmit 블로킹 ('\n' 앞에 '\r' 하나 더) →
+ *       바이트마다 펌웨어 시간이 바이트 시간만큼 멈춤. 9600이면 STATE 한 줄(약 40자)에 약 40ms.
+ *       pty에는 그 바이트의 가상 시각이 되었을 때 씀.
+ *   RX  pty에서 읽은 바이트는 앞 바이트 뒤로 바이트 시간씩 늦게 도착 →
+ *       도착 시각에 수신 콜백 경로 (World_Rx, ISR처럼 세계 모델 훅 안에서)
+ * 가상 시계는 벽시계 x 배속(-x)을 따라감. 못 따라가면 (PC가 느림) 끝에 밀린 시간 표시.
+ *
+ * 지연 = pty에서 명령 바이트를 읽은 시각 → 그 뒤 첫 응답 줄의 마지막 바이트가 나간 시각 (가상 시계),
+ * 링크 입출력 시간 + 펌웨어 처리 + 블로킹 TX가 모두 들어감. 서버 / 브라우저 쪽은 빠짐.
+ * pty 반대쪽이 닫혀 있는 동안 TX는 버림 (블루투스 상대 없음과 같음).
+ *
+ * 사용법: vserial [-b baud] [-c 코스] [-s 시드] [-x 배속] [-t 초] [-l 링크] [-q]
+ *   -b  링크 속도 (기본 9600 - server.js / 블루투스 모듈 기본값, 0 = 제한 없음)
+ *   -c  room | pillars | corridor | clutter (기본 room)
+ *   -x  가상 시계 배속 (기본 1 = 실시간)
+ *   -t  이 시간(가상) 뒤 끝냄 (기본 Ctrl-C까지)
+ *   -l  pty 경로로 심볼릭 링크를 만듦 (끝날 때 지움)
+ *   -q  줄 출력 없이 끝에 요약만
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "world.h"
+#include "robot_state.h"
+#include "hal_sim.h"
+
+#define BITS_PER_BYTE   10          // 8N1
+#define TX_QUEUE        65536       // 2의 거듭제곱
+#define RX_QUEUE        1024
+#define CMD_PENDING     32
+#define LINE_MAX        128
+
+typedef struct {
+    uint8_t  c;
+    uint64_t t_us;                  // 가상 시각 (TX: 링크로 다 나간 때, RX: 다 도착한 때)
+} Byte_t;
+
+typedef struct {
+    uint8_t  c;
+    uint64_t read_us;               // pty에서 읽은 가상 시각
+} Cmd_t;
+
+static uint32_t baud = 9600;
+static uint32_t byte_us;            // 0 = 제한 없음
+static double   speed = 1.0;
+static uint64_t wall0;
+static int quiet;
+static volatile sig_atomic_t running = 1;
+
+static int master = -1;
+static int peer_open;               // pty 반대쪽 (서버)이 열려 있음
+
+static Byte_t   txq[TX_QUEUE];
+static uint32_t tx_head, tx_tail;
+static Byte_t   rxq[RX_QUEUE];
+static uint32_t rx_head, rx_tail;
+static uint64_t rx_wire_us;         // RX 선로가 비는 시각
+
+static uint64_t Wall_Us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000U + (uint64_t)ts.tv_nsec / 1000U;
+}
+
+/* 벽시계 기준 가상 시각 - 블로킹 TX 동안 펌웨어 시계(Sim_NowUs)는 이보다 앞서 나감 */
+static uint64_t Virt_Us(void)
+{
+    return (uint64_t)((Wall_Us() - wall0) * speed);
+}
+
+/* 지연 측정 - 읽은 뒤 아직 응답 줄이 끝나지 않은 명령 */
+static Cmd_t    pending[CMD_PENDING];
+static uint32_t pend_n;
+static uint64_t line_start_us;
+static char     line[LINE_MAX];
+static uint32_t line_len;
+
+static struct {
+    uint64_t tx_bytes, tx_dropped, rx_bytes, lines;
+    uint64_t tx_block_us;           // 펌웨어가 블로킹 TX로 멈춘 시간
+    uint64_t behind_us;             // 가상 시계가 벽시계보다 뒤처진 최대
+    uint32_t n[128];
+    double   sum_ms[128], max_ms[128];
+} st;
+
+/* ===== 링크 ===== */
+
+/* main.c __io_putchar + HAL_UART_Transmit(블로킹) */
+static void Tx_Byte(uint8_t c)
+{
+    if (byte_us)
+    {
+        Sim_Advance(byte_us);
+        st.tx_block_us += byte_us;
+    }
+    if (tx_head - tx_tail < TX_QUEUE)
+    {
+        txq[tx_head % TX_QUEUE].c = c;
+        txq[tx_head % TX_QUEUE].t_us = Sim_NowUs();
+        tx_head++;
+    }
+    else
+    {
+        st.tx_dropped++;
+    }
+    st.tx_bytes++;
+}
+
+static void Line_End(void)
+{
+    uint64_t now = Sim_NowUs();
+    uint32_t keep = 0;
+
+    line[line_len] = '\0';
+    st.lines++;
+    if (!quiet)
+        printf("[%9.3f] > %s\n", now / 1e6, line);
+
+    /* 이 줄이 시작되기 전에 읽은 명령은 이 줄이 응답 */
+    for (uint32_t i = 0; i < pend_n; i++)
+    {
+        Cmd_t *c = &pending[i];
+        double ms;
+
+        if (c->read_us > line_start_us)
+        {
+            pending[keep++] = *c;
+            continue;
+        }
+        ms = (now - c->read_us) / 1000.0;
+        st.n[c->c]++;
+        st.sum_ms[c->c] += ms;
+        if (ms > st.max_ms[c->c]) st.max_ms[c->c] = ms;
+        if (!quiet)
+            printf("            '%c' -> %.1f ms\n", c->c, ms);
+    }
+    pend_n = keep;
+    line_len = 0;
+}
+
+static void Uart_Sink(uint8_t c)
+{
+    if (line_len == 0 && c != '\r' && c != '\n')
+        line_start_us = Sim_NowUs();
+
+    if (c == '\n')
+        Tx_Byte('\r');
+    Tx_Byte(c);
+
+    if (c == '\n')
+        Line_End();
+    else if (c != '\r' && line_len < LINE_MAX - 1)
+        line[line_len++] = (char)c;
+}
+
+/* 세계 모델 훅 다음 - 다 도착한 RX 바이트를 수신 콜백으로 */
+static void Rx_Isr(uint64_t now)
+{
+    while (rx_tail != rx_head && rxq[rx_tail % RX_QUEUE].t_us <= now)
+    {
+        World_Rx(rxq[rx_tail % RX_QUEUE].c);
+        rx_tail++;
+    }
+}
+
+static void Rx_Read(void)
+{
+    uint8_t buf[256];
+    ssize_t n = read(master, buf, sizeof(buf));
+
+    for (ssize_t i = 0; i < n; i++)
+    {
+        uint64_t now = Virt_Us();
+
+        if (rx_head - rx_tail >= RX_QUEUE)
+            break;
+        if (rx_wire_us < now) rx_wire_us = now;
+        rx_wire_us += byte_us;
+        rxq[rx_head % RX_QUEUE].c = buf[i];
+        rxq[rx_head % RX_QUEUE].t_us = rx_wire_us;
+        rx_head++;
+        st.rx_bytes++;
+
+        if (buf[i] >= 0x20 && buf[i] < 0x7F && pend_n < CMD_PENDING)
+        {
+            pending[pend_n].c = buf[i];
+            pending[pend_n].read_us = now;
+            pend_n++;
+        }
+        if (!quiet)
+            printf("[%9.3f] < '%c'\n", now / 1e6, (buf[i] >= 0x20 && buf[i] < 0x7F) ? buf[i] : '?');
+    }
+}
+
+/* 선로로 다 나간 TX 바이트를 pty로 - 반대쪽이 안 열려 있으면 버림 */
+static void Tx_Drain(void)
+{
+    uint8_t buf[512];
+    uint32_t n = 0;
+    uint64_t now = Virt_Us();
+
+    while (tx_tail + n != tx_head && n < sizeof(buf) && txq[(tx_tail + n) % TX_QUEUE].t_us <= now)
+    {
+        buf[n] = txq[(tx_tail + n) % TX_QUEUE].c;
+        n++;
+    }
+    if (!n)
+        return;
+
+    if (peer_open)
+    {
+        ssize_t w = write(master, buf, n);
+
+        if (w < 0)
+            w = (errno == EAGAIN) ? 0 : (ssize_t)n;
+        if ((uint32_t)w < n)
+            st.tx_dropped += n - (uint32_t)w;   // 상대가 안 읽음 - 실제 링크처럼 밀리지 않고 잃음
+    }
+    else
+    {
+        st.tx_dropped += n;
+    }
+    tx_tail += n;
+}
+
+static int Pty_Open(const char *link)
+{
+    struct termios tio;
+    const char *name;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (master < 0 || grantpt(master) < 0 || unlockpt(master) < 0 || !(name = ptsname(master)))
+    {
+        perror("pty");
+        return 0;
+    }
+
+    /* 줄 규칙 없이 (반대쪽 serialport도 raw로 엶) */
+    if (tcgetattr(master, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        tcsetattr(master, TCSANOW, &tio);
+    }
+
+    printf("USART2 -> %s", name);
+    if (link)
+    {
+        unlink(link);
+        if (symlink(name, link) < 0)
+            perror(link);
+        else
+            printf(" (%s)", link);
+    }
+    printf("\n  node server.js --port %s --baud %u\n", link ? link : name, baud ? baud : 115200);
+    return 1;
+}
+
+/* ===== 실행 ===== */
+
+static void On_Signal(int sig)
+{
+    running = 0;
+}
+
+static void Summary(void)
+{
+    WorldResult_t r = World_Stats();
+    double secs = Sim_NowUs() / 1e6;
+    int any = 0;
+
+    printf("\n%.1f s at %u baud: tx %llu bytes (%.1f lines/s), rx %llu bytes, tx dropped %llu (no reader)\n",
+           secs, baud, (unsigned long long)st.tx_bytes, secs > 0 ? st.lines / secs : 0,
+           (unsigned long long)st.rx_bytes, (unsigned long long)st.tx_dropped);
+    printf("link busy = firmware blocked in UART TX %.1f%% of the time, behind wall clock max %.1f ms\n",
+           secs > 0 ? st.tx_block_us / 1e4 / secs : 0, st.behind_us / 1000.0);
+    printf("course %s: %.2f m/min, %u collisions, ALERT %.1f%%, %u sweeps, state %s\n", r.course,
+           r.m_per_min, r.collisions, r.alert_pct, r.sweeps, RobotState_Name(RobotState_Get()));
+
+    for (int c = 0; c < 128; c++)
+    {
+        if (!st.n[c]) continue;
+        if (!any++) printf("command -> reply line   n    avg ms   max ms\n");
+        printf("  '%c'                 %5u  %8.1f %8.1f\n", c, st.n[c], st.sum_ms[c] / st.n[c], st.max_ms[c]);
+    }
+    if (pend_n)
+        printf("  %u command(s) without a reply line\n", pend_n);
+}
+
+int main(int argc, char **argv)
+{
+    const char *course = "room", *link = NULL;
+    uint32_t seed = 1, secs = 0;
+    uint64_t end_us;
+    int k;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if      (!strcmp(argv[i], "-b") && i + 1 < argc) baud = (uint32_t)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc) course = argv[++i];
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-x") && i + 1 < argc) speed = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-t") && i + 1 < argc) secs = (uint32_t)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc) link = argv[++i];
+        else if (!strcmp(argv[i], "-q")) quiet = 1;
+        else
+        {
+            fprintf(stderr, "usage: vserial [-b baud] [-c room|pillars|corridor|clutter] [-s seed] [-x speed] "
+                            "[-t secs] [-l link] [-q]\n");
+            return 2;
+        }
+    }
+    if ((k = World_FindCourse(course)) < 0)
+    {
+        fprintf(stderr, "no course '%s'\n", course);
+        return 2;
+    }
+    if (speed <= 0) speed = 1.0;
+    byte_us = baud ? (BITS_PER_BYTE * 1000000U + baud - 1) / baud : 0;
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    if (!Pty_Open(link))
+        return 1;
+    signal(SIGINT, On_Signal);
+    signal(SIGTERM, On_Signal);
+
+    Sim_UartSink(Uart_Sink);
+    World_Open(k, seed, NULL);
+    World_SetIsr(Rx_Isr);
+    printf("course %s, %u baud (%u us/byte), x%.1f - waiting for commands (t = auto, w/s/a/d/x)\n",
+           course, baud, byte_us, speed);
+
+    wall0 = Wall_Us();
+    end_us = (uint64_t)secs * 1000000U;
+    while (running && (!secs || Sim_NowUs() < end_us))
+    {
+        struct pollfd pfd = { .fd = master, .events = POLLIN };
+        uint64_t target = Virt_Us();
+
+        while (Sim_NowUs() < target)
+        {
+            World_Loop();
+            Tx_Drain();
+        }
+        target = Virt_Us();
+        if (target > Sim_NowUs() && target - Sim_NowUs() > st.behind_us)
+            st.behind_us = target - Sim_NowUs();
+
+        /* 반대쪽이 닫혀 있으면 POLLHUP이 계속 - 그동안은 쉬면서 TX 버림 */
+        poll(&pfd, 1, 1);
+        peer_open = !(pfd.revents & POLLHUP);
+        if (pfd.revents & POLLIN)
+            Rx_Read();
+        Tx_Drain();
+        if (!peer_open)
+            usleep(1000);
+    }
+
+    Sim_SetHook(NULL);
+    Sim_UartSink(NULL);
+    Summary();
+    if (link)
+        unlink(link);
+    return 0;
+}
@@ -0,0 +1,383 @@
+/**
+ * @file sweep.c
+ * @brief 주행 파라미터 일괄 탐색 - (dist_safe, scan_step, scan_period, avoid_arc_ms) 조합 x 지도 (호스트)
+ *
+ * 조합마다 지도 묶음 전부를 world.c로 돌리고, 평균 속도(m/min) vs 충돌률(회/시간)의
+ * 파레토 앞면(어느 쪽으로도 더 나은 조합이 없는 것)을 표로 출력. 지금 튜닝 프로파일 값도 한 줄 같이.
+ *
+ * 병렬: 펌웨어 상태가 전역이라 한 프로세스 안 스레드로는 못 돌림 → 작업자 프로세스 (fork).
+ * 작업 = (조합, 지도) 하나, 공유 메모리의 원자 카운터에서 하나씩 가져감 -
+ * 먼저 끝난 작업자가 남은 작업을 계속 가져가므로 긴 작업이 몰려도 코어가 놀지 않음.
+ * 결과는 작업 번호 자리에 쓰므로 작업자 수 / 순서와 상관없이 같은 출력.
+ *
+ * dist_warning (곡선 회피 / 제자리 회전 경계)은 dist_safe / 2로 같이 바꿈.
+ *
+ * 사용법: sweep [-j 작업자] [-t 초] [-o 전체.csv]
+ *              [-safe 목록] [-step 목록] [-period 목록] [-arc 목록] [-maps 목록]
+ *   목록 = 쉼표로 구분 (예: -safe 20,30,40), 지도 = 코스[:시드] (예: -maps room,clutter:3)
+ *   기본: 7 x 5 x 5 x 5 = 875 조합 x 6 지도, 지도당 60초
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "world.h"
+#include "robot_config.h"
+#include "hal_sim.h"
+
+#define LIST_MAX        16
+#define MAP_MAX         16
+
+typedef struct {
+    uint16_t v[LIST_MAX];
+    int n;
+} List_t;
+
+typedef struct {
+    int course;
+    uint32_t seed;
+} Map_t;
+
+typedef struct {
+    uint16_t safe, step, period, arc;
+    uint8_t  is_default;
+    uint8_t  valid;
+    double   m_per_min;             // 지도 평균
+    double   coll_per_h;            // 지도 전체 충돌 / 전체 시간
+    double   alert_pct, cover_pct;
+    uint8_t  pareto;
+} Combo_t;
+
+/* 작업자 프로세스와 공유 */
+typedef struct {
+    uint32_t next;                  // 다음에 가져갈 작업
+    uint32_t done;
+    WorldResult_t res[];
+} Shared_t;
+
+static List_t l_safe   = { { 20, 25, 30, 40, 50, 60, 80 }, 7 };
+static List_t l_step   = { { 5, 10, 15, 20, 30 }, 5 };
+static List_t l_period = { { 20, 30, 40, 60, 80 }, 5 };
+static List_t l_arc    = { { 200, 350, 500, 750, 1000 }, 5 };
+
+static Map_t maps[MAP_MAX];
+static int map_n;
+
+static Combo_t *combos;
+static int combo_n;
+static uint32_t secs = 60;
+
+/* ===== 옵션 ===== */
+
+static int Parse_List(const char *s, List_t *l)
+{
+    char buf[128], *tok;
+
+    snprintf(buf, sizeof(buf), "%s", s);
+    l->n = 0;
+    for (tok = strtok(buf, ","); tok && l->n < LIST_MAX; tok = strtok(NULL, ","))
+        l->v[l->n++] = (uint16_t)strtoul(tok, NULL, 10);
+    return l->n > 0;
+}
+
+static int Parse_Maps(const char *s)
+{
+    char buf[256], *tok;
+
+    snprintf(buf, sizeof(buf), "%s", s);
+    map_n = 0;
+    for (tok = strtok(buf, ","); tok && map_n < MAP_MAX; tok = strtok(NULL, ","))
+    {
+        char *colon = strchr(tok, ':');
+
+        maps[map_n].seed = colon ? (uint32_t)strtoul(colon + 1, NULL, 0) : 1;
+        if (colon) *colon = '\0';
+        maps[map_n].course = World_FindCourse(tok);
+        if (maps[map_n].course < 0)
+        {
+            fprintf(stderr, "no course '%s'\n", tok);
+            return 0;
+        }
+        map_n++;
+    }
+    return map_n > 0;
+}
+
+/* ===== 조합 ===== */
+
+static void Combo_Params(const Combo_t *c, uint16_t *p)
+{
+    World_Defaults(p);
+    p[PARAM_DIST_SAFE]      = c->safe;
+    p[PARAM_DIST_WARNING]   = c->safe / 2;
+    p[PARAM_SCAN_STEP]      = c->step;
+    p[PARAM_SCAN_PERIOD_MS] = c->period;
+    p[PARAM_AVOID_ARC_MS]   = c->arc;
+}
+
+/* 격자 전부 + 맨 끝에 지금 튜닝 프로파일 */
+static void Build_Combos(void)
+{
+    uint16_t def[PARAM_COUNT];
+    Combo_t *c;
+
+    combo_n = l_safe.n * l_step.n * l_period.n * l_arc.n + 1;
+    combos = calloc((size_t)combo_n, sizeof(Combo_t));
+    c = combos;
+
+    for (int a = 0; a < l_safe.n; a++)
+        for (int b = 0; b < l_step.n; b++)
+            for (int d = 0; d < l_period.n; d++)
+                for (int e = 0; e < l_arc.n; e++, c++)
+                {
+                    c->safe   = l_safe.v[a];
+                    c->step   = l_step.v[b];
+                    c->period = l_period.v[d];
+                    c->arc    = l_arc.v[e];
+                }
+
+    World_Defaults(def);
+    c->safe   = def[PARAM_DIST_SAFE];
+    c->step   = def[PARAM_SCAN_STEP];
+    c->period = def[PARAM_SCAN_PERIOD_MS];
+    c->arc    = def[PARAM_AVOID_ARC_MS];
+    c->is_default = 1;
+}
+
+/* ===== 작업자 ===== */
+
+static void Worker(Shared_t *sh, uint32_t jobs)
+{
+    uint16_t p[PARAM_COUNT];
+
+    for (;;)
+    {
+        uint32_t j = __atomic_fetch_add(&sh->next, 1, __ATOMIC_RELAXED);
+        const Map_t *mp;
+
+        if (j >= jobs) break;
+        mp = &maps[j % map_n];
+        Combo_Params(&combos[j / map_n], p);
+        sh->res[j] = World_Run(mp->course, secs, mp->seed, p);
+        __atomic_fetch_add(&sh->done, 1, __ATOMIC_RELEASE);
+    }
+}
+
+static int Run_Pool(Shared_t *sh, uint32_t jobs, int workers)
+{
+    pid_t *pid = calloc((size_t)workers, sizeof(pid_t));
+    int tty = isatty(STDERR_FILENO);
+    int fails = 0;
+
+    fflush(stdout);
+    for (int i = 0; i < workers; i++)
+    {
+        pid[i] = fork();
+        if (pid[i] == 0)
+        {
+            Worker(sh, jobs);
+            _exit(0);
+        }
+        if (pid[i] < 0)
+        {
+            perror("fork");
+            workers = i;
+            break;
+        }
+    }
+    if (workers == 0)
+        Worker(sh, jobs);               // fork가 안 되면 혼자
+
+    while (__atomic_load_n(&sh->done, __ATOMIC_ACQUIRE) < jobs)
+    {
+        int st;
+
+        /* 작업자가 죽으면 남은 작업을 못 끝냄 */
+        if (waitpid(-1, &st, WNOHANG) > 0 && !(WIFEXITED(st) && WEXITSTATUS(st) == 0))
+        {
+            fprintf(stderr, "\nworker died\n");
+            fails++;
+            break;
+        }
+        if (tty)
+            fprintf(stderr, "\r  %u / %u jobs", __atomic_load_n(&sh->done, __ATOMIC_ACQUIRE), jobs);
+        usleep(200000);
+    }
+    if (tty)
+        fprintf(stderr, "\n");
+
+    for (int i = 0; i < workers; i++)
+        waitpid(pid[i], NULL, 0);           // 위에서 이미 거둔 작업자는 그냥 실패
+    free(pid);
+    return fails;
+}
+
+/* ===== 결과 ===== */
+
+static void Aggregate(const Shared_t *sh)
+{
+    for (int k = 0; k < combo_n; k++)
+    {
+        Combo_t *c = &combos[k];
+        uint32_t coll = 0;
+
+        c->valid = 1;
+        for (int i = 0; i < map_n; i++)
+        {
+            const WorldResult_t *r = &sh->res[k * map_n + i];
+
+            if (!r->valid) { c->valid = 0; break; }
+            c->m_per_min += r->m_per_min / map_n;
+            c->alert_pct += r->alert_pct / map_n;
+            c->cover_pct += r->cover_pct / map_n;
+            coll += r->collisions;
+        }
+        c->coll_per_h = coll * 3600.0 / ((double)secs * map_n);
+    }
+}
+
+/* a가 b보다 어느 쪽으로도 나쁘지 않고 한쪽은 더 나은지 */
+static int Dominates(const Combo_t *a, const Combo_t *b)
+{
+    return a->m_per_min >= b->m_per_min && a->coll_per_h <= b->coll_per_h &&
+           (a->m_per_min > b->m_per_min || a->coll_per_h < b->coll_per_h);
+}
+
+static int Dominated_By(const Combo_t *c)
+{
+    int n = 0;
+
+    for (int k = 0; k < combo_n; k++)
+        if (combos[k].valid && Dominates(&combos[k], c)) n++;
+    return n;
+}
+
+static int By_Speed(const void *a, const void *b)
+{
+    const Combo_t *x = *(const Combo_t * const *)a, *y = *(const Combo_t * const *)b;
+
+    return (x->m_per_min < y->m_per_min) - (x->m_per_min > y->m_per_min);
+}
+
+static void Print_Row(const Combo_t *c, const char *tag)
+{
+    printf("%5u %5u %7u %7u %7.2f %7.1f %7.1f %7.1f  %s\n", c->safe, c->step, c->period, c->arc,
+           c->m_per_min, c->coll_per_h, c->alert_pct, c->cover_pct, tag);
+}
+
+static void Report(const char *csv)
+{
+    const Combo_t **front = calloc((size_t)combo_n, sizeof(*front));
+    const Combo_t *def = &combos[combo_n - 1];
+    int fn = 0, invalid = 0;
+
+    for (int k = 0; k < combo_n; k++)
+    {
+        Combo_t *c = &combos[k];
+
+        if (!c->valid) { invalid++; continue; }
+        c->pareto = Dominated_By(c) == 0;
+        if (c->pareto) front[fn++] = c;
+    }
+    qsort(front, (size_t)fn, sizeof(*front), By_Speed);
+
+    printf("\nPareto front - speed vs collision rate (%d combos, %d rejected by param checks)\n",
+           combo_n - 1, invalid);
+    printf("%5s %5s %7s %7s %7s %7s %7s %7s\n", "safe", "step", "period", "arc ms",
+           "m/min", "coll/h", "ALERT%", "cover%");
+    for (int i = 0; i < fn; i++)
+        Print_Row(front[i], front[i]->is_default ? "<- " ROBOT_TUNE_NAME : "");
+
+    /* 지금 프로파일이 앞면 밖이면 따로 - 몇 개 조합이 더 나은지 */
+    if (def->valid && !def->pareto)
+    {
+        char tag[48];
+
+        snprintf(tag, sizeof(tag), "<- %s (dominated by %d)", ROBOT_TUNE_NAME, Dominated_By(def));
+        Print_Row(def, tag);
+    }
+
+    if (csv)
+    {
+        FILE *f = fopen(csv, "w");
+
+        if (!f) { perror(csv); free(front); return; }
+        fprintf(f, "dist_safe,scan_step,scan_period,avoid_arc_ms,valid,m_per_min,coll_per_h,alert_pct,cover_pct,pareto,default\n");
+        for (int k = 0; k < combo_n; k++)
+        {
+            const Combo_t *c = &combos[k];
+
+            fprintf(f, "%u,%u,%u,%u,%u,%.3f,%.2f,%.2f,%.2f,%u,%u\n", c->safe, c->step, c->period, c->arc,
+                    c->valid, c->m_per_min, c->coll_per_h, c->alert_pct, c->cover_pct, c->pareto, c->is_default);
+        }
+        fclose(f);
+        printf("all combos -> %s\n", csv);
+    }
+    free(front);
+}
+
+int main(int argc, char **argv)
+{
+    int workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *csv = NULL;
+    uint32_t jobs;
+    size_t shm_size;
+    Shared_t *sh;
+    int fails;
+
+    Parse_Maps("room,pillars,corridor,clutter:1,clutter:2,clutter:3");
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *a = argv[i], *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+        int ok = v != NULL;
+
+        if      (ok && !strcmp(a, "-j"))      workers = atoi(v);
+        else if (ok && !strcmp(a, "-t"))      secs = (uint32_t)atoi(v);
+        else if (ok && !strcmp(a, "-o"))      csv = v;
+        else if (ok && !strcmp(a, "-safe"))   ok = Parse_List(v, &l_safe);
+        else if (ok && !strcmp(a, "-step"))   ok = Parse_List(v, &l_step);
+        else if (ok && !strcmp(a, "-period")) ok = Parse_List(v, &l_period);
+        else if (ok && !strcmp(a, "-arc"))    ok = Parse_List(v, &l_arc);
+        else if (ok && !strcmp(a, "-maps"))   ok = Parse_Maps(v);
+        else ok = 0;
+
+        if (!ok)
+        {
+            fprintf(stderr, "usage: sweep [-j workers] [-t secs] [-o all.csv] [-safe list] [-step list]\n"
+                            "             [-period list] [-arc list] [-maps course[:seed],...]\n");
+            return 2;
+        }
+        i++;
+    }
+    if (workers < 1) workers = 1;
+    if (secs == 0) secs = 1;
+
+    Build_Combos();
+    jobs = (uint32_t)(combo_n * map_n);
+    shm_size = sizeof(Shared_t) + jobs * sizeof(WorldResult_t);
+    sh = mmap(NULL, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (sh == MAP_FAILED)
+    {
+        perror("mmap");
+        return 1;
+    }
+
+    Sim_UartEcho(0);
+    printf("hw=%s tune=%s  %d combos x %d maps x %u s = %u jobs, %d workers\n", ROBOT_HW_NAME,
+           ROBOT_TUNE_NAME, combo_n, map_n, secs, jobs, workers);
+
+    fails = Run_Pool(sh, jobs, workers);
+    if (fails)
+        return 1;
+
+    Aggregate(sh);
+    Report(csv);
+    munmap(sh, shm_size);
+    free(combos);
+    return 0;
+}
@@ -0,0 +1,701 @@
+/**
+ * @file world.c
+ * @brief 방 안 자율 주행 시뮬레이션 - 세계 모델 + 펌웨어 상태 머신 한 번 돌리기 (world.h)
+ *
+ * 펌웨어 쪽은 수정 없이 링크: robot_behavior.c (SCAN / DECIDE / MOVE / ALERT 표), robot_state.c,
+ * param.c, motor.c / encoder.c / heading.c, servo.c, ultrasonic.c, buzzer.c, radar.c.
+ * main.c처럼 UART 수신 경로로 't'를 넣어 시작하고 (robot_command.c),
+ * 메인 루프 한 바퀴 = Heading_Update + (50ms마다 UI_Update의 화면용 초음파 측정) + Param_Poll
+ *                   + RobotState_Run(start_flag) + LOOP_US.
+ * 화면용 측정은 보드처럼 블로킹 (ECHO 없으면 약 30ms)이고 TRIG가 SCAN 측정 사이에 끼어듦.
+ * World_Run은 펌웨어 UART 출력(STATE 줄 등)도 115200 블로킹 TX 시간만큼 시계를 흘림
+ * (vserial은 -b 링크 속도로 따로 셈).
+ * World_Record를 주면 펌웨어 주행 기록(reclog.c)을 파일로 - Tools/replay 검사용.
+ *
+ * 세계 모델 (Sim_SetHook - 가상 시계가 흐를 때마다 DT_US 간격으로 적분):
+ *   방      : 다각형 벽 / 장애물 (선분 목록), 코스 4개
+ *   차체    : 차동 구동 (4WD는 좌우 한 묶음씩), 바퀴는 drivesim과 같은 1차 지연 모델
+ *             MOTOR_SIDE_LEFT = 실제 왼쪽 바퀴 → Motor_Left(왼쪽 전진)는 시계 방향으로 돎
+ *             몸통은 반지름 CAR_R_MM 원 - 벽에 닿으면 이동은 막히고 회전과 바퀴 헛돌기(엔코더)는 계속
+ *   서보    : TIM2 CCR → 각도, 초당 SERVO_SLEW_DPS로 따라감. 0도 = 오른쪽, 180도 = 왼쪽
+ *   HC-SR04 : TRIG 하강 에지에서 빔 원뿔(반각 SONAR_HALF_DEG) 안 광선 중 가장 가까운 반사
+ *             입사각이 SONAR_INC_DEG보다 비스듬하면 (모서리 근처 제외) 돌아오지 않음,
+ *             SONAR_MAX_MM 밖 / 가끔 놓침 → ECHO 38ms HIGH (펌웨어는 30ms에서 0)
+ *             거리 잡음 = 가우시안 (2mm + 0.5%), ECHO 폭 = 왕복 시간 (58.3us/cm)
+ *             펌웨어의 240~23000us 유효 구간(ULTRASONIC_ECHO_MIN/MAX_US)은 ultrasonic.c가 그대로 적용
+ *
+ * 바쁜 대기(echo_time_us)가 끝나도록 Timebase_Us 한 번 읽을 때마다 1us가 흐름.
+ *
+ * World_Open / World_Loop / World_Rx는 한 세션을 도구가 직접 돌릴 때 (vserial - 실시간, UART 주고받기).
+ *
+ * 한 번 돌릴 때마다 새 자식 프로세스 (fork) - 펌웨어 정적 변수(스캔 각도, 램프, 회전 제어 ...)가
+ * 보드 전원을 켠 상태처럼 0에서 시작. 앞 실행의 상태가 남으면 순서에 따라 결과가 달라짐.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "world.h"
+#include "robot_behavior.h"
+#include "robot_command.h"
+#include "robot_config.h"
+#include "robot_state.h"
+#include "reclog.h"
+#include "drivers/buzzer.h"
+#include "drivers/encoder.h"
+#include "drivers/heading.h"
+#include "drivers/motor.h"
+#include "drivers/servo.h"
+#include "drivers/ultrasonic.h"
+#include "hal_sim.h"
+
+#define DT_US           100         // 세계 적분 간격
+#define LOOP_US         200         // 메인 루프 한 바퀴 (화면 그리기, I2C 폴링 등 나머지)
+#define UI_PERIOD_MS    50          // main.c UI_Update 주기 - 처음에 화면용 초음파 측정 (replay.c와 같게)
+#define UART_BYTE_US    87          // 115200 8N1 한 바이트 (main.c huart2, HAL_UART_Transmit 블로킹)
+#define READ_COST_US    1           // Timebase_Us 한 번
+
+/* 차체 (drivesim nominal) */
+#define WHEEL_V_FULL    400.0       // 듀티 100% 바퀴 속도 (mm/s)
+#define WHEEL_DEADBAND  20.0        // %
+#define WHEEL_TAU_MS    60.0
+#define CAR_R_MM        110.0       // 몸통 원 반지름
+
+/* 서보 / 초음파 */
+#define SERVO_SLEW_DPS  600.0       // SG90 0.1s/60도
+#define SONAR_X_MM      90.0        // 차체 중심에서 앞으로
+#define SONAR_HALF_DEG  15.0
+#define SONAR_RAYS      9
+#define SONAR_INC_DEG   60.0        // 이보다 비스듬하면 반사가 딴 데로
+#define SONAR_CORNER_MM 30.0        // 모서리 근처는 입사각과 상관없이 돌아옴
+#define SONAR_MAX_MM    4000.0
+#define SONAR_DROP      0.01        // 놓칠 확률
+#define SONAR_BURST_US  450         // TRIG 하강 → ECHO 상승
+#define SONAR_NONE_US   38000       // 아무것도 못 보면 ECHO HIGH 시간
+#define SOUND_US_PER_MM 5.831       // 왕복 (343 m/s)
+
+#define CELL_MM         100
+#define GRID_W          40
+#define GRID_H          30
+#define SEG_MAX         128
+
+/* ===== 방 ===== */
+
+typedef struct { double ax, ay, bx, by; } Seg_t;
+
+typedef struct {
+    const char *name;
+    void (*build)(void);
+    double x, y, th_deg;            // 출발 위치 (mm, 도 - 0 = +x, 반시계 +)
+} Course_t;
+
+static Seg_t seg[SEG_MAX];
+static int seg_n;
+static uint32_t rng = 1;
+
+static double Rand01(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return (rng & 0xFFFFFF) / (double)0x1000000;
+}
+
+static double Gauss(void)
+{
+    double u = Rand01() + 1e-12, v = Rand01();
+
+    return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+static void Add_Poly(const double (*p)[2], int n)
+{
+    for (int i = 0; i < n && seg_n < SEG_MAX; i++)
+    {
+        int j = (i + 1) % n;
+
+        seg[seg_n++] = (Seg_t){ p[i][0], p[i][1], p[j][0], p[j][1] };
+    }
+}
+
+/* 중심 (cx, cy), 크기 w x h, 기울기 a (도) */
+static void Add_Box(double cx, double cy, double w, double h, double a)
+{
+    double c = cos(a * M_PI / 180), s = sin(a * M_PI / 180);
+    double p[4][2];
+    static const double k[4][2] = { { -0.5, -0.5 }, { 0.5, -0.5 }, { 0.5, 0.5 }, { -0.5, 0.5 } };
+
+    for (int i = 0; i < 4; i++)
+    {
+        double dx = k[i][0] * w, dy = k[i][1] * h;
+
+        p[i][0] = cx + dx * c - dy * s;
+        p[i][1] = cy + dx * s + dy * c;
+    }
+    Add_Poly(p, 4);
+}
+
+static void Room_Walls(void)
+{
+    Add_Box(GRID_W * CELL_MM / 2.0, GRID_H * CELL_MM / 2.0, GRID_W * CELL_MM, GRID_H * CELL_MM, 0);
+}
+
+static void Build_Room(void)
+{
+    Room_Walls();
+}
+
+static void Build_Pillars(void)
+{
+    Room_Walls();
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 2; j++)
+            Add_Box(1200 + i * 1000, 1000 + j * 1000, 200, 200, 0);
+}
+
+/* 폭 700mm 고리 복도 + 안쪽 모서리 하나는 45도 벽 */
+static void Build_Corridor(void)
+{
+    static const double inner[5][2] = {
+        { 700, 700 }, { 3300, 700 }, { 3300, 1800 }, { 2800, 2300 }, { 700, 2300 }
+    };
+
+    Room_Walls();
+    Add_Poly(inner, 5);
+}
+
+/* 시드로 정하는 기울어진 상자 + 삼각형 - 출발 자리는 비움 */
+static void Build_Clutter(void)
+{
+    Room_Walls();
+    for (int n = 0; n < 9; )
+    {
+        double cx = 400 + Rand01() * 3200, cy = 400 + Rand01() * 2200;
+        double w = 150 + Rand01() * 350, h = 150 + Rand01() * 350;
+
+        if (hypot(cx - 500, cy - 1500) < 600)
+            continue;
+        if (n % 3 == 2)
+        {
+            double tri[3][2] = { { cx - w / 2, cy - h / 2 }, { cx + w / 2, cy - h / 2 }, { cx, cy + h / 2 } };
+
+            Add_Poly(tri, 3);
+        }
+        else
+        {
+            Add_Box(cx, cy, w, h, Rand01() * 90);
+        }
+        n++;
+    }
+}
+
+static const Course_t courses[] = {
+    { "room",     Build_Room,     500, 1500,  0 },
+    { "pillars",  Build_Pillars,  500, 1500,  0 },
+    { "corridor", Build_Corridor, 350, 1500, 90 },
+    { "clutter",  Build_Clutter,  500, 1500,  0 },
+};
+#define COURSE_COUNT    (int)(sizeof(courses) / sizeof(courses[0]))
+
+/* 점에서 선분까지 거리 */
+static double Seg_Dist(const Seg_t *s, double px, double py)
+{
+    double dx = s->bx - s->ax, dy = s->by - s->ay;
+    double t = ((px - s->ax) * dx + (py - s->ay) * dy) / (dx * dx + dy * dy);
+
+    if (t < 0) t = 0;
+    if (t > 1) t = 1;
+    return hypot(px - (s->ax + t * dx), py - (s->ay + t * dy));
+}
+
+static double Clearance(double x, double y)
+{
+    double d = 1e9;
+
+    for (int i = 0; i < seg_n; i++)
+    {
+        double e = Seg_Dist(&seg[i], x, y);
+
+        if (e < d) d = e;
+    }
+    return d;
+}
+
+/**
+ * @brief 광선 (ox, oy) + t (dx, dy) → 가장 가까운 선분 (거리, 번호, 만난 자리 매개변수 u)
+ */
+static double Ray_Cast(double ox, double oy, double dx, double dy, int *hit, double *hit_u)
+{
+    double best = 1e9;
+
+    *hit = -1;
+    for (int i = 0; i < seg_n; i++)
+    {
+        double ex = seg[i].bx - seg[i].ax, ey = seg[i].by - seg[i].ay;
+        double den = dx * ey - dy * ex;
+        double t, u;
+
+        if (fabs(den) < 1e-9) continue;
+        t = ((seg[i].ax - ox) * ey - (seg[i].ay - oy) * ex) / den;
+        u = ((seg[i].ax - ox) * dy - (seg[i].ay - oy) * dx) / den;
+        if (t > 0 && t < best && u >= 0 && u <= 1)
+        {
+            best = t;
+            *hit = i;
+            *hit_u = u;
+        }
+    }
+    return best;
+}
+
+/* ===== 갈 수 있는 칸 (몸통이 들어가는 칸을 출발점에서 채워 나감) ===== */
+
+static uint8_t reach[GRID_H][GRID_W];   // 1 = 갈 수 있음, 2 = 지나감
+static int reach_n, visited_n;
+
+static void Reach_Build(double x, double y)
+{
+    static int16_t stack[GRID_W * GRID_H * 4][2];    // 칸마다 이웃 4개까지
+    int sp = 0;
+
+    memset(reach, 0, sizeof(reach));
+    reach_n = visited_n = 0;
+    stack[sp][0] = (int16_t)(x / CELL_MM);
+    stack[sp++][1] = (int16_t)(y / CELL_MM);
+
+    while (sp)
+    {
+        int cx, cy;
+
+        sp--;
+        cx = stack[sp][0];
+        cy = stack[sp][1];
+
+        if (cx < 0 || cy < 0 || cx >= GRID_W || cy >= GRID_H || reach[cy][cx]) continue;
+        if (Clearance((cx + 0.5) * CELL_MM, (cy + 0.5) * CELL_MM) < CAR_R_MM) continue;
+        reach[cy][cx] = 1;
+        reach_n++;
+        stack[sp][0] = (int16_t)(cx + 1); stack[sp++][1] = (int16_t)cy;
+        stack[sp][0] = (int16_t)(cx - 1); stack[sp++][1] = (int16_t)cy;
+        stack[sp][0] = (int16_t)cx;       stack[sp++][1] = (int16_t)(cy + 1);
+        stack[sp][0] = (int16_t)cx;       stack[sp++][1] = (int16_t)(cy - 1);
+    }
+}
+
+static void Reach_Visit(double x, double y)
+{
+    int cx = (int)(x / CELL_MM), cy = (int)(y / CELL_MM);
+
+    if (cx >= 0 && cy >= 0 && cx < GRID_W && cy < GRID_H && reach[cy][cx] == 1)
+    {
+        reach[cy][cx] = 2;
+        visited_n++;
+    }
+}
+
+/* ===== 세계 상태 ===== */
+
+static TIM_HandleTypeDef htim2_sim, htim3_sim, htim4_sim;
+static Sim_Hook_t isr_hook;             // 도구 쪽 ISR 사건 (World_SetIsr)
+
+static struct {
+    uint64_t t_us;                  // 적분한 시각
+    double x, y, th;                // mm, rad (반시계 +)
+    double v[MOTOR_SIDE_COUNT];     // 바퀴 mm/s
+    double left_um;                 // 왼쪽 바퀴 누적 (엔코더 에지)
+    double servo_deg;
+    uint8_t trig_prev;
+    uint64_t echo_rise, echo_fall;
+    uint8_t contact;
+    uint32_t ui_tick;               // main.c 메인 루프의 ui_tick
+} w;
+
+static struct {
+    double dist_mm;
+    uint32_t collisions;
+    uint64_t contact_us;
+    uint32_t pings, no_echo;
+} m;
+
+static double Wheel_Target(double duty)
+{
+    double mag = fabs(duty);
+
+    if (mag <= WHEEL_DEADBAND) return 0;
+    return copysign((mag - WHEEL_DEADBAND) / (100.0 - WHEEL_DEADBAND) * WHEEL_V_FULL, duty);
+}
+
+static void Wheel_Step(int side)
+{
+    double target = Wheel_Target(Motor_GetSpeed(side));
+    double *v = &w.v[side];
+
+    if (*v == 0 && target == 0) return;
+    *v += (target - *v) * (DT_US / 1000.0) / WHEEL_TAU_MS;
+    if (target == 0 && fabs(*v) < 5) *v = 0;
+}
+
+/* TIM2 CCR → 목표 각도 (servo.c의 반대) */
+static double Servo_Target(void)
+{
+    double ccr = __HAL_TIM_GET_COMPARE(&htim2_sim, TIM_CHANNEL_1);
+
+    return (ccr - SERVO_CCR_MIN) * 180.0 / (SERVO_CCR_MAX - SERVO_CCR_MIN);
+}
+
+/**
+ * @brief 지금 서보 방향으로 한 번 측정 → ECHO 폭 (0 = 돌아오지 않음)
+ */
+static uint32_t Sonar_Measure(void)
+{
+    double sx = w.x + SONAR_X_MM * cos(w.th), sy = w.y + SONAR_X_MM * sin(w.th);
+    double axis = w.th + (w.servo_deg - 90.0) * M_PI / 180;
+    double best = 1e9;
+
+    for (int k = 0; k < SONAR_RAYS; k++)
+    {
+        double a = axis + (-SONAR_HALF_DEG + 2 * SONAR_HALF_DEG * k / (SONAR_RAYS - 1)) * M_PI / 180;
+        double dx = cos(a), dy = sin(a), u = 0;
+        int hit;
+        double t = Ray_Cast(sx, sy, dx, dy, &hit, &u);
+
+        if (hit < 0 || t >= best) continue;
+
+        {
+            const Seg_t *s = &seg[hit];
+            double len = hypot(s->bx - s->ax, s->by - s->ay);
+            double nx = -(s->by - s->ay) / len, ny = (s->bx - s->ax) / len;
+            double inc = acos(fabs(dx * nx + dy * ny)) * 180 / M_PI;
+            int corner = (u * len < SONAR_CORNER_MM) || ((1 - u) * len < SONAR_CORNER_MM);
+
+            if (inc <= SONAR_INC_DEG || corner)
+                best = t;
+        }
+    }
+
+    if (best > SONAR_MAX_MM || Rand01() < SONAR_DROP)
+        return 0;
+
+    best += Gauss() * (2.0 + 0.005 * best);
+    if (best < 0) best = 0;
+    return (uint32_t)(best * SOUND_US_PER_MM);
+}
+
+static void World_Step(void)
+{
+    double before = w.left_um;
+    double vl, vr, v, nx, ny, dt = DT_US / 1e6;
+
+    if (w.t_us % 1000 == 0) Motor_OnPeriod();
+
+    Wheel_Step(MOTOR_SIDE_LEFT);
+    Wheel_Step(MOTOR_SIDE_RIGHT);
+    vl = w.v[MOTOR_SIDE_LEFT];
+    vr = w.v[MOTOR_SIDE_RIGHT];
+
+    /* 바퀴는 막혀도 돎 - 엔코더는 바퀴 기준 */
+    w.left_um += fabs(vl) * DT_US / 1000.0;
+    if ((long)(w.left_um / ENCODER_UM_PER_EDGE) != (long)(before / ENCODER_UM_PER_EDGE))
+    {
+        RecLog_Edge();                          // main.c EXTI 콜백과 같은 순서
+        Encoder_OnEdge();
+    }
+
+    v  = (vl + vr) / 2;
+    w.th += (vr - vl) / TRACK_EFFECTIVE_MM * dt;
+    nx = w.x + v * cos(w.th) * dt;
+    ny = w.y + v * sin(w.th) * dt;
+
+    if (Clearance(nx, ny) < CAR_R_MM)
+    {
+        if (!w.contact) m.collisions++;
+        w.contact = 1;
+        m.contact_us += DT_US;
+    }
+    else
+    {
+        w.contact = 0;
+        m.dist_mm += hypot(nx - w.x, ny - w.y);
+        w.x = nx;
+        w.y = ny;
+        Reach_Visit(w.x, w.y);
+    }
+
+    if (htim2_sim.running)
+    {
+        double target = Servo_Target(), step = SERVO_SLEW_DPS * dt;
+
+        if (fabs(target - w.servo_deg) <= step) w.servo_deg = target;
+        else w.servo_deg += (target > w.servo_deg) ? step : -step;
+    }
+
+    w.t_us += DT_US;
+}
+
+/**
+ * @brief 가상 시계 훅 - 밀린 적분 + TRIG 에지 / ECHO 핀
+ */
+static void World_Hook(uint64_t now)
+{
+    uint8_t trig = (ULTRASONIC_TRIG_PORT->ODR & ULTRASONIC_TRIG_PIN) != 0U;
+
+    while (w.t_us + DT_US <= now)
+        World_Step();
+
+    if (w.trig_prev && !trig)
+    {
+        uint32_t echo = Sonar_Measure();
+
+        m.pings++;
+        if (!echo) m.no_echo++;
+        w.echo_rise = now + SONAR_BURST_US;
+        w.echo_fall = w.echo_rise + (echo ? echo : SONAR_NONE_US);
+    }
+    w.trig_prev = trig;
+
+    if (now >= w.echo_rise && now < w.echo_fall)
+        ULTRASONIC_ECHO_PORT->IDR |= ULTRASONIC_ECHO_PIN;
+    else
+        ULTRASONIC_ECHO_PORT->IDR &= ~(uint32_t)ULTRASONIC_ECHO_PIN;
+
+    if (isr_hook)
+        isr_hook(now);
+}
+
+/* ===== 실행 ===== */
+
+/* Param_Set은 관계를 하나씩 검사 - 바꾸는 순서에 따라 중간에 어긋날 수 있어 여러 바퀴 */
+static uint8_t Apply_Params(const uint16_t *p)
+{
+    for (int pass = 0; pass < PARAM_COUNT; pass++)
+    {
+        uint8_t left = 0;
+
+        for (int i = 0; i < PARAM_COUNT; i++)
+            if (param_val[i] != p[i] && Param_Set((ParamId_t)i, p[i]) != PARAM_OK)
+                left++;
+        if (!left) return 1;
+    }
+    return 0;
+}
+
+int World_CourseCount(void)
+{
+    return COURSE_COUNT;
+}
+
+const char *World_CourseName(int k)
+{
+    return (k >= 0 && k < COURSE_COUNT) ? courses[k].name : "?";
+}
+
+int World_FindCourse(const char *name)
+{
+    for (int k = 0; k < COURSE_COUNT; k++)
+        if (!strcmp(name, courses[k].name)) return k;
+    return -1;
+}
+
+void World_Defaults(uint16_t *params)
+{
+    Param_Defaults();
+    memcpy(params, param_val, sizeof(param_val));
+}
+
+static const char *rec_path;
+static int open_course;
+static uint32_t open_seed;
+
+void World_Record(const char *path)
+{
+    rec_path = path;
+}
+
+/* main.c 수신 콜백 */
+static void Uart_Rx(uint8_t c)
+{
+    RecLog_Rx(c);
+    if (!Param_RxChar(c))
+        RobotCommand_Handle(c);
+}
+
+static void On_StateChange(RobotState_t s)
+{
+    RecLog_State((uint8_t)s);
+}
+
+static void Rec_Save(void)
+{
+    const uint8_t *buf;
+    uint32_t len = RecLog_Data(&buf);
+    FILE *f = fopen(rec_path, "wb");
+
+    if (!f || fwrite(buf, 1, len, f) != len)
+        perror(rec_path);
+    if (f)
+        fclose(f);
+}
+
+void World_Rx(uint8_t c)
+{
+    Uart_Rx(c);
+}
+
+void World_SetIsr(Sim_Hook_t fn)
+{
+    isr_hook = fn;
+}
+
+/**
+ * @brief 코스에 차를 놓고 펌웨어를 전원 켠 상태로 (main.c 초기화 순서, 주행에 쓰는 것만)
+ * @return 0 = params가 범위 / 관계 검사에서 거절됨
+ * @note   't'는 넣지 않음 - World_Run이 넣거나 도구가 World_Rx로
+ */
+int World_Open(int course, uint32_t seed, const uint16_t *params)
+{
+    const Course_t *c = &courses[course];
+
+    open_course = course;
+    open_seed = seed;
+    rng = seed ? seed : 1;
+    seg_n = 0;
+    c->build();
+    Reach_Build(c->x, c->y);
+
+    memset(&w, 0, sizeof(w));
+    memset(&m, 0, sizeof(m));
+    w.x = c->x;
+    w.y = c->y;
+    w.th = c->th_deg * M_PI / 180;
+    w.servo_deg = SERVO_CENTER_ANGLE;
+    Reach_Visit(w.x, w.y);
+
+    Sim_Reset();
+    Sim_FlashReset();
+    Param_Init();
+    if (params && !Apply_Params(params))
+        return 0;
+    Motor_Init(&htim3_sim);
+    Encoder_Init();
+    Heading_Init();
+    Ultrasonic_Init();
+    Servo_Init(&htim2_sim, TIM_CHANNEL_1);
+    Buzzer_Init(&htim4_sim);
+    Behavior_Init();
+    RobotState_SetListener(On_StateChange);
+    RecLog_Start(rec_path ? RECLOG_RAM : RECLOG_OFF);
+
+    Sim_TimebaseReadCost(READ_COST_US);
+    Sim_SetHook(World_Hook);
+    return 1;
+}
+
+/* main.c while(1) 한 바퀴 */
+void World_Loop(void)
+{
+    uint32_t now;
+
+    Heading_Update();
+
+    now = HAL_GetTick();
+    if (now - w.ui_tick >= UI_PERIOD_MS)
+    {
+        w.ui_tick = now;
+        RecLog_Dist(RECLOG_DIST_UI, Ultrasonic_GetDistance());  // UI_Update 처음 (그리기는 LOOP_US)
+    }
+
+    Param_Poll();
+    RobotState_Run(start_flag);
+    Sim_Advance(LOOP_US);
+}
+
+WorldResult_t World_Stats(void)
+{
+    WorldResult_t r;
+    double secs = Sim_NowUs() / 1e6;
+
+    memset(&r, 0, sizeof(r));
+    r.course     = courses[open_course].name;
+    r.seed       = open_seed;
+    r.valid      = 1;
+    if (secs <= 0)
+        return r;
+    r.m_per_min  = m.dist_mm / 1000 / (secs / 60.0);
+    r.collisions = m.collisions;
+    r.contact_s  = m.contact_us / 1e6;
+    r.alert_pct  = RobotState_TimeInMs(STATE_ALERT) / 10.0 / secs;
+    r.alerts     = RobotState_Entries(STATE_ALERT);
+    r.sweeps     = RobotState_Entries(STATE_DECIDE);
+    r.cover_pct  = 100.0 * visited_n / (reach_n ? reach_n : 1);
+    r.noecho_pct = 100.0 * m.no_echo / (m.pings ? m.pings : 1);
+    return r;
+}
+
+static WorldResult_t Run(int course, uint32_t secs, uint32_t seed, const uint16_t *params)
+{
+    WorldResult_t r;
+    uint64_t end_us;
+    clock_t t0 = clock();
+    double wall;
+
+    if (!World_Open(course, seed, params))
+    {
+        memset(&r, 0, sizeof(r));
+        r.course = courses[course].name;
+        r.seed   = seed;
+        return r;
+    }
+
+    Sim_UartTxCost(UART_BYTE_US);
+    Uart_Rx('t');
+    end_us = Sim_NowUs() + (uint64_t)secs * 1000000U;
+    while (Sim_NowUs() < end_us)
+        World_Loop();
+
+    Sim_SetHook(NULL);
+    Sim_TimebaseReadCost(0);
+    Sim_UartTxCost(0);
+    if (rec_path)
+        Rec_Save();
+    wall = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+    r = World_Stats();
+    r.speedup = (wall > 0) ? secs / wall : 0;
+    return r;
+}
+
+WorldResult_t World_Run(int course, uint32_t secs, uint32_t seed, const uint16_t *params)
+{
+    WorldResult_t *shared, r;
+    pid_t pid;
+    int st;
+
+    shared = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED)
+        return Run(course, secs, seed, params);
+
+    memset(shared, 0, sizeof(*shared));
+    fflush(stdout);
+    pid = fork();
+    if (pid == 0)
+    {
+        *shared = Run(course, secs, seed, params);
+        fflush(stdout);
+        _exit(0);
+    }
+
+    if (pid < 0)
+        *shared = Run(course, secs, seed, params);      // fork가 안 되면 이 프로세스에서
+    else if (waitpid(pid, &st, 0) != pid || !WIFEXITED(st) || WEXITSTATUS(st) != 0)
+        shared->valid = 0;
+
+    r = *shared;
+    r.course = courses[course].name;
+    munmap(shared, sizeof(*shared));
+    return r;
+}
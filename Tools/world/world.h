@@ -0,0 +1,46 @@
+/**
+ * @file world.h
+ * @brief 방 안 자율 주행 시뮬레이션 (world.c) - worldsim / sweep 공용
+ *
+ * World_Run은 자식 프로세스에서 돌림 - 펌웨어 전역 상태가 실행마다 전원 켠 상태에서 시작.
+ */
+
+#ifndef __WORLD_H
+#define __WORLD_H
+
+#include <stdint.h>
+#include "param.h"
+#include "hal_sim.h"
+
+typedef struct {
+    const char *course;
+    uint32_t seed;
+    uint8_t  valid;                 // 0 = 파라미터가 범위 / 관계 검사에서 거절됨, 또는 실행 실패 (나머지 0)
+    double   m_per_min;             // 실제로 움직인 거리
+    uint32_t collisions;
+    double   contact_s;
+    double   alert_pct;             // ALERT 체류 시간 비율
+    uint32_t alerts, sweeps;        // ALERT / DECIDE 진입 횟수
+    double   cover_pct;             // 갈 수 있는 칸 중 지나간 칸
+    double   noecho_pct;
+    double   speedup;               // 실시간 대비 배속 (CPU 시간)
+} WorldResult_t;
+
+int           World_CourseCount(void);
+const char   *World_CourseName(int k);
+int           World_FindCourse(const char *name);   // 없으면 -1
+void          World_Defaults(uint16_t *params);     // param.c 기본값 (PARAM_COUNT개)
+
+void          World_Record(const char *path);       // 다음 World_Run부터 reclog 이진 기록을 파일로 (NULL = 끔)
+
+/* params: PARAM_COUNT개 (NULL = 기본값), seed: 잡음 + clutter 배치 */
+WorldResult_t World_Run(int course, uint32_t secs, uint32_t seed, const uint16_t *params);
+
+/* 세션 하나를 이 프로세스에서 직접 (한 번만 - 펌웨어 전역 상태) */
+int           World_Open(int course, uint32_t seed, const uint16_t *params);  // 0 = params 거절
+void          World_Loop(void);                     // 메인 루프 한 바퀴 (LOOP_US)
+void          World_Rx(uint8_t c);                  // UART 수신 콜백 경로
+void          World_SetIsr(Sim_Hook_t fn);          // 세계 모델 다음에 부름 - 도구 쪽 ISR 사건
+WorldResult_t World_Stats(void);                    // World_Open 뒤 지금까지 (speedup 0)
+
+#endif /* __WORLD_H */
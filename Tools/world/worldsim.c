@@ -0,0 +1,87 @@
+/**
+ * @file worldsim.c
+ * @brief 방 안 자율 주행 시뮬레이션 - 코스마다 기본 파라미터로 한 번씩 (호스트, 세계 모델은 world.c)
+ *
+ * 지표 (코스마다, 펌웨어 버전끼리 비교용 RESULT 줄):
+ *   m/min      실제로 움직인 거리 (바퀴 헛돌기 제외)
+ *   coll       벽에 닿은 횟수, contact = 닿아 있던 시간
+ *   ALERT %    ALERT 체류 시간 비율, alerts = 진입 횟수
+ *   cover %    갈 수 있는 100mm 칸 중 차체 중심이 지나간 칸
+ *   no-echo %  측정 중 ECHO 없음 (펌웨어 0 cm)
+ *   x rt       실시간 대비 배속
+ *
+ * 사용법: worldsim [-t 초] [-c 코스] [-s 시드] [-v] [-r 기록파일]
+ *   -t  코스당 시뮬레이션 시간 (기본 300초)
+ *   -c  room | pillars | corridor | clutter (기본 전부)
+ *   -v  펌웨어 UART 출력 (STATE:... 줄)
+ *   -r  펌웨어 주행 기록(reclog 이진)을 파일로 - 코스 하나만 (-c), Tools/replay로 다시 돌림
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "world.h"
+#include "robot_config.h"
+#include "hal_sim.h"
+
+#define COURSES_MAX     8
+
+int main(int argc, char **argv)
+{
+    WorldResult_t res[COURSES_MAX];
+    uint32_t secs = 300, seed = 1;
+    const char *only = NULL, *rec = NULL;
+    int verbose = 0, ran = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if      (!strcmp(argv[i], "-t") && i + 1 < argc) secs = (uint32_t)atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc) only = argv[++i];
+        else if (!strcmp(argv[i], "-s") && i + 1 < argc) seed = (uint32_t)strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-r") && i + 1 < argc) rec = argv[++i];
+        else if (!strcmp(argv[i], "-v")) verbose = 1;
+        else
+        {
+            fprintf(stderr, "usage: worldsim [-t secs] [-c room|pillars|corridor|clutter] [-s seed] [-v] [-r log -c course]\n");
+            return 2;
+        }
+    }
+    if (secs == 0) secs = 1;
+
+    if (only && World_FindCourse(only) < 0)
+    {
+        fprintf(stderr, "no course '%s'\n", only);
+        return 2;
+    }
+    if (rec && !only)
+    {
+        fprintf(stderr, "-r needs -c (one course per log)\n");
+        return 2;
+    }
+    World_Record(rec);
+
+    Sim_UartEcho((uint8_t)verbose);
+    printf("hw=%s tune=%s  %u s per course, seed %u\n", ROBOT_HW_NAME, ROBOT_TUNE_NAME, secs, seed);
+    printf("%-9s %6s %5s %9s %7s %7s %7s %7s %7s %6s\n", "course", "m/min", "coll", "contact s",
+           "ALERT%", "alerts", "sweeps", "cover%", "noecho%", "x rt");
+
+    for (int k = 0; k < World_CourseCount() && ran < COURSES_MAX; k++)
+    {
+        WorldResult_t *r = &res[ran];
+
+        if (only && strcmp(only, World_CourseName(k))) continue;
+        *r = World_Run(k, secs, seed, NULL);
+        printf("%-9s %6.2f %5u %9.1f %7.1f %7u %7u %7.1f %7.1f %6.0f\n", r->course, r->m_per_min,
+               r->collisions, r->contact_s, r->alert_pct, r->alerts, r->sweeps, r->cover_pct,
+               r->noecho_pct, r->speedup);
+        ran++;
+    }
+    /* 버전끼리 비교 (diff / grep RESULT) - 배속은 PC에 따라 다르니 뺌 */
+    for (int k = 0; k < ran; k++)
+        printf("RESULT course=%s secs=%u seed=%u m_per_min=%.2f collisions=%u contact_s=%.1f "
+               "alert_pct=%.1f alerts=%u sweeps=%u cover_pct=%.1f\n",
+               res[k].course, secs, seed, res[k].m_per_min, res[k].collisions, res[k].contact_s,
+               res[k].alert_pct, res[k].alerts, res[k].sweeps, res[k].cover_pct);
+    return 0;
+}